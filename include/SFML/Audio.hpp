@@ -28,19 +28,28 @@
 // Headers
 ////////////////////////////////////////////////////////////
 
+#include <SFML/Audio/AsyncOutputSoundFile.hpp>
+#include <SFML/Audio/BiquadFilter.hpp>
+#include <SFML/Audio/Compressor.hpp>
 #include <SFML/Audio/InputSoundFile.hpp>
 #include <SFML/Audio/Listener.hpp>
+#include <SFML/Audio/Mixer.hpp>
+#include <SFML/Audio/MixerEffect.hpp>
 #include <SFML/Audio/Music.hpp>
 #include <SFML/Audio/OutputSoundFile.hpp>
+#include <SFML/Audio/SampleFormat.hpp>
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Audio/SoundBufferCache.hpp>
 #include <SFML/Audio/SoundBufferRecorder.hpp>
 #include <SFML/Audio/SoundFileFactory.hpp>
 #include <SFML/Audio/SoundFileReader.hpp>
 #include <SFML/Audio/SoundFileWriter.hpp>
 #include <SFML/Audio/SoundRecorder.hpp>
+#include <SFML/Audio/SoundRingRecorder.hpp>
 #include <SFML/Audio/SoundSource.hpp>
 #include <SFML/Audio/SoundStream.hpp>
+#include <SFML/Audio/VoicePool.hpp>
 
 #include <SFML/System.hpp>
 
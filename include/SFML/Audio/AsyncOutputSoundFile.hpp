@@ -0,0 +1,231 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <SFML/Audio/SampleFormat.hpp>
+
+#include <filesystem>
+#include <memory>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Write sound files from a background thread
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API AsyncOutputSoundFile
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the writer
+    ///
+    /// When the file can't be written fast enough and
+    /// \a maxQueuedBlocks blocks of samples are already
+    /// waiting to be written, the new blocks are dropped.
+    ///
+    /// \param maxQueuedBlocks Maximum number of blocks waiting to be written
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit AsyncOutputSoundFile(std::size_t maxQueuedBlocks = 64);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Writes the queued samples and closes the file.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~AsyncOutputSoundFile();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    AsyncOutputSoundFile(const AsyncOutputSoundFile&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    AsyncOutputSoundFile& operator=(const AsyncOutputSoundFile&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open the sound file from the disk for writing
+    ///
+    /// The file is created on the calling thread, so that
+    /// errors are reported right away; the samples are then
+    /// encoded and written by a background thread.
+    /// If a file is already open, it is closed first.
+    ///
+    /// \param filename     Path of the sound file to write
+    /// \param sampleRate   Sample rate of the sound
+    /// \param channelCount Number of channels in the sound
+    /// \param sampleFormat Format of the samples stored in the file
+    ///
+    /// \return True if the file was successfully opened
+    ///
+    /// \see sf::OutputSoundFile::openFromFile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool openFromFile(const std::filesystem::path& filename,
+                                    unsigned int                 sampleRate,
+                                    unsigned int                 channelCount,
+                                    SampleFormat                 sampleFormat = SampleFormat::Int16);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a block of audio samples to be written
+    ///
+    /// The samples are copied, so the array can be reused as
+    /// soon as the function returns. The function never waits
+    /// for the file to be written: if the queue is full, the
+    /// block is dropped.
+    ///
+    /// \param samples Pointer to the sample array to write
+    /// \param count   Number of samples to write
+    ///
+    /// \return True if the block was queued, false if it was dropped or no file is open
+    ///
+    ////////////////////////////////////////////////////////////
+    bool write(const std::int16_t* samples, std::uint64_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a block of float audio samples to be written
+    ///
+    /// The samples are expected in the [-1, 1] range.
+    ///
+    /// \param samples Pointer to the sample array to write
+    /// \param count   Number of samples to write
+    ///
+    /// \return True if the block was queued, false if it was dropped or no file is open
+    ///
+    ////////////////////////////////////////////////////////////
+    bool write(const float* samples, std::uint64_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until all the queued blocks are written
+    ///
+    ////////////////////////////////////////////////////////////
+    void flush();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write the queued blocks and close the current file
+    ///
+    ////////////////////////////////////////////////////////////
+    void close();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of blocks waiting to be written
+    ///
+    /// The block being written, if any, is included.
+    ///
+    /// \return Number of queued blocks
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getQueuedBlockCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of blocks dropped since the file was opened
+    ///
+    /// \return Number of dropped blocks
+    ///
+    ////////////////////////////////////////////////////////////
+    std::uint64_t getDroppedBlockCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::AsyncOutputSoundFile
+/// \ingroup audio
+///
+/// Encoding samples, especially to FLAC or OGG/Vorbis, takes
+/// time. Done with sf::OutputSoundFile from a time-critical
+/// thread, for example in sf::SoundRecorder::onProcessSamples,
+/// it can make that thread miss its deadlines.
+///
+/// sf::AsyncOutputSoundFile copies the blocks of samples
+/// passed to write() into a bounded queue and encodes them
+/// on a background thread. write() never blocks: when the
+/// queue is full, the block is dropped and counted by
+/// getDroppedBlockCount(). The memory of the written blocks
+/// is reused for the next ones, so a steady stream of blocks
+/// of the same size doesn't allocate.
+///
+/// close(), openFromFile() and the destructor write all the
+/// queued blocks before closing the file.
+///
+/// Usage example:
+/// \code
+/// class FileRecorder : public sf::SoundRecorder
+/// {
+/// public:
+///     ~FileRecorder() override
+///     {
+///         stop();
+///     }
+///
+///     sf::AsyncOutputSoundFile file;
+///
+/// private:
+///     [[nodiscard]] bool onProcessSamples(const std::int16_t* samples, std::size_t sampleCount) override
+///     {
+///         if (!file.write(samples, sampleCount))
+///             std::cerr << "Dropped " << sampleCount << " samples" << std::endl;
+///
+///         return true;
+///     }
+/// };
+///
+/// FileRecorder recorder;
+/// if (!recorder.file.openFromFile("session.flac", 44100, 1))
+///     /* error */;
+///
+/// if (!recorder.start(44100))
+///     /* error */;
+/// ...
+/// recorder.stop();
+/// recorder.file.close();
+/// \endcode
+///
+/// \see sf::OutputSoundFile, sf::SoundRecorder
+///
+////////////////////////////////////////////////////////////
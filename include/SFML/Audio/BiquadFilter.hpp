@@ -0,0 +1,223 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <SFML/Audio/MixerEffect.hpp>
+
+#include <atomic>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Second order IIR filter, usable as a mixer effect
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API BiquadFilter : public MixerEffect
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Response of the filter
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Type
+    {
+        LowPass,  //!< Attenuate the frequencies above the cutoff frequency
+        HighPass, //!< Attenuate the frequencies below the cutoff frequency
+        BandPass, //!< Only keep the frequencies around the center frequency
+        Notch,    //!< Remove the frequencies around the center frequency
+        Peak,     //!< Boost or cut the frequencies around the center frequency
+        LowShelf, //!< Boost or cut the frequencies below the cutoff frequency
+        HighShelf //!< Boost or cut the frequencies above the cutoff frequency
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the filter
+    ///
+    /// \param type      Response of the filter
+    /// \param frequency Cutoff or center frequency, in Hz
+    /// \param q         Quality factor, the higher the narrower the band around \a frequency
+    /// \param gain      Gain of the Peak, LowShelf and HighShelf filters, in dB
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit BiquadFilter(Type type = Type::LowPass, float frequency = 1000.f, float q = 0.7071f, float gain = 0.f);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the response of the filter
+    ///
+    /// \param type New response of the filter
+    ///
+    ////////////////////////////////////////////////////////////
+    void setType(Type type);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the cutoff or center frequency of the filter
+    ///
+    /// The frequency is clamped below half the sample rate.
+    ///
+    /// \param frequency New frequency, in Hz
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFrequency(float frequency);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the quality factor of the filter
+    ///
+    /// 0.7071 gives the flattest response for the low-pass and
+    /// high-pass filters.
+    ///
+    /// \param q New quality factor, greater than 0
+    ///
+    ////////////////////////////////////////////////////////////
+    void setQ(float q);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the gain of the Peak, LowShelf and HighShelf filters
+    ///
+    /// \param gain New gain, in dB
+    ///
+    ////////////////////////////////////////////////////////////
+    void setGain(float gain);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the response of the filter
+    ///
+    /// \return Response of the filter
+    ///
+    ////////////////////////////////////////////////////////////
+    Type getType() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the cutoff or center frequency of the filter
+    ///
+    /// \return Frequency, in Hz
+    ///
+    ////////////////////////////////////////////////////////////
+    float getFrequency() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the quality factor of the filter
+    ///
+    /// \return Quality factor
+    ///
+    ////////////////////////////////////////////////////////////
+    float getQ() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the gain of the Peak, LowShelf and HighShelf filters
+    ///
+    /// \return Gain, in dB
+    ///
+    ////////////////////////////////////////////////////////////
+    float getGain() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Filter a block of samples in place
+    ///
+    /// \param samples      Interleaved samples to process
+    /// \param frameCount   Number of frames in \a samples
+    /// \param channelCount Number of channels of the samples
+    /// \param sampleRate   Sample rate of the samples
+    ///
+    ////////////////////////////////////////////////////////////
+    void process(float* samples, std::size_t frameCount, unsigned int channelCount, unsigned int sampleRate) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Clear the history of the filter
+    ///
+    ////////////////////////////////////////////////////////////
+    void reset() override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the coefficients of the filter from its parameters
+    ///
+    /// \param sampleRate Sample rate of the filtered samples
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateCoefficients(unsigned int sampleRate);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief History of the filter for one channel
+    ///
+    ////////////////////////////////////////////////////////////
+    struct State
+    {
+        float z1{}; //!< First delay element
+        float z2{}; //!< Second delay element
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::atomic<Type>  m_type;             //!< Response of the filter
+    std::atomic<float> m_frequency;        //!< Cutoff or center frequency, in Hz
+    std::atomic<float> m_q;                //!< Quality factor
+    std::atomic<float> m_gain;             //!< Gain of the peak and shelf filters, in dB
+    std::atomic<bool>  m_needUpdate{true}; //!< Do the coefficients have to be computed again?
+    unsigned int       m_sampleRate{};     //!< Sample rate the coefficients were computed for
+    float              m_b0{1.f};          //!< Feedforward coefficient of the current sample
+    float              m_b1{};             //!< Feedforward coefficient of the previous sample
+    float              m_b2{};             //!< Feedforward coefficient of the sample before
+    float              m_a1{};             //!< Feedback coefficient of the previous output
+    float              m_a2{};             //!< Feedback coefficient of the output before
+    std::vector<State> m_states;           //!< History of the filter, for each channel
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::BiquadFilter
+/// \ingroup audio
+///
+/// sf::BiquadFilter implements the usual equalizer filters
+/// (from Robert Bristow-Johnson's Audio EQ Cookbook) as a
+/// sf::MixerEffect. It can filter any number of channels,
+/// and its parameters can be changed from any thread while
+/// the mixer plays.
+///
+/// Usage example:
+/// \code
+/// // Muffle the sound effects, as if heard through a wall
+/// sf::BiquadFilter muffle(sf::BiquadFilter::Type::LowPass, 800.f);
+/// mixer.addEffect(muffle);
+///
+/// // Later, open the door
+/// muffle.setFrequency(20000.f);
+/// \endcode
+///
+/// \see sf::Mixer, sf::MixerEffect, sf::Compressor
+///
+////////////////////////////////////////////////////////////
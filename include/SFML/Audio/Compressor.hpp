@@ -0,0 +1,217 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <SFML/Audio/MixerEffect.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <atomic>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Dynamic range compressor and limiter, usable as a mixer effect
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API Compressor : public MixerEffect
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the compressor
+    ///
+    /// \param threshold Level above which the signal is compressed, in dBFS
+    /// \param ratio     Compression ratio, see setRatio
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit Compressor(float threshold = -12.f, float ratio = 4.f);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the level above which the signal is compressed
+    ///
+    /// \param threshold New threshold, in dBFS (0 is the maximum level)
+    ///
+    ////////////////////////////////////////////////////////////
+    void setThreshold(float threshold);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the compression ratio
+    ///
+    /// With a ratio of 4, a signal 8 dB above the threshold
+    /// comes out 2 dB above it. A ratio of 1 disables the
+    /// compression, a very high ratio with a short attack
+    /// turns the compressor into a limiter.
+    ///
+    /// \param ratio New ratio, at least 1
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRatio(float ratio);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set how fast the compressor reacts to loud sounds
+    ///
+    /// The default attack is 5 ms.
+    ///
+    /// \param attack New attack time
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAttack(Time attack);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set how fast the compressor recovers after loud sounds
+    ///
+    /// The default release is 100 ms.
+    ///
+    /// \param release New release time
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRelease(Time release);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the gain applied after the compression
+    ///
+    /// \param gain New makeup gain, in dB
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMakeupGain(float gain);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the level above which the signal is compressed
+    ///
+    /// \return Threshold, in dBFS
+    ///
+    ////////////////////////////////////////////////////////////
+    float getThreshold() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the compression ratio
+    ///
+    /// \return Compression ratio
+    ///
+    ////////////////////////////////////////////////////////////
+    float getRatio() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the attack time
+    ///
+    /// \return Attack time
+    ///
+    ////////////////////////////////////////////////////////////
+    Time getAttack() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the release time
+    ///
+    /// \return Release time
+    ///
+    ////////////////////////////////////////////////////////////
+    Time getRelease() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the gain applied after the compression
+    ///
+    /// \return Makeup gain, in dB
+    ///
+    ////////////////////////////////////////////////////////////
+    float getMakeupGain() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current gain reduction, for metering
+    ///
+    /// \return Gain reduction at the end of the last processed block, in dB
+    ///
+    ////////////////////////////////////////////////////////////
+    float getGainReduction() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compress a block of samples in place
+    ///
+    /// \param samples      Interleaved samples to process
+    /// \param frameCount   Number of frames in \a samples
+    /// \param channelCount Number of channels of the samples
+    /// \param sampleRate   Sample rate of the samples
+    ///
+    ////////////////////////////////////////////////////////////
+    void process(float* samples, std::size_t frameCount, unsigned int channelCount, unsigned int sampleRate) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forget the level of the previous samples
+    ///
+    ////////////////////////////////////////////////////////////
+    void reset() override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::atomic<float> m_threshold;                  //!< Level above which the signal is compressed, in dBFS
+    std::atomic<float> m_ratio;                      //!< Compression ratio
+    std::atomic<Time>  m_attack{milliseconds(5)};    //!< Time to react to loud sounds
+    std::atomic<Time>  m_release{milliseconds(100)}; //!< Time to recover after loud sounds
+    std::atomic<float> m_makeupGain{};               //!< Gain applied after the compression, in dB
+    std::atomic<float> m_gainReduction{};            //!< Gain reduction at the end of the last block, in dB
+    float              m_envelope{};                 //!< Smoothed gain reduction, in dB
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::Compressor
+/// \ingroup audio
+///
+/// sf::Compressor reduces the level of the signal when it
+/// goes above a threshold, smoothing the changes with its
+/// attack and release times. All the channels are compressed
+/// together, from the loudest one, so that the stereo image
+/// doesn't move.
+///
+/// Placed at the end of a mixer's effect chain, with a high
+/// ratio and a short attack, it keeps the mix of many sounds
+/// from clipping.
+///
+/// Its parameters can be changed from any thread while the
+/// mixer plays.
+///
+/// Usage example:
+/// \code
+/// // Limit the output of the mixer to -1 dBFS
+/// sf::Compressor limiter(-1.f, 100.f);
+/// limiter.setAttack(sf::milliseconds(1));
+/// mixer.addEffect(limiter);
+/// \endcode
+///
+/// \see sf::Mixer, sf::MixerEffect, sf::BiquadFilter
+///
+////////////////////////////////////////////////////////////
@@ -68,6 +68,29 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool openFromFile(const std::filesystem::path& filename);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Open a sound file from the disk for reading, using a saved seek index
+    ///
+    /// Some formats have to scan the whole file to know its
+    /// length or to seek precisely, such as MP3 files that don't
+    /// start with a Xing/Info header. This overload skips the scan
+    /// by loading the seek index previously saved with saveSeekIndex.
+    ///
+    /// If the index file doesn't exist or doesn't match the sound
+    /// file (it was modified since), the sound file is opened as
+    /// if no index was given.
+    ///
+    /// \param filename          Path of the sound file to load
+    /// \param seekIndexFilename Path of the seek index file to load
+    ///
+    /// \return True if the file was successfully opened
+    ///
+    /// \see saveSeekIndex
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool openFromFile(const std::filesystem::path& filename,
+                                    const std::filesystem::path& seekIndexFilename);
+
     ////////////////////////////////////////////////////////////
     /// \brief Open a sound file in memory for reading
     ///
@@ -190,6 +213,43 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::uint64_t read(std::int16_t* samples, std::uint64_t maxCount);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read audio samples from the open file, as floats
+    ///
+    /// The samples are normalized to the [-1, 1] range. Files
+    /// with more than 16 bits per sample (24-bit or float WAV
+    /// and FLAC files, OGG/Vorbis files) are decoded without
+    /// going through 16-bit samples.
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t read(float* samples, std::uint64_t maxCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Save the seek index of the open file
+    ///
+    /// The frames that haven't been indexed yet are scanned first,
+    /// the current read position is not changed. Pass the saved
+    /// file to openFromFile to open the sound file instantly and
+    /// seek precisely without scanning it again.
+    ///
+    /// This function fails if no file is open, or if its format
+    /// doesn't need a seek index (WAV, OGG/Vorbis and FLAC files
+    /// can be opened and seeked without one).
+    ///
+    /// \param filename Path of the seek index file to write
+    ///
+    /// \return True if the seek index was successfully saved
+    ///
+    /// \see openFromFile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool saveSeekIndex(const std::filesystem::path& filename);
+
     ////////////////////////////////////////////////////////////
     /// \brief Close the current file
     ///
@@ -265,6 +325,9 @@ private:
 /// while (count > 0);
 /// \endcode
 ///
+/// Samples can also be read as floats in the [-1, 1] range,
+/// which keeps the precision of 24-bit and float files.
+///
 /// \see sf::SoundFileReader, sf::OutputSoundFile
 ///
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,322 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <SFML/Audio/SoundStream.hpp>
+
+#include <memory>
+#include <optional>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class MixerEffect;
+class SoundBuffer;
+
+////////////////////////////////////////////////////////////
+/// \brief Streamed audio source mixing several sounds and
+///        streams in software, through chains of effects
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API Mixer : public SoundStream
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Identifier of an input of the mixer
+    ///
+    /// Identifiers are never reused by a mixer.
+    ///
+    ////////////////////////////////////////////////////////////
+    using InputId = std::uint64_t;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the mixer
+    ///
+    /// \param channelCount Number of channels of the mix
+    /// \param sampleRate   Sample rate of the mix, in samples per second
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit Mixer(unsigned int channelCount = 2, unsigned int sampleRate = 44100);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~Mixer() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a sound buffer to play in the mix
+    ///
+    /// The sound starts playing from its beginning right away
+    /// (from the next mixed block), and is removed from the
+    /// mixer when it ends, unless it loops.
+    /// The samples of the buffer must be kept in memory (see
+    /// sf::SoundBuffer::releaseSamples), and the buffer must
+    /// stay alive as long as it is used by the mixer.
+    ///
+    /// \param buffer Sound buffer to play
+    /// \param loop   True to play the sound in loop
+    ///
+    /// \return Identifier of the new input, or std::nullopt if the buffer has no samples in memory
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<InputId> addSound(const SoundBuffer& buffer, bool loop = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a stream to play in the mix
+    ///
+    /// The mixer pulls the samples of the stream from its
+    /// current position, like sf::SoundStream does while it
+    /// plays, until the stream returns no more data. The
+    /// stream itself must not be played meanwhile, and it must
+    /// stay alive as long as it is used by the mixer.
+    /// A mixer is a stream too: adding a mixer to another one
+    /// makes a sub-mix, with its own chain of effects.
+    ///
+    /// \param stream Initialized stream to play
+    ///
+    /// \return Identifier of the new input, or std::nullopt if the stream is not initialized
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<InputId> addStream(SoundStream& stream);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove an input from the mixer
+    ///
+    /// If the mixer is playing, this function waits for the
+    /// block being mixed, so the sound buffer or stream of
+    /// the input can be destroyed as soon as it returns.
+    ///
+    /// \param id Identifier of the input to remove
+    ///
+    ////////////////////////////////////////////////////////////
+    void removeInput(InputId id);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether an input is still in the mixer
+    ///
+    /// Inputs are removed when they end, unless they loop.
+    ///
+    /// \param id Identifier of the input
+    ///
+    /// \return True if the input is still mixed
+    ///
+    ////////////////////////////////////////////////////////////
+    bool hasInput(InputId id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of inputs of the mixer
+    ///
+    /// \return Number of inputs
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getInputCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the volume of an input
+    ///
+    /// Volume changes are ramped over one block (10 ms) to
+    /// avoid clicks.
+    ///
+    /// \param id     Identifier of the input
+    /// \param volume Volume of the input, in the range [0, 100]
+    ///
+    ////////////////////////////////////////////////////////////
+    void setInputVolume(InputId id, float volume);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the stereo position of an input
+    ///
+    /// The pan only has an effect if the mixer is stereo.
+    /// Like the volume, its changes are ramped over one block.
+    ///
+    /// \param id  Identifier of the input
+    /// \param pan Position of the input, from -1 (left) to 1 (right)
+    ///
+    ////////////////////////////////////////////////////////////
+    void setInputPan(InputId id, float pan);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the pitch of an input
+    ///
+    /// The inputs are resampled to the sample rate of the mixer;
+    /// a pitch of 2 plays an input twice faster and an octave higher.
+    ///
+    /// \param id    Identifier of the input
+    /// \param pitch Pitch of the input, greater than 0
+    ///
+    ////////////////////////////////////////////////////////////
+    void setInputPitch(InputId id, float pitch);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an effect at the end of the output chain
+    ///
+    /// The effects of the output chain process the mix of all
+    /// the inputs, in the order they were added. The effect
+    /// must stay alive as long as it is used by the mixer.
+    ///
+    /// \param effect Effect to add
+    ///
+    ////////////////////////////////////////////////////////////
+    void addEffect(MixerEffect& effect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an effect at the end of the chain of an input
+    ///
+    /// The effects of an input process its samples after they
+    /// are resampled, before they are mixed. An effect object
+    /// keeps the state of a single signal, so it can't be used
+    /// in several chains at the same time.
+    ///
+    /// \param id     Identifier of the input
+    /// \param effect Effect to add
+    ///
+    ////////////////////////////////////////////////////////////
+    void addEffect(InputId id, MixerEffect& effect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove an effect from all the chains it is in
+    ///
+    /// \param effect Effect to remove
+    ///
+    ////////////////////////////////////////////////////////////
+    void removeEffect(MixerEffect& effect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mix the next samples into an array
+    ///
+    /// This is what the mixer does when it plays, it can be
+    /// called directly to mix without an audio device, for
+    /// example to render the mix to a file. It should not be
+    /// called while the mixer plays, otherwise the samples
+    /// it returns are missing from the playback.
+    ///
+    /// \param samples    Array receiving the interleaved mixed samples
+    /// \param frameCount Number of frames (samples per channel) to mix
+    ///
+    ////////////////////////////////////////////////////////////
+    void render(float* samples, std::size_t frameCount);
+
+protected:
+    ////////////////////////////////////////////////////////////
+    /// \brief Mix the next chunk of audio samples
+    ///
+    /// \param data Chunk of data to fill
+    ///
+    /// \return Always true, the mixer plays silence when it has no input
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool onGetData(Chunk& data) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the current playing position in the stream source
+    ///
+    /// A mix has no position, this function does nothing.
+    ///
+    /// \param timeOffset New playing position
+    ///
+    ////////////////////////////////////////////////////////////
+    void onSeek(Time timeOffset) override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::Mixer
+/// \ingroup audio
+///
+/// Every sf::Sound and sf::Music is played by its own OpenAL
+/// source, which leaves the mixing to the OpenAL
+/// implementation and offers no way to process the mix.
+///
+/// sf::Mixer is a sf::SoundStream that mixes its inputs in
+/// software: sounds played from sound buffers, and streams
+/// such as sf::Music. Each input is resampled to the sample
+/// rate of the mixer, goes through its own chain of effects,
+/// then is added to the mix with its volume and pan. The mix
+/// itself goes through the output chain of effects, and is
+/// played by the single OpenAL source of the mixer.
+///
+/// Effects derive from sf::MixerEffect; SFML provides
+/// sf::BiquadFilter and sf::Compressor. Since a mixer is a
+/// stream, mixers can be added to other mixers to build
+/// buses, each with its own effects.
+///
+/// The mixer works on blocks of 10 ms, with buffers allocated
+/// when the inputs are added, so that its cost only depends on
+/// the number of inputs and effects. It uses float samples
+/// internally and plays them as floats when the audio device
+/// supports it.
+///
+/// As a sf::SoundStream, the mixer mixes from its own thread
+/// while it plays; all its functions can be called from other
+/// threads meanwhile. Changing the volume, pan or pitch of an
+/// input never waits for the streams to be decoded, while
+/// adding or removing inputs and effects waits for the block
+/// being mixed. Inputs and effects can also be mixed without
+/// playing, with render().
+///
+/// Usage example:
+/// \code
+/// sf::SoundBuffer footstep, explosion;
+/// sf::Music       music;
+/// ...
+///
+/// sf::Mixer        effectsBus;
+/// sf::BiquadFilter muffle(sf::BiquadFilter::Type::LowPass, 800.f);
+/// effectsBus.addEffect(muffle);
+/// (void)effectsBus.addSound(footstep);
+/// (void)effectsBus.addSound(explosion);
+///
+/// sf::Mixer      master;
+/// sf::Compressor limiter(-1.f, 100.f);
+/// master.addEffect(limiter);
+/// (void)master.addStream(effectsBus);
+/// if (const auto id = master.addStream(music))
+///     master.setInputVolume(*id, 50.f);
+///
+/// master.play();
+/// \endcode
+///
+/// \see sf::MixerEffect, sf::SoundStream
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Abstract base class for the effects of sf::Mixer
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API MixerEffect
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Virtual destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual ~MixerEffect() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Process a block of samples in place
+    ///
+    /// This function is called by the mixer from its streaming
+    /// thread, with blocks of at most 10 ms of audio. It must
+    /// not block, and should not allocate once it has seen
+    /// the channel count it is used with.
+    ///
+    /// \param samples      Interleaved samples to process, in the [-1, 1] range
+    /// \param frameCount   Number of frames (samples per channel) in \a samples
+    /// \param channelCount Number of channels of the samples
+    /// \param sampleRate   Sample rate of the samples, in samples per second
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void process(float* samples, std::size_t frameCount, unsigned int channelCount, unsigned int sampleRate) = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Clear the internal state of the effect
+    ///
+    /// This function is called when the effect is added to a
+    /// mixer, so that no state is carried over from other sounds.
+    /// The default implementation does nothing.
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void reset()
+    {
+    }
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::MixerEffect
+/// \ingroup audio
+///
+/// sf::MixerEffect is the interface of the effects that
+/// sf::Mixer applies to its inputs or to its output.
+/// Effects work on interleaved float samples, at the
+/// sample rate of the mixer.
+///
+/// SFML provides sf::BiquadFilter and sf::Compressor, custom
+/// effects only have to override process(), and reset() if
+/// they keep some state between blocks.
+///
+/// An effect is used from the mixer's streaming thread: if
+/// the parameters of a custom effect are changed from another
+/// thread while the mixer plays, they have to be synchronized.
+/// The parameters of SFML's effects can be changed from any
+/// thread.
+///
+/// Usage example:
+/// \code
+/// class Distortion : public sf::MixerEffect
+/// {
+/// public:
+///     void process(float* samples, std::size_t frameCount, unsigned int channelCount, unsigned int) override
+///     {
+///         for (std::size_t i = 0; i < frameCount * channelCount; ++i)
+///             samples[i] = std::tanh(samples[i] * 4.f);
+///     }
+/// };
+/// \endcode
+///
+/// \see sf::Mixer
+///
+////////////////////////////////////////////////////////////
@@ -30,6 +30,7 @@
 #include <SFML/Audio/Export.hpp>
 
 #include <SFML/Audio/InputSoundFile.hpp>
+#include <SFML/Audio/SampleFormat.hpp>
 #include <SFML/Audio/SoundStream.hpp>
 
 #include <filesystem>
@@ -80,18 +81,46 @@ public:
     /// See the documentation of sf::InputSoundFile for the list
     /// of supported formats.
     ///
+    /// With sf::SampleFormat::Float32, the file is decoded and
+    /// streamed as float samples, which keeps the precision of
+    /// 24-bit and float sources.
+    ///
     /// \warning Since the music is not loaded at once but rather
     /// streamed continuously, the file must remain accessible until
     /// the sf::Music object loads a new music or is destroyed.
     ///
-    /// \param filename Path of the music file to open
+    /// \param filename     Path of the music file to open
+    /// \param sampleFormat Format of the streamed samples
     ///
     /// \return True if loading succeeded, false if it failed
     ///
     /// \see openFromMemory, openFromStream
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool openFromFile(const std::filesystem::path& filename);
+    [[nodiscard]] bool openFromFile(const std::filesystem::path& filename,
+                                    SampleFormat                 sampleFormat = SampleFormat::Int16);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open a music from an audio file, using a saved seek index
+    ///
+    /// Loading the seek index saved by saveSeekIndex avoids
+    /// scanning the whole file when opening it, and makes seeking
+    /// with setPlayingOffset instant. This matters for long MP3
+    /// files. If the index file doesn't exist or doesn't match the
+    /// music file, the music is opened as if no index was given.
+    ///
+    /// \param filename          Path of the music file to open
+    /// \param seekIndexFilename Path of the seek index file to load
+    /// \param sampleFormat      Format of the streamed samples
+    ///
+    /// \return True if loading succeeded, false if it failed
+    ///
+    /// \see saveSeekIndex, sf::InputSoundFile::openFromFile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool openFromFile(const std::filesystem::path& filename,
+                                    const std::filesystem::path& seekIndexFilename,
+                                    SampleFormat                 sampleFormat = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Open a music from an audio file in memory
@@ -106,15 +135,18 @@ public:
     /// the sf::Music object loads a new music or is destroyed. That is,
     /// you can't deallocate the buffer right after calling this function.
     ///
-    /// \param data        Pointer to the file data in memory
-    /// \param sizeInBytes Size of the data to load, in bytes
+    /// \param data         Pointer to the file data in memory
+    /// \param sizeInBytes  Size of the data to load, in bytes
+    /// \param sampleFormat Format of the streamed samples
     ///
     /// \return True if loading succeeded, false if it failed
     ///
     /// \see openFromFile, openFromStream
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool openFromMemory(const void* data, std::size_t sizeInBytes);
+    [[nodiscard]] bool openFromMemory(const void*  data,
+                                      std::size_t  sizeInBytes,
+                                      SampleFormat sampleFormat = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Open a music from an audio file in a custom stream
@@ -128,14 +160,15 @@ public:
     /// streamed continuously, the \a stream must remain accessible
     /// until the sf::Music object loads a new music or is destroyed.
     ///
-    /// \param stream Source stream to read from
+    /// \param stream       Source stream to read from
+    /// \param sampleFormat Format of the streamed samples
     ///
     /// \return True if loading succeeded, false if it failed
     ///
     /// \see openFromFile, openFromMemory
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool openFromStream(InputStream& stream);
+    [[nodiscard]] bool openFromStream(InputStream& stream, SampleFormat sampleFormat = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Get the total duration of the music
@@ -145,6 +178,26 @@ public:
     ////////////////////////////////////////////////////////////
     Time getDuration() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Save the seek index of the music
+    ///
+    /// Building the index may require scanning the whole file.
+    /// If the music was opened from a file or from memory, the
+    /// file is scanned by a separate reader on the calling
+    /// thread, so the music keeps playing meanwhile. A music
+    /// opened from a stream can only be scanned through its own
+    /// reader, which blocks the streaming until the scan is
+    /// finished: in that case it should be stopped first.
+    ///
+    /// \param filename Path of the seek index file to write
+    ///
+    /// \return True if the seek index was successfully saved
+    ///
+    /// \see openFromFile, sf::InputSoundFile::saveSeekIndex
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool saveSeekIndex(const std::filesystem::path& filename);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the positions of the of the sound's looping sequence
     ///
@@ -222,8 +275,10 @@ private:
     ////////////////////////////////////////////////////////////
     /// \brief Initialize the internal state after loading a new music
     ///
+    /// \param sampleFormat Format of the streamed samples
+    ///
     ////////////////////////////////////////////////////////////
-    void initialize();
+    void initialize(SampleFormat sampleFormat);
 
     ////////////////////////////////////////////////////////////
     /// \brief Helper to convert an sf::Time to a sample position
@@ -248,10 +303,14 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    InputSoundFile            m_file;     //!< The streamed music file
-    std::vector<std::int16_t> m_samples;  //!< Temporary buffer of samples
-    std::recursive_mutex      m_mutex;    //!< Mutex protecting the data
-    Span<std::uint64_t>       m_loopSpan; //!< Loop Range Specifier
+    InputSoundFile            m_file;         //!< The streamed music file
+    std::vector<std::int16_t> m_samples;      //!< Temporary buffer of samples
+    std::vector<float>        m_floatSamples; //!< Temporary buffer of float samples
+    std::recursive_mutex      m_mutex;        //!< Mutex protecting the data
+    Span<std::uint64_t>       m_loopSpan;     //!< Loop Range Specifier
+    std::filesystem::path     m_filename;     //!< Path of the music file, if it was opened from a file
+    const void*               m_data{};       //!< Music file in memory, if it was opened from memory
+    std::size_t               m_dataSize{};   //!< Size of the music file in memory, in bytes
 };
 
 } // namespace sf
@@ -29,6 +29,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Export.hpp>
 
+#include <SFML/Audio/SampleFormat.hpp>
 #include <SFML/Audio/SoundFileWriter.hpp>
 
 #include <filesystem>
@@ -51,14 +52,24 @@ public:
     ///
     /// The supported audio formats are: WAV, OGG/Vorbis, FLAC.
     ///
+    /// \a sampleFormat chooses the precision of the samples
+    /// stored in the file, independently of the type of the
+    /// samples passed to write. WAV files store float samples
+    /// as is, and FLAC files store them as 24-bit integers.
+    /// OGG/Vorbis files ignore it.
+    ///
     /// \param filename     Path of the sound file to write
     /// \param sampleRate   Sample rate of the sound
     /// \param channelCount Number of channels in the sound
+    /// \param sampleFormat Format of the samples stored in the file
     ///
     /// \return True if the file was successfully opened
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool openFromFile(const std::filesystem::path& filename, unsigned int sampleRate, unsigned int channelCount);
+    [[nodiscard]] bool openFromFile(const std::filesystem::path& filename,
+                                    unsigned int                 sampleRate,
+                                    unsigned int                 channelCount,
+                                    SampleFormat                 sampleFormat = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Write audio samples to the file
@@ -69,6 +80,17 @@ public:
     ////////////////////////////////////////////////////////////
     void write(const std::int16_t* samples, std::uint64_t count);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Write float audio samples to the file
+    ///
+    /// The samples are expected in the [-1, 1] range.
+    ///
+    /// \param samples     Pointer to the sample array to write
+    /// \param count       Number of samples to write
+    ///
+    ////////////////////////////////////////////////////////////
+    void write(const float* samples, std::uint64_t count);
+
     ////////////////////////////////////////////////////////////
     /// \brief Close the current file
     ///
@@ -111,6 +133,9 @@ private:
 /// }
 /// \endcode
 ///
+/// Float samples can be written too, and stored without losing
+/// precision by opening the file with sf::SampleFormat::Float32.
+///
 /// \see sf::SoundFileWriter, sf::InputSoundFile
 ///
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,44 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \ingroup audio
+/// \brief Formats of the audio samples handled by the audio module
+///
+/// 16-bit samples are always supported. 32-bit float samples
+/// are uploaded to the audio device as is when it supports
+/// them (AL_EXT_float32), and converted to 16-bit otherwise.
+///
+////////////////////////////////////////////////////////////
+enum class SampleFormat
+{
+    Int16,  //!< Signed 16-bit integer samples, in the [-32768, 32767] range
+    Float32 //!< 32-bit floating point samples, in the [-1, 1] range
+};
+
+} // namespace sf
@@ -31,12 +31,21 @@
 
 #include <SFML/Audio/SoundSource.hpp>
 
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+
+#include <limits>
+
 
 namespace sf
 {
-class Time;
 class SoundBuffer;
 
+namespace priv
+{
+class VoiceManager;
+}
+
 ////////////////////////////////////////////////////////////
 /// \brief Regular sound that can be played in the audio environment
 ///
@@ -80,6 +89,8 @@ public:
     /// was it already playing.
     /// This function uses its own thread so that it doesn't block
     /// the rest of the program while the sound is played.
+    /// The sound takes a voice from sf::VoicePool; if none is
+    /// available, it plays virtually until it gets one.
     ///
     /// \see pause, stop
     ///
@@ -187,6 +198,68 @@ public:
     ////////////////////////////////////////////////////////////
     Time getPlayingOffset() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the priority of the sound
+    ///
+    /// When there are more playing sounds than voices in
+    /// sf::VoicePool, sounds with a higher priority get a voice
+    /// first, whatever their volume. Sounds with the same priority
+    /// are ranked by their volume attenuated by the distance
+    /// to the listener.
+    /// The default priority is 0.
+    ///
+    /// \param priority New priority of the sound
+    ///
+    /// \see getPriority
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPriority(int priority);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the priority of the sound
+    ///
+    /// \return Priority of the sound
+    ///
+    /// \see setPriority
+    ///
+    ////////////////////////////////////////////////////////////
+    int getPriority() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the distance beyond which the sound is not heard
+    ///
+    /// A sound further than this distance from the listener
+    /// doesn't get a voice; it plays virtually until it comes
+    /// back in range. The default distance is infinite.
+    ///
+    /// \param distance New cull distance of the sound
+    ///
+    /// \see getCullDistance
+    ///
+    ////////////////////////////////////////////////////////////
+    void setCullDistance(float distance);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the distance beyond which the sound is not heard
+    ///
+    /// \return Cull distance of the sound
+    ///
+    /// \see setCullDistance
+    ///
+    ////////////////////////////////////////////////////////////
+    float getCullDistance() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the sound is playing without a voice
+    ///
+    /// A virtual sound keeps track of its playing position but
+    /// is not heard, until sf::VoicePool gives it a voice.
+    ///
+    /// \return True if the sound is playing virtually, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isVirtual() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the current status of the sound (stopped, paused, playing)
     ///
@@ -207,6 +280,7 @@ public:
 
 private:
     friend class SoundBuffer;
+    friend class priv::VoiceManager;
 
     ////////////////////////////////////////////////////////////
     /// \brief Detach sound from its internal buffer
@@ -226,10 +300,43 @@ private:
     ////////////////////////////////////////////////////////////
     void reattachBuffer();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Start playing on a voice given by the voice pool
+    ///
+    /// \param source OpenAL source of the voice
+    ///
+    ////////////////////////////////////////////////////////////
+    void startVoice(unsigned int source);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop playing on the current voice and give it back
+    ///
+    /// The playing position is saved so that the sound can
+    /// carry on virtually.
+    ///
+    /// \return OpenAL source of the voice
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int stopVoice();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the playing position of the sound while it has no voice
+    ///
+    /// \return Playing position, from the beginning of the sound
+    ///
+    ////////////////////////////////////////////////////////////
+    Time getVirtualOffset() const;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    const SoundBuffer* m_buffer{}; //!< Sound buffer bound to the source
+    const SoundBuffer* m_buffer{};                                             //!< Sound buffer bound to the source
+    bool               m_loop{};                                               //!< Loop the sound?
+    int                m_priority{};                                           //!< Priority in the voice pool
+    float              m_cullDistance{std::numeric_limits<float>::infinity()}; //!< Distance beyond which the sound has no voice
+    Status             m_status{Stopped};                                      //!< Status of the sound while it has no voice
+    Time               m_offset;                                               //!< Playing position when the sound lost its voice
+    Clock              m_clock;                                                //!< Time elapsed since the sound lost its voice
 };
 
 } // namespace sf
@@ -258,6 +365,12 @@ private:
 /// as long as the sound uses it. Note that multiple sounds
 /// can use the same sound buffer at the same time.
 ///
+/// A sound only holds an OpenAL source while it is playing,
+/// and gets it from a pool of voices shared by all the sounds
+/// (see sf::VoicePool), so that creating many sounds is cheap.
+/// Its priority and cull distance control which sounds are
+/// heard when there are more sounds playing than voices.
+///
 /// Usage example:
 /// \code
 /// sf::SoundBuffer buffer;
@@ -30,6 +30,7 @@
 #include <SFML/Audio/Export.hpp>
 
 #include <SFML/Audio/AlResource.hpp>
+#include <SFML/Audio/SampleFormat.hpp>
 
 #include <SFML/System/Time.hpp>
 
@@ -54,6 +55,17 @@ class InputStream;
 class SFML_AUDIO_API SoundBuffer : AlResource
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Memory used by all the live sound buffers
+    ///
+    ////////////////////////////////////////////////////////////
+    struct MemoryUsage
+    {
+        std::uint64_t sampleBytes{}; //!< Bytes of samples kept in system memory
+        std::uint64_t openAlBytes{}; //!< Bytes of samples uploaded to OpenAL
+        std::size_t   bufferCount{}; //!< Number of live sound buffers
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -78,16 +90,21 @@ public:
     /// \brief Load the sound buffer from a file
     ///
     /// See the documentation of sf::InputSoundFile for the list
-    /// of supported formats.
+    /// of supported formats. With sf::SampleFormat::Float32, the
+    /// file is decoded to float samples, which keeps the precision
+    /// of 24-bit and float sources; they are then accessed with
+    /// getFloatSamples() instead of getSamples().
     ///
-    /// \param filename Path of the sound file to load
+    /// \param filename     Path of the sound file to load
+    /// \param sampleFormat Format of the decoded samples
     ///
     /// \return True if loading succeeded, false if it failed
     ///
     /// \see loadFromMemory, loadFromStream, loadFromSamples, saveToFile
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool loadFromFile(const std::filesystem::path& filename);
+    [[nodiscard]] bool loadFromFile(const std::filesystem::path& filename,
+                                    SampleFormat                 sampleFormat = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Load the sound buffer from a file in memory
@@ -95,15 +112,18 @@ public:
     /// See the documentation of sf::InputSoundFile for the list
     /// of supported formats.
     ///
-    /// \param data        Pointer to the file data in memory
-    /// \param sizeInBytes Size of the data to load, in bytes
+    /// \param data         Pointer to the file data in memory
+    /// \param sizeInBytes  Size of the data to load, in bytes
+    /// \param sampleFormat Format of the decoded samples
     ///
     /// \return True if loading succeeded, false if it failed
     ///
     /// \see loadFromFile, loadFromStream, loadFromSamples
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool loadFromMemory(const void* data, std::size_t sizeInBytes);
+    [[nodiscard]] bool loadFromMemory(const void*  data,
+                                      std::size_t  sizeInBytes,
+                                      SampleFormat sampleFormat = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Load the sound buffer from a custom stream
@@ -111,14 +131,15 @@ public:
     /// See the documentation of sf::InputSoundFile for the list
     /// of supported formats.
     ///
-    /// \param stream Source stream to read from
+    /// \param stream       Source stream to read from
+    /// \param sampleFormat Format of the decoded samples
     ///
     /// \return True if loading succeeded, false if it failed
     ///
     /// \see loadFromFile, loadFromMemory, loadFromSamples
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool loadFromStream(InputStream& stream);
+    [[nodiscard]] bool loadFromStream(InputStream& stream, SampleFormat sampleFormat = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Load the sound buffer from an array of audio samples
@@ -140,11 +161,35 @@ public:
                                        unsigned int        channelCount,
                                        unsigned int        sampleRate);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the sound buffer from an array of float audio samples
+    ///
+    /// The samples are expected in the [-1, 1] range. They are
+    /// uploaded as float if the audio device supports it, and
+    /// converted to 16-bit otherwise. The samples kept in system
+    /// memory are accessed with getFloatSamples().
+    ///
+    /// \param samples      Pointer to the array of samples in memory
+    /// \param sampleCount  Number of samples in the array
+    /// \param channelCount Number of channels (1 = mono, 2 = stereo, ...)
+    /// \param sampleRate   Sample rate (number of samples to play per second)
+    ///
+    /// \return True if loading succeeded, false if it failed
+    ///
+    /// \see loadFromFile, loadFromMemory, saveToFile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromSamples(const float*  samples,
+                                       std::uint64_t sampleCount,
+                                       unsigned int  channelCount,
+                                       unsigned int  sampleRate);
+
     ////////////////////////////////////////////////////////////
     /// \brief Save the sound buffer to an audio file
     ///
     /// See the documentation of sf::OutputSoundFile for the list
-    /// of supported formats.
+    /// of supported formats. Buffers loaded from float samples
+    /// are saved with sf::SampleFormat::Float32.
     ///
     /// \param filename Path of the sound file to write
     ///
@@ -162,18 +207,59 @@ public:
     /// The total number of samples in this array is given by the
     /// getSampleCount() function.
     ///
+    /// \warning A buffer holds its samples in a single format,
+    /// given by getSampleFormat(). If it is
+    /// sf::SampleFormat::Float32 (the buffer was loaded from float
+    /// samples or decoded as floats), this function returns a null
+    /// pointer although getSampleCount() is not zero: the samples
+    /// must be read with getFloatSamples() instead.
+    ///
+    /// If the samples were released from system memory, this
+    /// function returns a null pointer until restoreSamples()
+    /// is called.
+    ///
     /// \return Read-only pointer to the array of sound samples
     ///
-    /// \see getSampleCount
+    /// \see getFloatSamples, getSampleFormat, getSampleCount, releaseSamples
     ///
     ////////////////////////////////////////////////////////////
     const std::int16_t* getSamples() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the array of float audio samples stored in the buffer
+    ///
+    /// This function returns a null pointer unless the format of
+    /// the buffer, given by getSampleFormat(), is
+    /// sf::SampleFormat::Float32 and the samples are still kept
+    /// in system memory.
+    ///
+    /// \return Read-only pointer to the array of float sound samples
+    ///
+    /// \see getSamples, getSampleFormat, getSampleCount
+    ///
+    ////////////////////////////////////////////////////////////
+    const float* getFloatSamples() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the format of the samples stored in the buffer
+    ///
+    /// The format tells which of getSamples() and getFloatSamples()
+    /// gives access to the samples.
+    ///
+    /// \return Format of the samples
+    ///
+    /// \see getSamples, getFloatSamples
+    ///
+    ////////////////////////////////////////////////////////////
+    SampleFormat getSampleFormat() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the number of samples stored in the buffer
     ///
     /// The array of samples can be accessed with the getSamples()
-    /// function.
+    /// or getFloatSamples() function, depending on the format of
+    /// the buffer. The count remains valid after the samples have
+    /// been released from system memory.
     ///
     /// \return Number of samples
     ///
@@ -219,6 +305,74 @@ public:
     ////////////////////////////////////////////////////////////
     Time getDuration() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable keeping the samples in system memory
+    ///
+    /// Once they are uploaded to OpenAL, the samples are only needed
+    /// by getSamples(), saveToFile() and copies of the buffer.
+    /// If keeping them is disabled, they are released after each
+    /// upload and, for buffers loaded from a file, decoded again
+    /// when they are needed. Disabling it releases the current
+    /// samples immediately.
+    ///
+    /// This is enabled by default.
+    ///
+    /// \param keep True to keep the samples, false to release them
+    ///
+    /// \see getKeepSamples, releaseSamples
+    ///
+    ////////////////////////////////////////////////////////////
+    void setKeepSamples(bool keep);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the samples are kept in system memory
+    ///
+    /// \return True if the samples are kept after upload, false otherwise
+    ///
+    /// \see setKeepSamples
+    ///
+    ////////////////////////////////////////////////////////////
+    bool getKeepSamples() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release the samples from system memory
+    ///
+    /// The sound can still be played, since OpenAL holds its own
+    /// copy of the samples, but getSamples() returns a null pointer
+    /// until restoreSamples() is called.
+    ///
+    /// \see restoreSamples, setKeepSamples
+    ///
+    ////////////////////////////////////////////////////////////
+    void releaseSamples();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bring released samples back into system memory
+    ///
+    /// The samples are decoded again from the file that the buffer
+    /// was loaded from. Buffers loaded from memory, from a stream
+    /// or from samples cannot be restored once released. Restoring
+    /// also fails if the file no longer has the sample count,
+    /// channel count and sample rate of the buffer.
+    ///
+    /// \return True if the samples are available, false otherwise
+    ///
+    /// \see releaseSamples
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool restoreSamples();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the memory used by all the live sound buffers
+    ///
+    /// This function can be called from any thread, for example
+    /// to enforce a memory budget on a cache of sound buffers.
+    ///
+    /// \return Memory usage of the sound buffers
+    ///
+    ////////////////////////////////////////////////////////////
+    static MemoryUsage getMemoryUsage();
+
     ////////////////////////////////////////////////////////////
     /// \brief Overload of assignment operator
     ///
@@ -235,12 +389,13 @@ private:
     ////////////////////////////////////////////////////////////
     /// \brief Initialize the internal state after loading a new sound
     ///
-    /// \param file Sound file providing access to the new loaded sound
+    /// \param file         Sound file providing access to the new loaded sound
+    /// \param sampleFormat Format of the decoded samples
     ///
     /// \return True on successful initialization, false on failure
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool initialize(InputSoundFile& file);
+    [[nodiscard]] bool initialize(InputSoundFile& file, SampleFormat sampleFormat);
 
     ////////////////////////////////////////////////////////////
     /// \brief Update the internal buffer with the cached audio samples
@@ -253,6 +408,42 @@ private:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool update(unsigned int channelCount, unsigned int sampleRate);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Decode the samples again from the source file
+    ///
+    /// \param samples Vector to fill with the decoded samples
+    ///
+    /// \return True on success, false if there is no source file, it can't be read or it has changed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool readSourceSamples(std::vector<std::int16_t>& samples) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Decode the float samples again from the source file
+    ///
+    /// \param samples Vector to fill with the decoded samples
+    ///
+    /// \return True on success, false if there is no source file, it can't be read or it has changed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool readSourceSamples(std::vector<float>& samples) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Decode the samples again from the source file, in the format of the buffer
+    ///
+    /// \return True on success, false if there is no source file or it can't be read
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool restoreSourceSamples();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Report the size of the samples to the memory usage totals
+    ///
+    /// \param openAlBytes Size of the samples uploaded to OpenAL, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateMemoryUsage(std::uint64_t openAlBytes);
+
     ////////////////////////////////////////////////////////////
     /// \brief Add a sound to the list of sounds that use this buffer
     ///
@@ -277,10 +468,17 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    unsigned int              m_buffer{}; //!< OpenAL buffer identifier
-    std::vector<std::int16_t> m_samples;  //!< Samples buffer
-    Time                      m_duration; //!< Sound duration
-    mutable SoundList         m_sounds;   //!< List of sounds that are using this buffer
+    unsigned int              m_buffer{};          //!< OpenAL buffer identifier
+    std::vector<std::int16_t> m_samples;           //!< Samples buffer
+    std::vector<float>        m_floatSamples;      //!< Samples buffer of buffers in float format
+    SampleFormat              m_sampleFormat{};    //!< Format of the samples
+    std::uint64_t             m_sampleCount{};     //!< Number of samples uploaded to OpenAL
+    Time                      m_duration;          //!< Sound duration
+    std::filesystem::path     m_sourceFile;        //!< File the samples were loaded from, used to restore them
+    bool                      m_keepSamples{true}; //!< Keep the samples in system memory after upload?
+    std::uint64_t             m_sampleBytes{};     //!< Size of the samples reported to the memory usage totals
+    std::uint64_t             m_openAlBytes{};     //!< Size of the OpenAL data reported to the memory usage totals
+    mutable SoundList         m_sounds;            //!< List of sounds that are using this buffer
 };
 
 } // namespace sf
@@ -302,7 +500,16 @@ private:
 /// A sound buffer can be loaded from a file (see loadFromFile()
 /// for the complete list of supported formats), from memory, from
 /// a custom stream (see sf::InputStream) or directly from an array
-/// of samples. It can also be saved back to a file.
+/// of samples. It can also be saved back to a file. Arrays of
+/// float samples keep their precision when the audio device
+/// supports float formats.
+///
+/// Once uploaded to OpenAL, the samples are kept in system memory
+/// by default, which doubles the memory used by each sound. Large
+/// or numerous sounds that don't need getSamples() can release
+/// this copy with releaseSamples() or setKeepSamples(false), and
+/// sf::SoundBuffer::getMemoryUsage() reports the memory used by
+/// all the buffers in both places.
 ///
 /// Sound buffers alone are not very useful: they hold the audio data
 /// but cannot be played. To do so, you need to use the sf::Sound class,
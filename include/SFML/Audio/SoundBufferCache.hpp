@@ -0,0 +1,243 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <filesystem>
+#include <memory>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class SoundBuffer;
+
+////////////////////////////////////////////////////////////
+/// \brief Load sound buffers in the background and share them between their users
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API SoundBufferCache
+{
+    struct Entry;
+
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Loading status of a sound buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Status
+    {
+        Loading, //!< The sound buffer is not loaded yet
+        Ready,   //!< The sound buffer is loaded and can be played
+        Failed   //!< The sound buffer could not be loaded
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Shared reference to a sound buffer of the cache
+    ///
+    /// The sound buffer is destroyed with the last handle that
+    /// refers to it, so the handles must outlive the sf::Sound
+    /// instances that play it.
+    ///
+    ////////////////////////////////////////////////////////////
+    class SFML_AUDIO_API Handle
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// Creates a handle that doesn't refer to any sound buffer.
+        ///
+        ////////////////////////////////////////////////////////////
+        Handle() = default;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the loading status of the sound buffer
+        ///
+        /// \return Status of the sound buffer, Failed if the handle is empty
+        ///
+        ////////////////////////////////////////////////////////////
+        Status getStatus() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Wait until the sound buffer is loaded or failed to load
+        ///
+        /// \return Final status of the sound buffer
+        ///
+        ////////////////////////////////////////////////////////////
+        Status wait() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the sound buffer
+        ///
+        /// This function doesn't wait for the sound buffer to be loaded.
+        ///
+        /// \return Pointer to the sound buffer, or a null pointer if it is not ready
+        ///
+        ////////////////////////////////////////////////////////////
+        const SoundBuffer* get() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Tell whether the handle refers to a sound buffer
+        ///
+        /// \return True if the handle is not empty
+        ///
+        ////////////////////////////////////////////////////////////
+        explicit operator bool() const;
+
+    private:
+        friend class SoundBufferCache;
+
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        std::shared_ptr<const Entry> m_entry; //!< Shared state of the sound buffer
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a cache
+    ///
+    /// \param threadCount Maximum number of sound buffers loaded in parallel
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SoundBufferCache(std::size_t threadCount = 2);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// The sound buffers that no thread has started loading
+    /// fail, the other ones are waited for. Handles remain
+    /// valid after the cache is destroyed.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~SoundBufferCache();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundBufferCache(const SoundBufferCache&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundBufferCache& operator=(const SoundBufferCache&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a sound buffer from a file in the background
+    ///
+    /// If the same file is already loaded or being loaded,
+    /// a handle to the existing sound buffer is returned.
+    ///
+    /// \param filename Path of the sound file to load
+    ///
+    /// \return Handle to the sound buffer
+    ///
+    /// \see loadFromMemory
+    ///
+    ////////////////////////////////////////////////////////////
+    Handle loadFromFile(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a sound buffer from a file in memory in the background
+    ///
+    /// The data is copied, so it can be released as soon as
+    /// this function returns. The copy itself is released
+    /// once it is decoded. Identical contents share the same
+    /// sound buffer; they are recognized by two independent
+    /// 64-bit hashes of the data.
+    ///
+    /// \param data        Pointer to the file data in memory
+    /// \param sizeInBytes Size of the data to load, in bytes
+    ///
+    /// \return Handle to the sound buffer
+    ///
+    /// \see loadFromFile
+    ///
+    ////////////////////////////////////////////////////////////
+    Handle loadFromMemory(const void* data, std::size_t sizeInBytes);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of sound buffers referred to by at least one handle
+    ///
+    /// \return Number of live sound buffers
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getBufferCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SoundBufferCache
+/// \ingroup audio
+///
+/// Decoding a sound file can take a while, and loading the
+/// same file twice with sf::SoundBuffer::loadFromFile decodes
+/// it twice into two independent buffers.
+///
+/// sf::SoundBufferCache decodes the files on background
+/// threads and returns handles that become playable once
+/// the decoding is finished. Files are identified by their
+/// path and files in memory by their contents:
+/// all the requests for the same sound share the same
+/// sf::SoundBuffer, which is destroyed with its last handle.
+///
+/// Usage example:
+/// \code
+/// sf::SoundBufferCache cache;
+///
+/// // Both handles refer to the same sound buffer
+/// const sf::SoundBufferCache::Handle explosion = cache.loadFromFile("explosion.ogg");
+/// const sf::SoundBufferCache::Handle other     = cache.loadFromFile("explosion.ogg");
+///
+/// // The sound must be destroyed before the last handle
+/// std::optional<sf::Sound> sound;
+///
+/// // Later, once it is loaded...
+/// if (!sound && (explosion.getStatus() == sf::SoundBufferCache::Status::Ready))
+/// {
+///     sound.emplace(*explosion.get());
+///     sound->play();
+/// }
+/// \endcode
+///
+/// \see sf::SoundBuffer, sf::Sound
+///
+////////////////////////////////////////////////////////////
@@ -30,6 +30,7 @@
 #include <SFML/Audio/Export.hpp>
 
 #include <optional>
+#include <vector>
 
 #include <cstdint>
 
@@ -101,6 +102,60 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] virtual std::uint64_t read(std::int16_t* samples, std::uint64_t maxCount) = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read audio samples from the open file, as floats
+    ///
+    /// The samples are normalized to the [-1, 1] range.
+    /// Readers of formats that store more than 16 bits per sample
+    /// should override this function, so that the extra precision
+    /// is not lost. The default implementation reads 16-bit samples
+    /// with read and converts them.
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual std::uint64_t readFloat(float* samples, std::uint64_t maxCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Provide the seek index to use when opening the file
+    ///
+    /// Some formats have to scan the whole file to know its length
+    /// or to seek precisely. Readers of such formats can skip the
+    /// scan if they are given the index previously returned by
+    /// getSeekIndex for the same file. This function is called
+    /// before open, and an index that doesn't match the file must
+    /// be ignored.
+    ///
+    /// The default implementation ignores the index.
+    ///
+    /// \param index Seek index previously returned by getSeekIndex
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void setSeekIndex(std::vector<std::uint8_t> /* index */)
+    {
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Build the complete seek index of the open file
+    ///
+    /// The returned index can be saved and given back to
+    /// setSeekIndex the next time the file is opened.
+    /// This function must not change the current read position.
+    ///
+    /// The default implementation returns std::nullopt, for
+    /// formats that don't need a seek index.
+    ///
+    /// \return Seek index of the file, or std::nullopt if the format doesn't use one
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual std::optional<std::vector<std::uint8_t>> getSeekIndex()
+    {
+        return std::nullopt;
+    }
 };
 
 } // namespace sf
@@ -116,7 +171,12 @@ public:
 ///
 /// A valid sound file reader must override the open, seek and write functions,
 /// as well as providing a static check function; the latter is used by
-/// SFML to find a suitable writer for a given input file.
+/// SFML to find a suitable writer for a given input file. Readers
+/// of formats that are slow to open or to seek can also override
+/// setSeekIndex and getSeekIndex, so that applications can save
+/// the result of the scan and skip it the next time. Readers of
+/// formats with more than 16 bits per sample can override readFloat
+/// to provide float samples without losing precision.
 ///
 /// To register a new reader, use the sf::SoundFileFactory::registerReader
 /// template function.
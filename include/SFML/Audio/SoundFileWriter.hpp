@@ -29,8 +29,12 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Export.hpp>
 
+#include <SFML/Audio/SampleFormat.hpp>
+
 #include <filesystem>
 
+#include <cstdint>
+
 
 namespace sf
 {
@@ -47,6 +51,21 @@ public:
     ////////////////////////////////////////////////////////////
     virtual ~SoundFileWriter() = default;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Choose the format of the samples stored in the file
+    ///
+    /// This function is called before open. Writers of formats
+    /// that can store more than 16 bits per sample should honor
+    /// it; the default implementation ignores it and the file
+    /// gets 16-bit samples.
+    ///
+    /// \param sampleFormat Format of the samples to store
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void setSampleFormat(SampleFormat /* sampleFormat */)
+    {
+    }
+
     ////////////////////////////////////////////////////////////
     /// \brief Open a sound file for writing
     ///
@@ -69,6 +88,19 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     virtual void write(const std::int16_t* samples, std::uint64_t count) = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write float audio samples to the open file
+    ///
+    /// The samples are expected in the [-1, 1] range; values
+    /// outside of it are clamped. The default implementation
+    /// converts the samples to 16-bit and passes them to write.
+    ///
+    /// \param samples Pointer to the sample array to write
+    /// \param count   Number of samples to write
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void writeFloat(const float* samples, std::uint64_t count);
 };
 
 } // namespace sf
@@ -84,7 +116,9 @@ public:
 ///
 /// A valid sound file writer must override the open and write functions,
 /// as well as providing a static check function; the latter is used by
-/// SFML to find a suitable writer for a given filename.
+/// SFML to find a suitable writer for a given filename. Writers of
+/// formats that can store float or 24-bit samples can also override
+/// setSampleFormat and writeFloat.
 ///
 /// To register a new writer, use the sf::SoundFileFactory::registerWriter
 /// template function.
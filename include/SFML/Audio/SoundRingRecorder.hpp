@@ -0,0 +1,234 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <SFML/Audio/SoundRecorder.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <memory>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+namespace priv
+{
+class SampleRing;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Specialized SoundRecorder which stores the captured
+///        audio data into a lock-free ring buffer, for another
+///        thread to read
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API SoundRingRecorder : public SoundRecorder
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The default processing interval of a ring recorder is 5 ms
+    /// and its default buffer duration is 200 ms.
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundRingRecorder();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~SoundRingRecorder() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the duration of audio that the ring buffer can hold
+    ///
+    /// The ring buffer is allocated when the capture starts, its
+    /// capacity is rounded up to the next power of two samples.
+    /// If the consumer doesn't read the samples fast enough,
+    /// the samples captured while the buffer is full are dropped
+    /// and an overrun is counted.
+    /// The new duration is used the next time the capture starts.
+    ///
+    /// \param duration Duration of audio that the buffer can hold
+    ///
+    /// \see getBufferDuration
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBufferDuration(Time duration);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the duration of audio that the ring buffer can hold
+    ///
+    /// \return Duration of audio that the buffer can hold
+    ///
+    /// \see setBufferDuration
+    ///
+    ////////////////////////////////////////////////////////////
+    Time getBufferDuration() const;
+
+    using SoundRecorder::setProcessingInterval;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read captured samples from the ring buffer
+    ///
+    /// This function can be called from any thread while the
+    /// capture runs, as long as there is only one reading thread.
+    /// It never blocks: it copies as many samples as are
+    /// available, up to \a maxCount, and always a whole number
+    /// of frames (i.e. a multiple of the channel count).
+    /// If less than \a maxCount samples could be read, an
+    /// underrun is counted.
+    /// The samples left in the buffer when the capture stops
+    /// can still be read after stop() returns.
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t read(std::int16_t* samples, std::size_t maxCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of samples waiting in the ring buffer
+    ///
+    /// \return Number of samples which can be read without underrun
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getAvailableSamples() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of overruns since the capture started
+    ///
+    /// An overrun happens when the ring buffer is full and
+    /// captured samples have to be dropped.
+    ///
+    /// \return Number of overruns
+    ///
+    ////////////////////////////////////////////////////////////
+    std::uint64_t getOverrunCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of underruns since the capture started
+    ///
+    /// An underrun happens when read() cannot provide as many
+    /// samples as requested.
+    ///
+    /// \return Number of underruns
+    ///
+    ////////////////////////////////////////////////////////////
+    std::uint64_t getUnderrunCount() const;
+
+protected:
+    ////////////////////////////////////////////////////////////
+    /// \brief Start capturing audio data
+    ///
+    /// \return True to start the capture, or false to abort it
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool onStart() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Process a new chunk of recorded samples
+    ///
+    /// \param samples     Pointer to the new chunk of recorded samples
+    /// \param sampleCount Number of samples pointed by \a samples
+    ///
+    /// \return True to continue the capture, or false to stop it
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool onProcessSamples(const std::int16_t* samples, std::size_t sampleCount) override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::unique_ptr<priv::SampleRing> m_ring;                              //!< Ring buffer read by the reading thread
+    Time                              m_bufferDuration{milliseconds(200)}; //!< Duration of audio that the ring can hold
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SoundRingRecorder
+/// \ingroup audio
+///
+/// sf::SoundRingRecorder is meant for low latency capture,
+/// for example voice chat. Instead of notifying a derived
+/// class, it writes the captured samples into a preallocated
+/// single-producer/single-consumer ring buffer, and the
+/// application pulls them with read() from its own thread,
+/// at its own pace.
+///
+/// Once the capture has started, neither the capture thread
+/// nor read() allocates memory or takes a lock. The capture
+/// thread checks for new samples every 5 ms by default; the
+/// interval can be changed with setProcessingInterval().
+///
+/// The ring buffer has a fixed size, chosen with
+/// setBufferDuration() before the capture starts. When the
+/// reader falls behind and the buffer fills up, the newest
+/// samples are dropped and getOverrunCount() increases. When
+/// read() is asked for more samples than were captured,
+/// getUnderrunCount() increases. Both counters are reset
+/// when the capture starts.
+///
+/// As usual, don't forget to call the isAvailable() function
+/// before using this class (see sf::SoundRecorder for more details
+/// about this).
+///
+/// Usage example:
+/// \code
+/// sf::SoundRingRecorder recorder;
+/// recorder.setProcessingInterval(sf::milliseconds(2));
+/// recorder.setBufferDuration(sf::milliseconds(100));
+/// if (!recorder.start(48000))
+/// {
+///     // Handle error...
+/// }
+///
+/// // In the network thread, every 10 ms
+/// std::array<std::int16_t, 480> frame;
+/// const std::size_t count = recorder.read(frame.data(), frame.size());
+/// sendVoicePacket(frame.data(), count);
+///
+/// ...
+/// recorder.stop();
+/// \endcode
+///
+/// \see sf::SoundRecorder, sf::SoundBufferRecorder
+///
+////////////////////////////////////////////////////////////
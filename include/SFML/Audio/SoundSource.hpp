@@ -283,14 +283,45 @@ protected:
     /// \brief Default constructor
     ///
     /// This constructor is meant to be called by derived classes only.
+    /// The sound source is created without an OpenAL source: derived
+    /// classes either create a dedicated one with createSource(), or
+    /// borrow one from a pool while they are playing.
     ///
     ////////////////////////////////////////////////////////////
     SoundSource();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a dedicated OpenAL source for the sound
+    ///
+    /// The source is kept until the sound source is destroyed.
+    ///
+    ////////////////////////////////////////////////////////////
+    void createSource();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Apply the sound attributes to the current OpenAL source
+    ///
+    /// This must be called whenever a new OpenAL source is
+    /// assigned to m_source.
+    ///
+    ////////////////////////////////////////////////////////////
+    void applyProperties();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int m_source{}; //!< OpenAL source identifier, 0 if the sound currently has none
+
+private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    unsigned int m_source{}; //!< OpenAL source identifier
+    float    m_pitch{1.f};       //!< Pitch of the sound
+    float    m_volume{100.f};    //!< Volume of the sound, in the range [0, 100]
+    Vector3f m_position;         //!< 3D position of the sound in the audio scene
+    bool     m_relative{};       //!< Is the position relative to the listener?
+    float    m_minDistance{1.f}; //!< Minimum distance of the sound
+    float    m_attenuation{1.f}; //!< Attenuation factor of the sound
 };
 
 // NOLINTEND(readability-make-member-function-const)
@@ -308,6 +339,8 @@ protected:
 /// It defines several properties for the sound: pitch,
 /// volume, position, attenuation, etc. All of them can be
 /// changed at any time with no impact on performances.
+/// They are stored by the sound source itself, so that they
+/// survive while the sound has no OpenAL source (see sf::VoicePool).
 ///
 /// \see sf::Sound, sf::SoundStream
 ///
@@ -29,12 +29,14 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Export.hpp>
 
+#include <SFML/Audio/SampleFormat.hpp>
 #include <SFML/Audio/SoundSource.hpp>
 
 #include <SFML/System/Time.hpp>
 
 #include <mutex>
 #include <thread>
+#include <vector>
 
 #include <cstddef>
 #include <cstdint>
@@ -55,8 +57,9 @@ public:
     ////////////////////////////////////////////////////////////
     struct Chunk
     {
-        const std::int16_t* samples;     //!< Pointer to the audio samples
-        std::size_t         sampleCount; //!< Number of samples pointed by Samples
+        const std::int16_t* samples;        //!< Pointer to the audio samples
+        std::size_t         sampleCount;    //!< Number of samples pointed by Samples
+        const float*        floatSamples{}; //!< Pointer to the audio samples of streams that provide floats
     };
 
     ////////////////////////////////////////////////////////////
@@ -123,6 +126,14 @@ public:
     ////////////////////////////////////////////////////////////
     unsigned int getSampleRate() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the format of the samples provided by the stream
+    ///
+    /// \return Format of the samples
+    ///
+    ////////////////////////////////////////////////////////////
+    SampleFormat getSampleFormat() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the current status of the stream (stopped, paused, playing)
     ///
@@ -193,7 +204,7 @@ protected:
     /// This constructor is only meant to be called by derived classes.
     ///
     ////////////////////////////////////////////////////////////
-    SoundStream() = default;
+    SoundStream();
 
     ////////////////////////////////////////////////////////////
     /// \brief Define the audio stream parameters
@@ -205,11 +216,19 @@ protected:
     /// It can be called multiple times if the settings of the
     /// audio stream change, but only when the stream is stopped.
     ///
+    /// Streams initialized with sf::SampleFormat::Float32 provide
+    /// their samples through Chunk::floatSamples. They are played
+    /// as is if the audio device supports float samples, and
+    /// converted to 16-bit otherwise.
+    ///
     /// \param channelCount Number of channels of the stream
     /// \param sampleRate   Sample rate, in samples per second
+    /// \param sampleFormat Format of the samples provided by onGetData
     ///
     ////////////////////////////////////////////////////////////
-    void initialize(unsigned int channelCount, unsigned int sampleRate);
+    void initialize(unsigned int channelCount,
+                    unsigned int sampleRate,
+                    SampleFormat sampleFormat = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Request a new chunk of audio samples from the stream source
@@ -268,6 +287,8 @@ protected:
     void setProcessingInterval(Time interval);
 
 private:
+    friend class Mixer;
+
     ////////////////////////////////////////////////////////////
     /// \brief Function called as the entry point of the thread
     ///
@@ -346,6 +367,9 @@ private:
     unsigned int                 m_channelCount{};            //!< Number of channels (1 = mono, 2 = stereo, ...)
     unsigned int                 m_sampleRate{};              //!< Frequency (samples / second)
     std::int32_t                 m_format{};                  //!< Format of the internal sound buffers
+    SampleFormat                 m_sampleFormat{};            //!< Format of the samples provided by onGetData
+    bool                         m_convertSamples{};          //!< Convert float samples to 16-bit before upload?
+    std::vector<std::int16_t>    m_convertedSamples;          //!< Conversion buffer for float samples
     bool                         m_loop{};                    //!< Loop flag (true to loop, false to play once)
     std::uint64_t                m_samplesProcessed{}; //!< Number of samples processed since beginning of the stream
     std::int64_t                 m_bufferSeeks[BufferCount]{}; //!< If buffer is an "end buffer", holds next seek position, else NoLoop. For play offset calculation.
@@ -380,6 +404,10 @@ private:
 /// \li onGetData fills a new chunk of audio data to be played
 /// \li onSeek changes the current playing position in the source
 ///
+/// Streams that produce float samples, for example the output of a
+/// DSP chain, can pass sf::SampleFormat::Float32 to initialize and
+/// fill Chunk::floatSamples instead of Chunk::samples.
+///
 /// It is important to note that each SoundStream is played in its
 /// own separate thread, so that the streaming loop doesn't block the
 /// rest of the program. In particular, the OnGetData and OnSeek
@@ -0,0 +1,155 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Pool of OpenAL sources shared by all the sounds
+///
+////////////////////////////////////////////////////////////
+namespace sf::VoicePool
+{
+////////////////////////////////////////////////////////////
+/// \brief Counters describing the state of the pool
+///
+////////////////////////////////////////////////////////////
+struct Statistics
+{
+    std::size_t   activeVoices{};  //!< Number of sounds that currently hold a voice
+    std::size_t   virtualVoices{}; //!< Number of playing sounds that are waiting for a voice
+    std::size_t   sourceCount{};   //!< Number of OpenAL sources created by the pool
+    std::uint64_t stolenVoices{};  //!< Number of voices taken from a playing sound so far
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Change the maximum number of voices
+///
+/// Each voice is an OpenAL source, so the maximum must stay
+/// below the number of sources supported by the implementation
+/// minus the ones used by streams (sf::Music and other
+/// sf::SoundStream instances keep their own source).
+/// If the pool already holds more voices, the least audible
+/// sounds lose theirs.
+/// The default maximum is 64.
+///
+/// Like update(), this function must be called from the
+/// thread that uses the sounds.
+///
+/// \param count New maximum number of voices
+///
+/// \see getMaxVoices
+///
+////////////////////////////////////////////////////////////
+SFML_AUDIO_API void setMaxVoices(std::size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the maximum number of voices
+///
+/// \return Maximum number of voices
+///
+/// \see setMaxVoices
+///
+////////////////////////////////////////////////////////////
+SFML_AUDIO_API std::size_t getMaxVoices();
+
+////////////////////////////////////////////////////////////
+/// \brief Redistribute the voices among the playing sounds
+///
+/// This function takes the voices back from the sounds that
+/// have finished or moved beyond their cull distance, and gives
+/// them to the most audible virtual sounds, stealing voices
+/// from less audible sounds if needed.
+/// It should be called regularly, typically once per frame
+/// after the sounds and the listener have been moved.
+///
+/// \warning Moving a voice changes the state of the sounds
+/// involved, which are not protected against concurrent
+/// access. This function must be called from the thread
+/// that uses the sounds.
+///
+////////////////////////////////////////////////////////////
+SFML_AUDIO_API void update();
+
+////////////////////////////////////////////////////////////
+/// \brief Get the current counters of the pool
+///
+/// \return Statistics of the pool
+///
+////////////////////////////////////////////////////////////
+SFML_AUDIO_API Statistics getStatistics();
+} // namespace sf::VoicePool
+
+
+////////////////////////////////////////////////////////////
+/// \namespace sf::VoicePool
+/// \ingroup audio
+///
+/// OpenAL implementations support a limited number of
+/// sources (often 256), and creating them is not free.
+/// Instead of holding an OpenAL source for its whole
+/// lifetime, a sf::Sound borrows one of the voices of this
+/// pool when it starts playing, and gives it back when it
+/// is paused, stopped or reaches its end.
+///
+/// When all the voices are in use, a sound that starts
+/// playing takes the voice of the least audible sound,
+/// if it is itself more audible. Sounds are ranked by
+/// their priority (see sf::Sound::setPriority), then by
+/// their volume attenuated by the distance to the listener.
+/// A sound without a voice becomes virtual: it keeps
+/// track of its playing position and gets a voice back as
+/// soon as one is available. Sounds beyond their cull
+/// distance (see sf::Sound::setCullDistance) never get a
+/// voice.
+///
+/// A sound that starts playing may take the voice of another
+/// sound, and update() moves voices between sounds. Since
+/// sf::Sound is not thread-safe, all the sounds, update() and
+/// setMaxVoices() must be used from the same thread.
+/// getStatistics() can be called from any thread.
+///
+/// Usage example:
+/// \code
+/// sf::VoicePool::setMaxVoices(32);
+///
+/// while (window.isOpen())
+/// {
+///     // Move the sounds and the listener...
+///
+///     sf::VoicePool::update();
+/// }
+/// \endcode
+///
+/// \see sf::Sound, sf::Listener
+///
+////////////////////////////////////////////////////////////
@@ -48,6 +48,7 @@
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/StencilMode.hpp>
 #include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/TextBatch.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/Transform.hpp>
 #include <SFML/Graphics/Transformable.hpp>
@@ -35,8 +35,10 @@
 
 #include <SFML/System/Vector2.hpp>
 
+#include <array>
 #include <filesystem>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -55,6 +57,8 @@ class ResourceStream;
 namespace sf
 {
 class InputStream;
+class Shader;
+class String;
 
 ////////////////////////////////////////////////////////////
 /// \brief Class for loading and manipulating character fonts
@@ -137,6 +141,91 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool loadFromStream(InputStream& stream);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a pre-rasterized font atlas from a file
+    ///
+    /// The file must have been created by saveAtlasToFile or
+    /// saveAtlasToMemory. No rasterization happens when loading
+    /// an atlas: the glyph pages, glyph metrics, kerning pairs and
+    /// line metrics are restored exactly as they were saved.
+    ///
+    /// A font loaded from an atlas only knows the glyphs and
+    /// character sizes that were cached when it was saved.
+    /// Requesting anything else returns an empty glyph, and
+    /// metrics of unknown character sizes are 0.
+    ///
+    /// \param filename Path of the atlas file to load
+    ///
+    /// \return True if loading succeeded, false if it failed
+    ///
+    /// \see loadAtlasFromMemory, loadAtlasFromStream, saveAtlasToFile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadAtlasFromFile(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a pre-rasterized font atlas from a file in memory
+    ///
+    /// See loadAtlasFromFile for details. Unlike loadFromMemory,
+    /// the buffer is fully read by this function and doesn't have
+    /// to remain valid afterwards.
+    ///
+    /// \param data        Pointer to the file data in memory
+    /// \param sizeInBytes Size of the data to load, in bytes
+    ///
+    /// \return True if loading succeeded, false if it failed
+    ///
+    /// \see loadAtlasFromFile, loadAtlasFromStream, saveAtlasToMemory
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadAtlasFromMemory(const void* data, std::size_t sizeInBytes);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a pre-rasterized font atlas from a custom stream
+    ///
+    /// See loadAtlasFromFile for details. The stream is fully
+    /// read by this function and doesn't have to remain valid
+    /// afterwards.
+    ///
+    /// \param stream Source stream to read from
+    ///
+    /// \return True if loading succeeded, false if it failed
+    ///
+    /// \see loadAtlasFromFile, loadAtlasFromMemory
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadAtlasFromStream(InputStream& stream);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Save the glyphs cached so far to an atlas file
+    ///
+    /// Every page that has been populated (one per character size)
+    /// is written along with the metrics of its glyphs, the kerning
+    /// pairs between them and the line metrics of its character size.
+    /// Request the glyphs you need with getGlyph before saving.
+    ///
+    /// \param filename Path of the file to save
+    ///
+    /// \return True if saving was successful
+    ///
+    /// \see saveAtlasToMemory, loadAtlasFromFile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool saveAtlasToFile(const std::filesystem::path& filename) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Save the glyphs cached so far to an atlas in memory
+    ///
+    /// See saveAtlasToFile for details.
+    ///
+    /// \return Buffer containing the atlas data if successful,
+    ///         otherwise std::nullopt
+    ///
+    /// \see saveAtlasToFile, loadAtlasFromMemory
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<std::vector<std::uint8_t>> saveAtlasToMemory() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the font information
     ///
@@ -187,6 +276,63 @@ public:
     ////////////////////////////////////////////////////////////
     bool hasGlyph(std::uint32_t codePoint) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Rasterize a set of glyphs ahead of time, on several threads
+    ///
+    /// Glyphs are normally rasterized the first time they are
+    /// requested with \ref getGlyph, which can cause frame hitches
+    /// when a lot of new characters show up at once (e.g. when
+    /// a CJK dialog is opened). This function rasterizes all the
+    /// requested glyphs on worker threads, each with its own
+    /// FreeType face, then packs them into the glyph pages and
+    /// uploads every modified page texture only once. It returns
+    /// once all the glyphs are cached.
+    ///
+    /// Glyphs that are already cached are skipped. If distance
+    /// field rendering is enabled, the glyphs are rasterized once
+    /// for all sizes and styles, so  characterSizes,  bold and
+    ///  outlineThickness are ignored.
+    ///
+    /// \param characters       Characters to rasterize
+    /// \param characterSizes   Character sizes to rasterize the characters at
+    /// \param bold             Rasterize the bold versions or the regular ones?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyphs will not be filled)
+    /// \param threadCount      Number of threads to use, 0 to use one per hardware thread
+    ///
+    /// \return True if the glyphs were rasterized, false if no font face is loaded
+    ///
+    /// \see getGlyph
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool preload(const String&                    characters,
+                               const std::vector<unsigned int>& characterSizes,
+                               bool                             bold             = false,
+                               float                            outlineThickness = 0,
+                               unsigned int                     threadCount      = 0) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rasterize a range of code points ahead of time, on several threads
+    ///
+    /// This overload preloads all the code points from \a first to
+    /// \a last, both included.
+    ///
+    /// \param first            First code point to rasterize
+    /// \param last             Last code point to rasterize
+    /// \param characterSizes   Character sizes to rasterize the characters at
+    /// \param bold             Rasterize the bold versions or the regular ones?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyphs will not be filled)
+    /// \param threadCount      Number of threads to use, 0 to use one per hardware thread
+    ///
+    /// \return True if the glyphs were rasterized, false if no font face is loaded
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool preload(std::uint32_t                    first,
+                               std::uint32_t                    last,
+                               const std::vector<unsigned int>& characterSizes,
+                               bool                             bold             = false,
+                               float                            outlineThickness = 0,
+                               unsigned int                     threadCount      = 0) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the kerning offset of two glyphs
     ///
@@ -287,6 +433,39 @@ public:
     ////////////////////////////////////////////////////////////
     bool isSmooth() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable signed distance field rendering
+    ///
+    /// In distance field mode, each glyph is rasterized only once,
+    /// at a fixed reference size, into a signed distance field.
+    /// The resulting texture is shared by all character sizes,
+    /// outline thicknesses and bold styles, and sf::Text renders
+    /// it with a built-in shader so that text stays sharp when it
+    /// is scaled or zoomed, without rasterizing new glyphs.
+    ///
+    /// Outlines thicker than a quarter of the character size are
+    /// clipped. Distance field rendering requires a scalable font
+    /// and shader support (see sf::Shader::isAvailable). Changing
+    /// the mode discards all the glyphs loaded so far.
+    /// Distance field rendering is disabled by default.
+    ///
+    /// \param enabled True to enable distance field rendering, false to disable it
+    ///
+    /// \see isDistanceFieldEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDistanceFieldEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether signed distance field rendering is enabled or not
+    ///
+    /// \return True if distance field rendering is enabled, false if it is disabled
+    ///
+    /// \see setDistanceFieldEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isDistanceFieldEnabled() const;
+
 private:
     ////////////////////////////////////////////////////////////
     /// \brief Structure defining a row of glyphs
@@ -308,6 +487,51 @@ private:
     ////////////////////////////////////////////////////////////
     using GlyphTable = std::unordered_map<std::uint64_t, Glyph>; //!< Table mapping a codepoint to its glyph
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Direct access to the cached glyphs of the first code points
+    ///
+    /// Avoids the character map lookup and the hashing of
+    /// \ref getGlyph for the Basic Latin and Latin-1 characters.
+    /// Only the outlined glyphs of the last outline thickness
+    /// requested are referenced.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct GlyphLookup
+    {
+        GlyphLookup() = default;
+
+        // Copies start empty, the slots point into the glyph table of the original
+        GlyphLookup(const GlyphLookup&)
+        {
+        }
+
+        GlyphLookup& operator=(const GlyphLookup&)
+        {
+            glyphs.fill(nullptr);
+            return *this;
+        }
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the slot referencing a glyph
+        ///
+        /// Requesting an outlined glyph of a new thickness clears
+        /// the outlined slots.
+        ///
+        /// \param codePoint Unicode code point of the character
+        /// \param bold      Bold version or regular one?
+        /// \param thickness Thickness of outline
+        ///
+        /// \return Pointer to the slot, or null if \a codePoint is not covered
+        ///
+        ////////////////////////////////////////////////////////////
+        const Glyph** findSlot(std::uint32_t codePoint, bool bold, float thickness);
+
+        static constexpr std::uint32_t size{256}; //!< Number of code points covered
+
+        std::array<const Glyph*, size * 4> glyphs{};           //!< Regular, bold, outlined and bold outlined glyphs
+        float                              outlineThickness{}; //!< Outline thickness of the outlined glyphs
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Structure defining a page of glyphs
     ///
@@ -317,6 +541,7 @@ private:
         explicit Page(bool smooth);
 
         GlyphTable       glyphs;     //!< Table mapping code points to their corresponding glyph
+        GlyphLookup      lookup;     //!< Direct access to the glyphs of the first code points
         Texture          texture;    //!< Texture containing the pixels of the glyphs
         unsigned int     nextRow{3}; //!< Y position of the next new row in the texture
         std::vector<Row> rows;       //!< List containing the position of all the existing rows
@@ -351,6 +576,48 @@ private:
     ////////////////////////////////////////////////////////////
     Glyph loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a new distance field glyph and store it in the cache
+    ///
+    /// The glyph is rasterized at the distance field reference
+    /// size, regardless of the size it will be displayed at.
+    ///
+    /// \param codePoint Unicode code point of the character to load
+    ///
+    /// \return The glyph corresponding to \a codePoint at the reference size
+    ///
+    ////////////////////////////////////////////////////////////
+    Glyph loadDistanceFieldGlyph(std::uint32_t codePoint) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the room around distance field glyphs
+    ///
+    /// Distance field glyphs must be rendered with this padding
+    /// around their bounds so that they can be outlined and
+    /// emboldened.
+    ///
+    /// \param characterSize Reference character size
+    ///
+    /// \return Padding around the glyphs, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    float getDistanceFieldPadding(unsigned int characterSize) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the shader that renders distance field glyphs
+    ///
+    /// The shader is created on first use and configured to render
+    /// glyphs of the given size, boldness and outline thickness.
+    ///
+    /// \param characterSize    Reference character size
+    /// \param bold             Render the bold version or the regular one?
+    /// \param outlineThickness Thickness of outline to render (0 to render the fill)
+    ///
+    /// \return The distance field shader, or a null pointer if shaders are not available
+    ///
+    ////////////////////////////////////////////////////////////
+    const Shader* getDistanceFieldShader(unsigned int characterSize, bool bold, float outlineThickness) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Find a suitable rectangle within the texture for a glyph
     ///
@@ -372,19 +639,64 @@ private:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool setCurrentSize(unsigned int characterSize) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the font glyph index of a code point
+    ///
+    /// \param codePoint Unicode code point of the character
+    ///
+    /// \return Glyph index, or 0 if the font has no glyph for \a codePoint
+    ///
+    ////////////////////////////////////////////////////////////
+    std::uint32_t getCharIndex(std::uint32_t codePoint) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the kerning offset of a pair of characters
+    ///
+    /// \param first         Unicode code point of the first character
+    /// \param second        Unicode code point of the second character
+    /// \param characterSize Reference character size
+    /// \param bold          Retrieve the bold version or the regular one?
+    ///
+    /// \return Kerning value for \a first and \a second, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    float loadKerning(std::uint32_t first, std::uint32_t second, unsigned int characterSize, bool bold) const;
+
     ////////////////////////////////////////////////////////////
     // Types
     ////////////////////////////////////////////////////////////
     struct FontHandles;
-    using PageTable = std::unordered_map<unsigned int, Page>; //!< Table mapping a character size to its page (texture)
+    struct Atlas;
+    using PageTable = std::unordered_map<unsigned int, Page>; //!< Character size to page table
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Distance field glyphs scaled to a character size
+    ///
+    ////////////////////////////////////////////////////////////
+    struct ScaledGlyphs
+    {
+        GlyphTable  glyphs; //!< Table mapping code points to their corresponding scaled glyph
+        GlyphLookup lookup; //!< Direct access to the glyphs of the first code points
+    };
+
+    using ScaledGlyphTable = std::unordered_map<unsigned int, ScaledGlyphs>; //!< Character size to scaled glyphs table
+    using KerningTable     = std::unordered_map<std::uint64_t, float>;       //!< Kerning by pair, size and style
+
+    friend class Text;
+    friend class TextBatch;
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::shared_ptr<FontHandles> m_fontHandles;    //!< Shared information about the internal font instance
-    bool                         m_isSmooth{true}; //!< Status of the smooth filter
-    Info                         m_info;           //!< Information about the font
-    mutable PageTable            m_pages;          //!< Table containing the glyphs pages by character size
+    std::shared_ptr<FontHandles>    m_fontHandles;         //!< Shared information about the internal font instance
+    std::shared_ptr<const Atlas>    m_atlas;               //!< Metrics restored from a pre-rasterized atlas (if any)
+    bool                            m_isSmooth{true};      //!< Status of the smooth filter
+    Info                            m_info;                //!< Information about the font
+    mutable PageTable               m_pages;               //!< Table containing the glyphs pages by character size
+    bool                            m_isDistanceField{};   //!< Status of the distance field rendering mode
+    mutable ScaledGlyphTable        m_scaledGlyphs;        //!< Distance field glyphs scaled to each character size
+    mutable KerningTable            m_kerning;             //!< Kerning already computed
+    mutable std::shared_ptr<Shader> m_distanceFieldShader; //!< Shader rendering distance field glyphs
     mutable std::vector<std::uint8_t> m_pixelBuffer; //!< Pixel buffer holding a glyph's pixels before being written to the texture
 #ifdef SFML_SYSTEM_ANDROID
     std::shared_ptr<priv::ResourceStream> m_stream; //!< Asset file streamer (if loaded from file)
@@ -461,6 +773,29 @@ private:
 /// If you need to display text of a certain size, make sure the
 /// corresponding bitmap font that supports that size is used.
 ///
+/// The glyphs rasterized by a font can be saved to a compact
+/// atlas file with saveAtlasToFile, and loaded back later with
+/// loadAtlasFromFile. Loading an atlas involves no rasterization
+/// at all, which makes it much faster than rendering the glyphs
+/// again, but only the glyphs that were cached when the atlas
+/// was saved are available.
+/// \code
+/// // Offline: rasterize the glyphs used by the application
+/// for (char32_t c = U' '; c <= U'~'; ++c)
+///     font.getGlyph(c, 30, false);
+/// if (!font.saveAtlasToFile("arial-30.atlas"))
+/// {
+///     // error...
+/// }
+///
+/// // At runtime: load the pre-rasterized glyphs
+/// sf::Font atlas;
+/// if (!atlas.loadAtlasFromFile("arial-30.atlas"))
+/// {
+///     // error...
+/// }
+/// \endcode
+///
 /// \see sf::Text
 ///
 ////////////////////////////////////////////////////////////
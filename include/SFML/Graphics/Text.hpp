@@ -409,6 +409,8 @@ private:
     ////////////////////////////////////////////////////////////
     void ensureGeometryUpdate() const;
 
+    friend class TextBatch;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
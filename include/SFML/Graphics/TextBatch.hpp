@@ -0,0 +1,405 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include <SFML/System/String.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class Font;
+class RenderTarget;
+
+////////////////////////////////////////////////////////////
+/// \brief Many strings sharing a font and a character size, drawn together
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextBatch : public Drawable, public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty batch from a font and size
+    ///
+    /// \param font          Font used to draw the strings
+    /// \param characterSize Base size of characters, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    TextBatch(const Font& font, unsigned int characterSize = 30);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow construction from a temporary font
+    ///
+    ////////////////////////////////////////////////////////////
+    TextBatch(Font&& font, unsigned int characterSize = 30) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a string to the batch
+    ///
+    /// The returned identifier designates the string in the
+    /// other functions of the batch. It stays valid until the
+    /// string is removed, after which it may be reused by a
+    /// new string.
+    ///
+    /// \param string    String to display
+    /// \param position  Position of the string, relative to the batch
+    /// \param fillColor Fill color of the string
+    /// \param style     Style of the string (see sf::Text::Style)
+    ///
+    /// \return Identifier of the new string
+    ///
+    /// \see remove
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t add(const String&   string,
+                    const Vector2f& position,
+                    const Color&    fillColor = Color::White,
+                    std::uint32_t   style     = Text::Regular);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove a string from the batch
+    ///
+    /// \param id Identifier of the string
+    ///
+    /// \see add
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(std::size_t id);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the strings from the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of strings in the batch
+    ///
+    /// \return Number of strings
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getStringCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change a string of the batch
+    ///
+    /// Only the strings that changed are laid out again.
+    ///
+    /// \param id     Identifier of the string
+    /// \param string New string
+    ///
+    /// \see getString
+    ///
+    ////////////////////////////////////////////////////////////
+    void setString(std::size_t id, const String& string);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the position of a string
+    ///
+    /// \param id       Identifier of the string
+    /// \param position New position, relative to the batch
+    ///
+    /// \see getStringPosition
+    ///
+    ////////////////////////////////////////////////////////////
+    void setStringPosition(std::size_t id, const Vector2f& position);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the fill color of a string
+    ///
+    /// \param id    Identifier of the string
+    /// \param color New fill color
+    ///
+    /// \see getStringFillColor
+    ///
+    ////////////////////////////////////////////////////////////
+    void setStringFillColor(std::size_t id, const Color& color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the outline color of a string
+    ///
+    /// The outline is only drawn if the outline thickness
+    /// of the batch is not zero.
+    ///
+    /// \param id    Identifier of the string
+    /// \param color New outline color
+    ///
+    /// \see getStringOutlineColor, setOutlineThickness
+    ///
+    ////////////////////////////////////////////////////////////
+    void setStringOutlineColor(std::size_t id, const Color& color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the style of a string
+    ///
+    /// \param id    Identifier of the string
+    /// \param style New style (see sf::Text::Style)
+    ///
+    /// \see getStringStyle
+    ///
+    ////////////////////////////////////////////////////////////
+    void setStringStyle(std::size_t id, std::uint32_t style);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the thickness of the outline of all the strings
+    ///
+    /// By default, the outline thickness is 0.
+    ///
+    /// \param thickness New outline thickness, in pixels
+    ///
+    /// \see getOutlineThickness
+    ///
+    ////////////////////////////////////////////////////////////
+    void setOutlineThickness(float thickness);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a string of the batch
+    ///
+    /// \param id Identifier of the string
+    ///
+    /// \return String
+    ///
+    /// \see setString
+    ///
+    ////////////////////////////////////////////////////////////
+    const String& getString(std::size_t id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of a string
+    ///
+    /// \param id Identifier of the string
+    ///
+    /// \return Position of the string, relative to the batch
+    ///
+    /// \see setStringPosition
+    ///
+    ////////////////////////////////////////////////////////////
+    const Vector2f& getStringPosition(std::size_t id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the fill color of a string
+    ///
+    /// \param id Identifier of the string
+    ///
+    /// \return Fill color of the string
+    ///
+    /// \see setStringFillColor
+    ///
+    ////////////////////////////////////////////////////////////
+    const Color& getStringFillColor(std::size_t id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the outline color of a string
+    ///
+    /// \param id Identifier of the string
+    ///
+    /// \return Outline color of the string
+    ///
+    /// \see setStringOutlineColor
+    ///
+    ////////////////////////////////////////////////////////////
+    const Color& getStringOutlineColor(std::size_t id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the style of a string
+    ///
+    /// \param id Identifier of the string
+    ///
+    /// \return Style of the string
+    ///
+    /// \see setStringStyle
+    ///
+    ////////////////////////////////////////////////////////////
+    std::uint32_t getStringStyle(std::size_t id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounding rectangle of a string
+    ///
+    /// The returned rectangle is in the local coordinates of
+    /// the batch, like the position of the string.
+    ///
+    /// \param id Identifier of the string
+    ///
+    /// \return Bounding rectangle of the string
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getStringBounds(std::size_t id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the font of the batch
+    ///
+    /// \return Reference to the font
+    ///
+    ////////////////////////////////////////////////////////////
+    const Font& getFont() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the character size of the batch
+    ///
+    /// \return Size of the characters, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getCharacterSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the outline thickness of the strings
+    ///
+    /// \return Outline thickness of the strings, in pixels
+    ///
+    /// \see setOutlineThickness
+    ///
+    ////////////////////////////////////////////////////////////
+    float getOutlineThickness() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief String of the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        Text        text;            //!< Text laying out the string
+        bool        used{true};      //!< Is the entry holding a string, or waiting to be reused?
+        bool        bold{};          //!< Is the entry laid out with the bold strings?
+        bool        needUpdate{};    //!< Does the geometry of the entry need to be copied to the batch?
+        std::size_t vertexOffset{};  //!< Index of the first fill vertex of the entry in the batch
+        std::size_t vertexCount{};   //!< Number of fill vertices of the entry in the batch
+        std::size_t outlineOffset{}; //!< Index of the first outline vertex of the entry in the batch
+        std::size_t outlineCount{};  //!< Number of outline vertices of the entry in the batch
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the batch to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, const RenderStates& states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a string of the batch, to modify it
+    ///
+    /// \param id Identifier of the string
+    ///
+    /// \return Entry holding the string, marked for update
+    ///
+    ////////////////////////////////////////////////////////////
+    Entry& getEntryForUpdate(std::size_t id);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Make sure the batch's geometry is updated
+    ///
+    /// Only the strings that changed are laid out again. Their
+    /// vertices are written in place when their number didn't
+    /// change, otherwise the whole geometry is rebuilt.
+    /// The regular strings are laid out first, followed by the
+    /// bold strings.
+    ///
+    ////////////////////////////////////////////////////////////
+    void ensureGeometryUpdate() const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const Font*                m_font{};                                    //!< Font used to display the strings
+    unsigned int               m_characterSize{30};                         //!< Base size of characters, in pixels
+    float                      m_outlineThickness{};                        //!< Thickness of the strings' outline
+    mutable std::vector<Entry> m_entries;                                   //!< Strings of the batch
+    std::vector<std::size_t>   m_freeEntries;                               //!< Entries waiting to be reused
+    mutable VertexArray        m_vertices{PrimitiveType::Triangles};        //!< Fill geometry of all the strings
+    mutable VertexArray        m_outlineVertices{PrimitiveType::Triangles}; //!< Outline geometry of all the strings
+    mutable std::size_t        m_boldVertexOffset{};                        //!< First fill vertex of the bold strings
+    mutable std::size_t        m_boldOutlineOffset{};                       //!< First outline vertex of bold strings
+    mutable bool               m_geometryNeedUpdate{};                      //!< Did any string change?
+    mutable bool               m_geometryNeedRebuild{};                     //!< Did the strings' vertex ranges change?
+    mutable std::uint64_t      m_fontTextureId{};                           //!< The font texture id
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextBatch
+/// \ingroup graphics
+///
+/// sf::TextBatch draws many strings that share a font and a
+/// character size, like damage numbers, nameplates or the
+/// cells of a table, with two draw calls in total (one for
+/// the outlines and one for the fills), instead of two draw
+/// calls per sf::Text.
+///
+/// Each string has its own position, fill color, outline
+/// color and style. The strings are laid out into a single
+/// vertex array; when strings change, only those are laid
+/// out again.
+///
+/// The batch itself is transformable: its transform applies
+/// to all its strings.
+///
+/// Like sf::Text, sf::TextBatch doesn't copy the font that it
+/// uses, it only keeps a reference to it.
+///
+/// When the font renders distance field glyphs (see
+/// sf::Font::setDistanceFieldEnabled), the regular strings
+/// and the bold strings are drawn in two separate draw calls,
+/// as they need different shader settings.
+///
+/// Usage example:
+/// \code
+/// sf::TextBatch labels(font, 16);
+/// labels.setOutlineThickness(1);
+///
+/// const std::size_t score = labels.add("0", {10, 10});
+/// labels.add("Game over", {100, 100}, sf::Color::Red, sf::Text::Bold);
+///
+/// // Later
+/// labels.setString(score, std::to_string(points));
+///
+/// window.draw(labels);
+/// \endcode
+///
+/// \see sf::Text, sf::Font
+///
+////////////////////////////////////////////////////////////
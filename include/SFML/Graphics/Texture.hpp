@@ -587,6 +587,7 @@ public:
 
 private:
     friend class Text;
+    friend class TextBatch;
     friend class RenderTexture;
     friend class RenderTarget;
 
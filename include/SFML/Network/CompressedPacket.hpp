@@ -0,0 +1,194 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <SFML/Network/Packet.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Packet whose data is compressed over the network
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API CompressedPacket : public Packet
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Statistics of the packets sent and received
+    ///
+    ////////////////////////////////////////////////////////////
+    struct SFML_NETWORK_API Statistics
+    {
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the ratio between the data size and the size actually sent
+        ///
+        /// \return Compression ratio of the sent packets, 1 if nothing was sent
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] double getCompressionRatio() const;
+
+        std::uint64_t sentPackets{};       //!< Number of packets sent
+        std::uint64_t compressedPackets{}; //!< Number of packets sent compressed (the others are sent as is)
+        std::uint64_t dataBytes{};         //!< Size of the data of the sent packets
+        std::uint64_t sentBytes{};         //!< Size actually sent, headers included
+        Time          compressionTime;     //!< Time spent compressing the sent packets
+        std::uint64_t receivedPackets{};   //!< Number of packets received
+        Time          decompressionTime;   //!< Time spent decompressing the received packets
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size below which the data is sent uncompressed
+    ///
+    /// Compressing small packets costs time and rarely saves
+    /// bytes. The default threshold is 128 bytes.
+    ///
+    /// \param size Minimum size of the data to compress, in bytes
+    ///
+    /// \see getCompressionThreshold
+    ///
+    ////////////////////////////////////////////////////////////
+    void setCompressionThreshold(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size below which the data is sent uncompressed
+    ///
+    /// \return Minimum size of the data to compress, in bytes
+    ///
+    /// \see setCompressionThreshold
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getCompressionThreshold() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the statistics of the packets sent and received
+    ///
+    /// The statistics accumulate over all the sends and
+    /// receives performed with this packet, until
+    /// resetStatistics is called.
+    ///
+    /// \return Statistics of the packet
+    ///
+    /// \see resetStatistics
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Statistics& getStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the statistics of the packet
+    ///
+    /// \see getStatistics
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetStatistics();
+
+protected:
+    ////////////////////////////////////////////////////////////
+    /// \brief Compress the data before it is sent
+    ///
+    /// \param size Variable to fill with the size of data to send
+    ///
+    /// \return Pointer to the array of bytes to send
+    ///
+    ////////////////////////////////////////////////////////////
+    const void* onSend(std::size_t& size) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Decompress the data after it is received
+    ///
+    /// If the data is corrupted, an error is printed and the
+    /// packet is left empty, so that reading from it fails.
+    ///
+    /// \param data Pointer to the received bytes
+    /// \param size Number of bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    void onReceive(const void* data, std::size_t size) override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::size_t                m_compressionThreshold{128}; //!< Size below which the data is sent uncompressed
+    std::vector<std::byte>     m_buffer;                    //!< Compressed or decompressed data, reused between calls
+    std::vector<std::uint32_t> m_hashTable;                 //!< Positions of the last occurrences of 4-byte sequences, used by the compressor
+    Statistics                 m_statistics;                //!< Statistics of the packets sent and received
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::CompressedPacket
+/// \ingroup network
+///
+/// sf::CompressedPacket is used exactly like sf::Packet, but its
+/// data is compressed when it is sent and decompressed when it
+/// is received. Both ends of a connection must use it.
+///
+/// The compression uses the LZ4 block format, which is very
+/// fast and works well on repetitive data such as game state
+/// snapshots or text. Data smaller than the compression
+/// threshold, or that doesn't shrink when compressed, is sent
+/// as is with a single byte of overhead.
+///
+/// The buffers used to compress and decompress the data are
+/// kept between calls, so reusing the same packet for all the
+/// sends and receives of a connection avoids allocating memory.
+/// This also gathers statistics about the whole connection.
+///
+/// Usage example:
+/// \code
+/// sf::CompressedPacket packet;
+/// packet << snapshot;
+/// socket.send(packet);
+///
+/// const auto& statistics = packet.getStatistics();
+/// std::cout << "Compression ratio: " << statistics.getCompressionRatio() << std::endl;
+///
+/// -----------------------------------------------------------------
+///
+/// // On the other end
+/// sf::CompressedPacket packet;
+/// if (socket.receive(packet) == sf::Socket::Status::Done)
+///     packet >> snapshot;
+/// \endcode
+///
+/// \see sf::Packet
+///
+////////////////////////////////////////////////////////////
@@ -37,6 +37,9 @@
 #include <string>
 #include <vector>
 
+#include <cstddef>
+#include <cstdint>
+
 
 namespace sf
 {
@@ -242,6 +245,25 @@ public:
         std::vector<std::string> m_listing; //!< Directory/file names extracted from the data
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Statistics about a transfer on the data channel
+    ///
+    ////////////////////////////////////////////////////////////
+    struct SFML_NETWORK_API TransferStatistics
+    {
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the average transfer rate
+        ///
+        /// \return Number of bytes transferred per second
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] double getBytesPerSecond() const;
+
+        std::uint64_t offset{};           //!< Position in the file where the transfer started (non-zero if resumed)
+        std::uint64_t bytesTransferred{}; //!< Number of bytes transferred
+        Time          duration;           //!< Time spent transferring the data
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -468,18 +490,28 @@ public:
     /// already exists in the local destination path, it will
     /// be overwritten.
     ///
+    /// If \a resume is true and the local file already exists,
+    /// it is considered as the beginning of the distant file
+    /// (from an interrupted download) and only the rest of the
+    /// file is downloaded, provided that the server supports
+    /// the REST command. In that case the local file is also
+    /// kept when the download fails, so that it can be resumed
+    /// again later.
+    ///
     /// \param remoteFile Filename of the distant file to download
     /// \param localPath  The directory in which to put the file on the local computer
     /// \param mode       Transfer mode
+    /// \param resume     Pass true to resume an interrupted download
     ///
     /// \return Server response to the request
     ///
-    /// \see upload
+    /// \see upload, getTransferStatistics
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Response download(const std::filesystem::path& remoteFile,
                                     const std::filesystem::path& localPath,
-                                    TransferMode                 mode = TransferMode::Binary);
+                                    TransferMode                 mode   = TransferMode::Binary,
+                                    bool                         resume = false);
 
     ////////////////////////////////////////////////////////////
     /// \brief Upload a file to the server
@@ -492,20 +524,66 @@ public:
     /// The append parameter controls whether the remote file is
     /// appended to or overwritten if it already exists.
     ///
+    /// If \a resume is true and the remote file already exists,
+    /// it is considered as the beginning of the local file (from
+    /// an interrupted upload) and only the rest of the file is
+    /// uploaded, provided that the server supports the SIZE and
+    /// REST commands. \a append is ignored in that case.
+    ///
+    /// Where the system supports it, the file is sent straight
+    /// from the disk without being copied through the application.
+    ///
     /// \param localFile  Path of the local file to upload
     /// \param remotePath The directory in which to put the file on the server
     /// \param mode       Transfer mode
     /// \param append     Pass true to append to or false to overwrite the remote file if it already exists
+    /// \param resume     Pass true to resume an interrupted upload
     ///
     /// \return Server response to the request
     ///
-    /// \see download
+    /// \see download, getTransferStatistics
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Response upload(const std::filesystem::path& localFile,
                                   const std::filesystem::path& remotePath,
                                   TransferMode                 mode   = TransferMode::Binary,
-                                  bool                         append = false);
+                                  bool                         append = false,
+                                  bool                         resume = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the buffer used for transfers
+    ///
+    /// Larger buffers mean fewer system calls per transferred
+    /// byte, which matters for large files on fast networks.
+    /// The default size is 64 KB.
+    ///
+    /// \param size Size of the transfer buffer, in bytes
+    ///
+    /// \see getTransferBufferSize
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTransferBufferSize(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the buffer used for transfers
+    ///
+    /// \return Size of the transfer buffer, in bytes
+    ///
+    /// \see setTransferBufferSize
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getTransferBufferSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the statistics of the last transfer
+    ///
+    /// The statistics are updated by each download, upload
+    /// and directory listing.
+    ///
+    /// \return Statistics of the last transfer on the data channel
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const TransferStatistics& getTransferStatistics() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Send a command to the FTP server
@@ -549,8 +627,10 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    TcpSocket   m_commandSocket; //!< Socket holding the control connection with the server
-    std::string m_receiveBuffer; //!< Received command data that is yet to be processed
+    TcpSocket          m_commandSocket;                 //!< Socket holding the control connection with the server
+    std::string        m_receiveBuffer;                 //!< Received command data that is yet to be processed
+    std::size_t        m_transferBufferSize{64 * 1024}; //!< Size of the buffer used for transfers
+    TransferStatistics m_transferStatistics;            //!< Statistics of the last transfer
 };
 
 } // namespace sf
@@ -617,6 +697,11 @@ private:
 /// if (response.isOk())
 ///     std::cout << "File uploaded" << std::endl;
 ///
+/// // Download a large file, resuming a previous attempt if any
+/// response = ftp.download("files/archive.zip", "local-path", sf::Ftp::TransferMode::Binary, true);
+/// if (response.isOk())
+///     std::cout << "Downloaded at " << ftp.getTransferStatistics().getBytesPerSecond() << " B/s" << std::endl;
+///
 /// // Send specific commands (here: FEAT to list supported FTP features)
 /// response = ftp.sendCommand("FEAT");
 /// if (response.isOk())
@@ -34,10 +34,14 @@
 
 #include <SFML/System/Time.hpp>
 
+#include <cstddef>
+#include <functional>
 #include <iosfwd>
 #include <map>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <vector>
 
 
 namespace sf
@@ -301,13 +305,13 @@ public:
         /// \brief Construct the header from a response string
         ///
         /// This function is used by Http to build the response
-        /// of a request.
+        /// of a request. Only the status line and the header
+        /// fields are parsed, the body is received separately.
         ///
-        /// \param data Content of the response to parse
+        /// \param data Header of the response to parse
         ///
         ////////////////////////////////////////////////////////////
-        void parse(const std::string& data);
-
+        void parseHeader(const std::string& data);
 
         ////////////////////////////////////////////////////////////
         /// \brief Read values passed in the answer header
@@ -335,6 +339,19 @@ public:
         std::string  m_body;                             //!< Body of the response
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Function receiving the body of a response as it arrives
+    ///
+    /// The first argument is the response, with its status and
+    /// header fields already known; the body is passed in the
+    /// following ones, one block at a time. When the response
+    /// has a "Content-Length" field, it gives the total size of
+    /// the body, which allows to report the progress of the
+    /// transfer. Returning false aborts the transfer.
+    ///
+    ////////////////////////////////////////////////////////////
+    using BodyCallback = std::function<bool(const Response& response, const char* data, std::size_t size)>;
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -398,6 +415,12 @@ public:
     /// of Time::Zero means that the client will use the system default timeout
     /// (which is usually pretty long).
     ///
+    /// HTTP/1.1 connections are kept alive after the response and
+    /// reused by the next requests, unless the request or the
+    /// response has a "Connection: close" field. A few idle
+    /// connections are kept, so that this function can be called
+    /// from several threads at the same time.
+    ///
     /// \param request Request to send
     /// \param timeout Maximum time to wait
     ///
@@ -406,14 +429,151 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Response sendRequest(const Request& request, Time timeout = Time::Zero);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a HTTP request and stream the body of the response
+    ///
+    /// This function behaves like sendRequest, except that the
+    /// body of the response is not stored in the returned
+    /// response: it is passed to \a callback block by block as
+    /// it is received. This allows to download large resources
+    /// without holding them in memory.
+    ///
+    /// If the callback returns false, the transfer is aborted
+    /// and the connection is closed; the returned response
+    /// still has the status and fields sent by the server.
+    ///
+    /// \param request  Request to send
+    /// \param callback Function receiving the body of the response
+    /// \param timeout  Maximum time to wait
+    ///
+    /// \return Server's response, with an empty body
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Response sendRequest(const Request& request, const BodyCallback& callback, Time timeout = Time::Zero);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a HTTP request and write the body of the response to a stream
+    ///
+    /// This is a shortcut for sendRequest with a callback that
+    /// writes each block to \a body, such as a file stream.
+    /// The transfer is aborted if writing to the stream fails.
+    ///
+    /// \param request Request to send
+    /// \param body    Stream to write the body of the response to
+    /// \param timeout Maximum time to wait
+    ///
+    /// \return Server's response, with an empty body
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Response sendRequest(const Request& request, std::ostream& body, Time timeout = Time::Zero);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several HTTP requests at once and return the server's responses
+    ///
+    /// The requests are pipelined: they are all written to a
+    /// single connection without waiting for the responses,
+    /// which are then read in order. This saves a round trip
+    /// per request. If the server closes the connection before
+    /// answering all of them, the requests left unanswered are
+    /// sent again on a new connection.
+    ///
+    /// As with sendRequest, any missing mandatory header field
+    /// is added to the requests.
+    ///
+    /// \param requests Requests to send
+    /// \param timeout  Maximum time to wait for the connection
+    ///
+    /// \return Server's responses, in the same order as \a requests
+    ///
+    /// \see sendRequest
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::vector<Response> sendRequests(const std::vector<Request>& requests, Time timeout = Time::Zero);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Close the connections kept alive with the host
+    ///
+    /// Connections are also closed when the host changes
+    /// and when the Http object is destroyed.
+    ///
+    ////////////////////////////////////////////////////////////
+    void disconnect();
+
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Add the missing mandatory fields to a request
+    ///
+    /// \param request Request to complete
+    ///
+    /// \return Copy of \a request, with all the mandatory fields
+    ///
+    ////////////////////////////////////////////////////////////
+    Request completeRequest(const Request& request) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get an idle connection to the host, or open a new one
+    ///
+    /// \param connection Socket to connect
+    /// \param reused     Set to true if the connection was kept alive from a previous request
+    /// \param timeout    Maximum time to wait for a new connection
+    ///
+    /// \return True if the socket is connected to the host
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool acquireConnection(TcpSocket& connection, bool& reused, Time timeout);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Keep a connection alive for the next requests
+    ///
+    /// \param connection Connection to the host, with no pending response
+    ///
+    ////////////////////////////////////////////////////////////
+    void releaseConnection(TcpSocket&& connection);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several HTTP requests on a connection and receive their responses
+    ///
+    /// \param requests Requests to send
+    /// \param callback Function receiving the bodies of the responses, or null to store them in the responses
+    /// \param timeout  Maximum time to wait for the connection
+    ///
+    /// \return Server's responses, in the same order as \a requests
+    ///
+    ////////////////////////////////////////////////////////////
+    std::vector<Response> sendPipelined(const std::vector<Request>& requests,
+                                        const BodyCallback*         callback,
+                                        Time                        timeout);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive a response
+    ///
+    /// The end of the response is found from its framing
+    /// (Content-Length or chunked transfer encoding), so
+    /// that the connection can be used for more requests.
+    ///
+    /// \param connection Connection to receive from
+    /// \param buffer     Data received and not consumed yet, which may include the next responses
+    /// \param isHead     Was the response requested with the HEAD method (which means it has no body)?
+    /// \param callback   Function receiving the body as it arrives, or null to store it in \a response
+    /// \param response   Response to fill
+    ///
+    /// \return True if the connection can be used for other requests
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool receiveResponse(TcpSocket&          connection,
+                                              std::string&        buffer,
+                                              bool                isHead,
+                                              const BodyCallback* callback,
+                                              Response&           response);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    TcpSocket                m_connection; //!< Connection to the host
-    std::optional<IpAddress> m_host;       //!< Web host address
-    std::string              m_hostName;   //!< Web host name
-    unsigned short           m_port{};     //!< Port used for connection with host
+    std::vector<TcpSocket>   m_connections; //!< Idle connections to the host, kept alive for the next requests
+    std::mutex               m_mutex;       //!< Mutex protecting the idle connections
+    std::optional<IpAddress> m_host;        //!< Web host address
+    std::string              m_hostName;    //!< Web host name
+    unsigned short           m_port{};      //!< Port used for connection with host
 };
 
 } // namespace sf
@@ -449,7 +609,11 @@ private:
 ///
 /// sf::Http provides a simple function, SendRequest, to send a
 /// sf::Http::Request and return the corresponding sf::Http::Response
-/// from the server.
+/// from the server. With HTTP/1.1, the connection to the server
+/// is kept alive and reused by the following requests; several
+/// requests can also be pipelined with sendRequests. Large
+/// bodies can be streamed to a callback or to a std::ostream
+/// instead of being stored in the response.
 ///
 /// Usage example:
 /// \code
@@ -30,6 +30,7 @@
 #include <SFML/Network/Export.hpp>
 
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include <cstddef>
@@ -120,6 +121,21 @@ public:
     ////////////////////////////////////////////////////////////
     void clear();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Reserve memory for the data to be appended
+    ///
+    /// Appending data to the packet then doesn't reallocate its
+    /// internal buffer until its size exceeds \a capacity. This
+    /// is useful to build large packets whose size is roughly
+    /// known in advance.
+    ///
+    /// \param capacity Number of bytes to reserve
+    ///
+    /// \see append
+    ///
+    ////////////////////////////////////////////////////////////
+    void reserve(std::size_t capacity);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get a pointer to the data contained in the packet
     ///
@@ -364,9 +380,124 @@ public:
     ////////////////////////////////////////////////////////////
     Packet& operator<<(const String& data);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Write an array of numbers into the packet
+    ///
+    /// This is equivalent to writing each element with
+    /// operator <<, but much faster for large arrays: the
+    /// elements are converted to network byte order in a single
+    /// pass. The number of elements is not written, the reader
+    /// must know it (for example by sending it first).
+    ///
+    /// \param data  Pointer to the first element
+    /// \param count Number of elements to write
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see readArray
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    Packet& writeArray(const T* data, std::size_t count)
+    {
+        static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+                      "T must be an integer or floating point type");
+        appendArray(data, count, sizeof(T), std::is_integral_v<T>);
+        return *this;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read an array of numbers from the packet
+    ///
+    /// This reads elements written with writeArray, or one by
+    /// one with operator <<. Nothing is read if the packet
+    /// doesn't contain \a count elements; the packet is then
+    /// invalid.
+    ///
+    /// \param data  Pointer to the array to fill
+    /// \param count Number of elements to read
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see writeArray
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    Packet& readArray(T* data, std::size_t count)
+    {
+        static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+                      "T must be an integer or floating point type");
+        extractArray(data, count, sizeof(T), std::is_integral_v<T>);
+        return *this;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write an unsigned integer with a variable size encoding
+    ///
+    /// The value is encoded in LEB128 format: 7 bits per byte,
+    /// so that small values take less space than with
+    /// operator << (1 byte below 128, 2 bytes below 16384, up
+    /// to 10 bytes for the largest values).
+    ///
+    /// \param data Value to write
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see readVarUint
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& writeVarUint(std::uint64_t data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a signed integer with a variable size encoding
+    ///
+    /// The value is zig-zag encoded (0, -1, 1, -2, 2...) before
+    /// being written like with writeVarUint, so that values
+    /// close to 0 take less space whatever their sign.
+    ///
+    /// \param data Value to write
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see readVarInt
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& writeVarInt(std::int64_t data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read an unsigned integer written with writeVarUint
+    ///
+    /// The packet is invalid if the data is truncated or doesn't
+    /// encode a 64 bits value.
+    ///
+    /// \param data Variable to fill with the value
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see writeVarUint
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& readVarUint(std::uint64_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read a signed integer written with writeVarInt
+    ///
+    /// The packet is invalid if the data is truncated or doesn't
+    /// encode a 64 bits value.
+    ///
+    /// \param data Variable to fill with the value
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see writeVarInt
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& readVarInt(std::int64_t& data);
+
 protected:
     friend class TcpSocket;
     friend class UdpSocket;
+    friend class UdpConnection;
 
     ////////////////////////////////////////////////////////////
     /// \brief Called before the packet is sent over the network
@@ -420,6 +551,28 @@ private:
     ////////////////////////////////////////////////////////////
     bool checkSize(std::size_t size);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Append an array of numbers in network byte order
+    ///
+    /// \param data        Pointer to the first element
+    /// \param count       Number of elements
+    /// \param elementSize Size of an element, in bytes
+    /// \param isInteger   Is the element an integer? (floating point numbers are copied as is)
+    ///
+    ////////////////////////////////////////////////////////////
+    void appendArray(const void* data, std::size_t count, std::size_t elementSize, bool isInteger);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract an array of numbers stored in network byte order
+    ///
+    /// \param data        Pointer to the array to fill
+    /// \param count       Number of elements
+    /// \param elementSize Size of an element, in bytes
+    /// \param isInteger   Is the element an integer? (floating point numbers are copied as is)
+    ///
+    ////////////////////////////////////////////////////////////
+    void extractArray(void* data, std::size_t count, std::size_t elementSize, bool isInteger);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -490,6 +643,30 @@ private:
 /// \li floating point numbers (float, double)
 /// \li string types (char*, wchar_t*, std::string, std::wstring, sf::String)
 ///
+/// Large arrays of numbers, such as positions in a game state
+/// snapshot, are best transferred with writeArray and readArray,
+/// which handle the whole array at once. Integers that are
+/// usually small can be written with writeVarUint and
+/// writeVarInt, which use fewer bytes than fixed-size integers.
+/// Calling reserve before building a large packet avoids
+/// reallocating its data several times.
+///
+/// \code
+/// std::vector<float> positions = ...;
+///
+/// packet.reserve(positions.size() * sizeof(float) + 10);
+/// packet.writeVarUint(positions.size());
+/// packet.writeArray(positions.data(), positions.size());
+///
+/// // On the other end
+/// std::uint64_t count = 0;
+/// if (packet.readVarUint(count) && (count <= maxPositions))
+/// {
+///     positions.resize(count);
+///     packet.readArray(positions.data(), positions.size());
+/// }
+/// \endcode
+///
 /// Like standard streams, it is also possible to define your own
 /// overloads of operators >> and << in order to handle your
 /// custom types.
@@ -547,6 +724,9 @@ private:
 /// ...
 /// \endcode
 ///
+/// sf::CompressedPacket is a ready-made packet of this kind,
+/// which compresses its data with a fast LZ4 codec.
+///
 /// \see sf::TcpSocket, sf::UdpSocket
 ///
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,240 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <SFML/Network/IpAddress.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Resolve host names in the background and cache the results
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API Resolver
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called when a resolution is complete
+    ///
+    /// \a address is empty if the host name could not be resolved.
+    ///
+    ////////////////////////////////////////////////////////////
+    using Callback = std::function<void(std::optional<IpAddress> address)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Function performing the actual (blocking) resolution of a host name
+    ///
+    ////////////////////////////////////////////////////////////
+    using Lookup = std::function<std::optional<IpAddress>(const std::string& hostName)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a resolver using sf::IpAddress::resolve
+    ///
+    /// \param threadCount Maximum number of host names resolved in parallel
+    /// \param timeToLive  Duration during which a resolved address is kept in the cache
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit Resolver(std::size_t threadCount = 4, Time timeToLive = seconds(300));
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a resolver using a custom lookup function
+    ///
+    /// The lookup function is called from the resolver's
+    /// threads, possibly concurrently. It can implement another
+    /// naming service, or a fixed table of hosts.
+    ///
+    /// \param lookup      Function resolving a host name
+    /// \param threadCount Maximum number of host names resolved in parallel
+    /// \param timeToLive  Duration during which a resolved address is kept in the cache
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit Resolver(Lookup lookup, std::size_t threadCount = 4, Time timeToLive = seconds(300));
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// The resolutions that haven't started yet complete with
+    /// an empty address. The destructor waits for the ones in
+    /// progress, since a system lookup can't be interrupted.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~Resolver();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    Resolver(const Resolver&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    Resolver& operator=(const Resolver&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Resolve a host name in the background
+    ///
+    /// If the address is in the cache, the returned future is
+    /// ready immediately. Otherwise the host name is resolved
+    /// by one of the resolver's threads; concurrent requests for
+    /// the same host name share a single lookup.
+    ///
+    /// \param hostName Host name or decimal address to resolve
+    ///
+    /// \return Future receiving the address, empty if the host name could not be resolved
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::future<std::optional<IpAddress>> resolve(std::string_view hostName);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Resolve a host name in the background and call a function with the result
+    ///
+    /// If the address is in the cache, \a callback is called
+    /// immediately by the calling thread. Otherwise it is
+    /// called by one of the resolver's threads once the lookup
+    /// is complete, so it must not block for long.
+    ///
+    /// \param hostName Host name or decimal address to resolve
+    /// \param callback Function to call with the address
+    ///
+    ////////////////////////////////////////////////////////////
+    void resolve(std::string_view hostName, Callback callback);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the address of a host name if it is in the cache
+    ///
+    /// This function never waits for a lookup.
+    ///
+    /// \param hostName Host name or decimal address
+    ///
+    /// \return Cached address, or an empty optional if the host name is not in the cache or has expired
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<IpAddress> getCachedAddress(std::string_view hostName) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the duration during which resolved addresses are cached
+    ///
+    /// The new duration applies to the following lookups.
+    /// Failed lookups are never cached.
+    ///
+    /// \param timeToLive Duration during which a resolved address is kept in the cache
+    ///
+    /// \see getTimeToLive
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTimeToLive(Time timeToLive);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the duration during which resolved addresses are cached
+    ///
+    /// \return Duration during which a resolved address is kept in the cache
+    ///
+    /// \see setTimeToLive
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getTimeToLive() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the addresses from the cache
+    ///
+    ////////////////////////////////////////////////////////////
+    void clearCache();
+
+private:
+    struct Impl;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::unique_ptr<Impl> m_impl; //!< Implementation, shared with the worker threads
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::Resolver
+/// \ingroup network
+///
+/// sf::IpAddress::resolve blocks the calling thread until the
+/// host name is resolved, which may take seconds when the
+/// naming service is slow or unreachable. sf::Resolver
+/// performs the lookups in its own threads and delivers the
+/// results through a std::future or a callback, so that the
+/// main loop never waits for them.
+///
+/// Resolved addresses are kept in a cache for a configurable
+/// duration, so that connecting again to the same host doesn't
+/// trigger a new lookup. Several host names are resolved in
+/// parallel, up to the number of threads given at
+/// construction.
+///
+/// Usage example:
+/// \code
+/// sf::Resolver resolver;
+///
+/// // Start resolving several host names at once
+/// auto server = resolver.resolve("game.example.com");
+/// auto backup = resolver.resolve("backup.example.com");
+///
+/// // Later, in the main loop
+/// if (server.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+/// {
+///     if (const std::optional<sf::IpAddress> address = server.get())
+///     {
+///         // Connect to *address...
+///     }
+/// }
+///
+/// // Or be notified by a callback, called from the resolver's thread
+/// resolver.resolve("www.sfml-dev.org", [](std::optional<sf::IpAddress> address)
+/// {
+///     // ...
+/// });
+/// \endcode
+///
+/// \see sf::IpAddress
+///
+////////////////////////////////////////////////////////////
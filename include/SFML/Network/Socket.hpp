@@ -182,6 +182,7 @@ protected:
 
 private:
     friend class SocketSelector;
+    friend class SocketReactor;
 
     ////////////////////////////////////////////////////////////
     // Member data
@@ -0,0 +1,363 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/Socket.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+
+#include <functional>
+#include <memory>
+#include <optional>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class TcpListener;
+class UdpSocket;
+
+////////////////////////////////////////////////////////////
+/// \brief Event loop performing socket operations asynchronously
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API SocketReactor
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Completion handler of the operations that only report a status
+    ///
+    ////////////////////////////////////////////////////////////
+    using Handler = std::function<void(Socket::Status status)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Completion handler of asyncAccept
+    ///
+    /// The new connection is passed in \a socket when the
+    /// status is Socket::Status::Done.
+    ///
+    ////////////////////////////////////////////////////////////
+    using AcceptHandler = std::function<void(Socket::Status status, TcpSocket socket)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Completion handler of the raw TCP asyncReceive
+    ///
+    ////////////////////////////////////////////////////////////
+    using ReceiveHandler = std::function<void(Socket::Status status, std::size_t received)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Completion handler of the UDP asyncReceive
+    ///
+    ////////////////////////////////////////////////////////////
+    using DatagramHandler = std::function<void(Socket::Status           status,
+                                               std::size_t              received,
+                                               std::optional<IpAddress> remoteAddress,
+                                               unsigned short           remotePort)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    SocketReactor();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Pending operations are dropped without invoking
+    /// their handlers.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~SocketReactor();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    SocketReactor(const SocketReactor&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    SocketReactor& operator=(const SocketReactor&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Accept a new connection asynchronously
+    ///
+    /// \param listener Listener to accept the connection from
+    /// \param handler  Function called with the new connection
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncAccept(TcpListener& listener, AcceptHandler handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Connect a TCP socket to a remote peer asynchronously
+    ///
+    /// \param socket        Socket to connect
+    /// \param remoteAddress Address of the remote peer
+    /// \param remotePort    Port of the remote peer
+    /// \param handler       Function called when the connection succeeded or failed
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncConnect(TcpSocket& socket, IpAddress remoteAddress, unsigned short remotePort, Handler handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send raw data to the remote peer asynchronously
+    ///
+    /// The data is copied, so it doesn't have to be kept
+    /// alive until the operation completes. The handler is
+    /// called once all the data has been sent.
+    ///
+    /// \param socket  Connected socket to send the data with
+    /// \param data    Pointer to the sequence of bytes to send
+    /// \param size    Number of bytes to send
+    /// \param handler Function called when the data has been sent (optional)
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncSend(TcpSocket& socket, const void* data, std::size_t size, Handler handler = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a formatted packet to the remote peer asynchronously
+    ///
+    /// \param socket  Connected socket to send the packet with
+    /// \param packet  Packet to send
+    /// \param handler Function called when the packet has been sent (optional)
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncSend(TcpSocket& socket, Packet packet, Handler handler = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive raw data from the remote peer asynchronously
+    ///
+    /// The operation completes as soon as some data is received,
+    /// like TcpSocket::receive. The buffer must stay alive until
+    /// the handler is called.
+    ///
+    /// \param socket  Connected socket to receive the data with
+    /// \param data    Pointer to the array to fill with the received bytes
+    /// \param size    Maximum number of bytes that can be received
+    /// \param handler Function called with the number of bytes received
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncReceive(TcpSocket& socket, void* data, std::size_t size, ReceiveHandler handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive a formatted packet from the remote peer asynchronously
+    ///
+    /// The packet must stay alive until the handler is called.
+    ///
+    /// \param socket  Connected socket to receive the packet with
+    /// \param packet  Packet to fill with the received data
+    /// \param handler Function called when the whole packet has been received
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncReceive(TcpSocket& socket, Packet& packet, Handler handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a datagram asynchronously
+    ///
+    /// The data is copied, so it doesn't have to be kept
+    /// alive until the operation completes.
+    ///
+    /// \param socket        Socket to send the datagram with
+    /// \param data          Pointer to the sequence of bytes to send
+    /// \param size          Number of bytes to send
+    /// \param remoteAddress Address of the receiver
+    /// \param remotePort    Port of the receiver to send the data to
+    /// \param handler       Function called when the datagram has been sent (optional)
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncSend(UdpSocket&     socket,
+                   const void*    data,
+                   std::size_t    size,
+                   IpAddress      remoteAddress,
+                   unsigned short remotePort,
+                   Handler        handler = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive a datagram asynchronously
+    ///
+    /// The buffer must stay alive until the handler is called.
+    ///
+    /// \param socket  Bound socket to receive the datagram with
+    /// \param data    Pointer to the array to fill with the received bytes
+    /// \param size    Maximum number of bytes that can be received
+    /// \param handler Function called with the datagram size and its sender
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncReceive(UdpSocket& socket, void* data, std::size_t size, DatagramHandler handler);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cancel the pending operations of a socket
+    ///
+    /// The handlers of the cancelled operations are not called.
+    /// This must be called before destroying a socket that
+    /// has pending operations.
+    ///
+    /// \param socket Socket whose operations to cancel
+    ///
+    ////////////////////////////////////////////////////////////
+    void cancel(Socket& socket);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a function to be called by the event loop
+    ///
+    /// This function can be called from any thread, which
+    /// makes it the way to hand work over to the threads
+    /// running the event loop.
+    ///
+    /// \param function Function to call
+    ///
+    ////////////////////////////////////////////////////////////
+    void post(std::function<void()> function);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Run the event loop
+    ///
+    /// This function waits for the sockets, performs the
+    /// operations and calls the handlers until there are no
+    /// pending operations left or until stop is called.
+    /// It can be called from several threads at the same time,
+    /// to call handlers in parallel.
+    ///
+    /// \return Number of handlers called
+    ///
+    /// \see poll, stop
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t run();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Run the event loop without waiting
+    ///
+    /// This function performs the operations whose sockets are
+    /// ready and calls the handlers that are ready, then returns.
+    /// It is meant to be called regularly from an existing loop,
+    /// such as a game loop.
+    ///
+    /// \return Number of handlers called
+    ///
+    /// \see run
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t poll();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Make the calls to run return
+    ///
+    /// The calls to run in progress return as soon as they have
+    /// finished calling their current handler; pending operations
+    /// are kept, and are resumed by the next call to run or poll.
+    ///
+    ////////////////////////////////////////////////////////////
+    void stop();
+
+private:
+    struct Impl;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::unique_ptr<Impl> m_impl; //!< Opaque pointer to the implementation (which requires OS-specific types)
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SocketReactor
+/// \ingroup network
+///
+/// sf::SocketReactor performs socket operations (accepting,
+/// connecting, sending and receiving) in the background and
+/// notifies their completion by calling handlers. It removes
+/// the need to poll sockets with sf::SocketSelector and to
+/// retry partial sends by hand: a single thread can serve a
+/// large number of connections.
+///
+/// Like a selector, the reactor doesn't own the sockets: they
+/// must be stored outside and stay alive as long as they have
+/// pending operations. They are switched to non-blocking mode
+/// when an operation is started. Operations of the same
+/// direction on a socket (sends or receives) are performed in
+/// the order in which they were started, so several sends can
+/// be queued without waiting for the previous ones.
+///
+/// Handlers are called by the threads running run() or poll().
+/// A handler typically starts the next operation, such as
+/// receiving the next packet. When several threads run the
+/// reactor, handlers may be called concurrently.
+///
+/// Usage example:
+/// \code
+/// sf::SocketReactor          reactor;
+/// sf::TcpListener            listener;
+/// std::list<sf::TcpSocket>   clients;
+/// std::list<sf::Packet>      packets;
+///
+/// if (listener.listen(55001) != sf::Socket::Status::Done)
+/// {
+///     // Handle error...
+/// }
+///
+/// // Echo the packets received from the clients
+/// std::function<void(sf::TcpSocket&, sf::Packet&)> receive = [&](sf::TcpSocket& client, sf::Packet& packet)
+/// {
+///     reactor.asyncReceive(client, packet, [&](sf::Socket::Status status)
+///     {
+///         if (status != sf::Socket::Status::Done)
+///             return;
+///
+///         reactor.asyncSend(client, packet);
+///         receive(client, packet);
+///     });
+/// };
+///
+/// std::function<void()> accept = [&]
+/// {
+///     reactor.asyncAccept(listener, [&](sf::Socket::Status status, sf::TcpSocket socket)
+///     {
+///         if (status == sf::Socket::Status::Done)
+///             receive(clients.emplace_back(std::move(socket)), packets.emplace_back());
+///
+///         accept();
+///     });
+/// };
+///
+/// accept();
+/// reactor.run();
+/// \endcode
+///
+/// \see sf::SocketSelector
+///
+////////////////////////////////////////////////////////////
@@ -32,6 +32,8 @@
 #include <SFML/Network/IpAddress.hpp>
 #include <SFML/Network/Socket.hpp>
 
+#include <vector>
+
 
 namespace sf
 {
@@ -63,6 +65,65 @@ public:
     ////////////////////////////////////////////////////////////
     unsigned short getLocalPort() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable sharing the port with other listeners
+    ///
+    /// When enabled, several listeners (typically one per
+    /// thread) can listen on the same port, provided that they
+    /// all enable it; the system then balances the incoming
+    /// connections between them. This relies on the SO_REUSEPORT
+    /// option, which is not supported on Windows: listen fails
+    /// there if port reuse is enabled.
+    ///
+    /// The setting takes effect on the next call to listen.
+    /// Port reuse is disabled by default.
+    ///
+    /// \param enabled True to enable port reuse, false to disable it
+    ///
+    /// \see isPortReuseEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPortReuseEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the port can be shared with other listeners
+    ///
+    /// \return True if port reuse is enabled
+    ///
+    /// \see setPortReuseEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isPortReuseEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum number of pending connections
+    ///
+    /// Connections that are established but not accepted yet
+    /// wait in a queue of this size; further connection
+    /// attempts are refused or delayed by the system. The
+    /// system may limit the actual size of the queue.
+    ///
+    /// The setting takes effect on the next call to listen.
+    /// The default value is SOMAXCONN, the system's default
+    /// maximum.
+    ///
+    /// \param backlog Maximum number of pending connections
+    ///
+    /// \see getBacklog
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBacklog(int backlog);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum number of pending connections
+    ///
+    /// \return Maximum number of pending connections
+    ///
+    /// \see setBacklog
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] int getBacklog() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Start listening for incoming connection attempts
     ///
@@ -112,6 +173,31 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status accept(TcpSocket& socket);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Accept all the pending connections
+    ///
+    /// This function accepts a first connection like accept
+    /// (waiting for it if the socket is in blocking mode), then
+    /// all the connections that are already pending, without
+    /// waiting. This saves a lot of calls when many clients
+    /// connect at the same time.
+    ///
+    /// \param sockets Vector to which the new connections are appended
+    ///
+    /// \return Status code, sf::Socket::Status::Done if at least one connection was accepted
+    ///
+    /// \see accept
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status acceptAll(std::vector<TcpSocket>& sockets);
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    int  m_backlog;      //!< Maximum number of pending connections
+    bool m_portReuse{};  //!< Can the port be shared with other listeners?
 };
 
 
@@ -161,6 +247,10 @@ public:
 /// }
 /// \endcode
 ///
+/// Servers that must absorb many simultaneous connections can
+/// accept them in batches with acceptAll, and run one listener
+/// per thread on the same port with setPortReuseEnabled.
+///
 /// \see sf::TcpSocket, sf::Socket
 ///
 ////////////////////////////////////////////////////////////
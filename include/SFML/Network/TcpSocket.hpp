@@ -214,8 +214,97 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status receive(Packet& packet);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Append raw data to the send queue
+    ///
+    /// The data is copied to the send queue of the socket, and
+    /// actually sent by the next calls to flush. Unlike send,
+    /// this never fails nor blocks, and partial sends don't
+    /// need any special handling.
+    ///
+    /// \param data Pointer to the sequence of bytes to queue
+    /// \param size Number of bytes to queue
+    ///
+    /// \see flush, isQueueFull
+    ///
+    ////////////////////////////////////////////////////////////
+    void queue(const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append a formatted packet of data to the send queue
+    ///
+    /// The packet data is copied to the send queue, so the
+    /// packet can be modified or destroyed right after this
+    /// call; it is actually sent by the next calls to flush.
+    ///
+    /// \param packet Packet to queue
+    ///
+    /// \see flush, isQueueFull
+    ///
+    ////////////////////////////////////////////////////////////
+    void queue(Packet& packet);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send the data waiting in the send queue
+    ///
+    /// The queued data is sent with as few system calls as
+    /// possible, by passing several blocks to each of them.
+    /// In blocking mode, this function waits until the whole
+    /// queue is sent. In non-blocking mode, it sends what the
+    /// system accepts without waiting, and returns
+    /// sf::Socket::Status::Partial or sf::Socket::Status::NotReady
+    /// if some data is left in the queue: just call it again
+    /// later, typically once per iteration of the main loop.
+    ///
+    /// \return Status code, sf::Socket::Status::Done if the queue is empty
+    ///
+    /// \see queue
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status flush();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of bytes waiting in the send queue
+    ///
+    /// \return Number of queued bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getQueuedSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the watermarks of the send queue
+    ///
+    /// The queue becomes full when its size reaches the high
+    /// watermark, and stops being full when it is flushed down
+    /// to the low watermark. The defaults are 64 KB and 1 MB.
+    ///
+    /// \param low  Low watermark, in bytes
+    /// \param high High watermark, in bytes
+    ///
+    /// \see isQueueFull
+    ///
+    ////////////////////////////////////////////////////////////
+    void setQueueWatermarks(std::size_t low, std::size_t high);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the send queue is full
+    ///
+    /// A full queue means that the remote peer doesn't receive
+    /// the data as fast as it is produced. Data can still be
+    /// queued, but producers should wait until the queue is no
+    /// longer full to avoid using an unbounded amount of memory
+    /// (or disconnect the peer if it is too slow).
+    ///
+    /// \return True if the queue has reached the high watermark and has not been flushed down to the low one yet
+    ///
+    /// \see setQueueWatermarks
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isQueueFull() const;
+
 private:
     friend class TcpListener;
+    friend class Ftp;
 
     ////////////////////////////////////////////////////////////
     /// \brief Structure holding the data of a pending packet
@@ -231,8 +320,14 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    PendingPacket          m_pendingPacket;     //!< Temporary data of the packet currently being received
-    std::vector<std::byte> m_blockToSendBuffer; //!< Buffer used to prepare data being sent from the socket
+    PendingPacket                       m_pendingPacket;                   //!< Temporary data of the packet currently being received
+    std::vector<std::byte>              m_blockToSendBuffer;               //!< Buffer used to prepare data being sent from the socket
+    std::vector<std::vector<std::byte>> m_sendQueue;                       //!< Blocks of data waiting to be sent
+    std::size_t                         m_sendQueueOffset{};               //!< Number of bytes of the first block already sent
+    std::size_t                         m_queuedSize{};                    //!< Total number of bytes waiting to be sent
+    std::size_t                         m_queueLowWatermark{64 * 1024};    //!< Size below which the queue stops being full
+    std::size_t                         m_queueHighWatermark{1024 * 1024}; //!< Size from which the queue is full
+    bool                                m_queueFull{};                     //!< Has the queue reached the high watermark?
 };
 
 } // namespace sf
@@ -312,6 +407,25 @@ private:
 /// socket.send(message.c_str(), message.size() + 1);
 /// \endcode
 ///
+/// When sending many small messages, or when sending to slow
+/// peers in non-blocking mode, the send queue is often more
+/// convenient than send: data is appended with queue, sent with
+/// flush, and isQueueFull tells when a peer can't keep up.
+/// \code
+/// // Broadcast a packet to all the clients, dropping the ones that are too slow
+/// for (sf::TcpSocket& client : clients)
+/// {
+///     if (client.isQueueFull())
+///         client.disconnect();
+///     else
+///         client.queue(packet);
+/// }
+///
+/// // Then, once per iteration of the main loop
+/// for (sf::TcpSocket& client : clients)
+///     (void)client.flush();
+/// \endcode
+///
 /// \see sf::Socket, sf::UdpSocket, sf::Packet
 ///
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,351 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/Socket.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <memory>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class Packet;
+class UdpSocket;
+
+////////////////////////////////////////////////////////////
+/// \brief Connection exchanging reliable and unreliable
+///        messages with a remote peer over UDP
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API UdpConnection
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Delivery guarantees of a message
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Delivery
+    {
+        Unreliable, //!< The message may be lost, and messages may arrive in any order
+        Reliable,   //!< The message is resent until it is received, but messages may arrive in any order
+        Ordered     //!< The message is resent until it is received, and delivered in order with the other ordered messages of its channel
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Statistics of the connection
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        std::uint64_t sentDatagrams{};     //!< Number of datagrams sent, including resends and acknowledgments
+        std::uint64_t resentDatagrams{};   //!< Number of datagrams resent because they were not acknowledged in time
+        std::uint64_t receivedDatagrams{}; //!< Number of valid datagrams received from the peer
+        std::uint64_t sentMessages{};      //!< Number of messages sent
+        std::uint64_t receivedMessages{};  //!< Number of messages received and delivered
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Maximum size of the data carried by a single datagram
+    ///
+    /// Larger messages are split into fragments of this size.
+    /// It is small enough to avoid IP fragmentation on most
+    /// networks.
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t MaxFragmentSize{1200};
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a connection with a remote peer
+    ///
+    /// The socket must be bound, and stay alive as long as the
+    /// connection. Both peers must create a connection to
+    /// communicate.
+    ///
+    /// \warning The socket is switched to non-blocking mode, so
+    /// that update() never waits for datagrams. It is not
+    /// switched back when the connection is destroyed, and any
+    /// other code that uses the socket must expect it to be
+    /// non-blocking.
+    ///
+    /// \param socket        Socket used to send and receive the datagrams
+    /// \param remoteAddress Address of the remote peer
+    /// \param remotePort    Port of the remote peer
+    ///
+    ////////////////////////////////////////////////////////////
+    UdpConnection(UdpSocket& socket, IpAddress remoteAddress, unsigned short remotePort);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~UdpConnection();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UdpConnection(const UdpConnection&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UdpConnection& operator=(const UdpConnection&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UdpConnection(UdpConnection&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UdpConnection& operator=(UdpConnection&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the address of the remote peer
+    ///
+    /// \return Address of the remote peer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] IpAddress getRemoteAddress() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the port of the remote peer
+    ///
+    /// \return Port of the remote peer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned short getRemotePort() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a message to the remote peer
+    ///
+    /// Unreliable messages are sent immediately. Reliable
+    /// messages are sent as soon as the number of fragments
+    /// waiting for an acknowledgment allows it, the others are
+    /// sent by update when acknowledgments arrive; they are
+    /// resent by update until the peer acknowledges them.
+    /// Messages larger than MaxFragmentSize are split into
+    /// several datagrams and reassembled by the peer.
+    ///
+    /// Ordered messages are delivered in the order in which
+    /// they were sent, but only relatively to the other ordered
+    /// messages of the same channel: a lost message only delays
+    /// the following messages of its own channel.
+    ///
+    /// \param packet   Packet containing the message
+    /// \param channel  Channel of the message
+    /// \param delivery Delivery guarantees of the message
+    ///
+    /// \return Status::Done if the message was sent, Status::Error if it is too large or the socket failed
+    ///
+    /// \see receive
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Socket::Status send(Packet& packet, std::uint8_t channel = 0, Delivery delivery = Delivery::Ordered);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Take the next message received from the remote peer
+    ///
+    /// Messages are received by update, this function only
+    /// returns the ones that are ready to be delivered.
+    ///
+    /// \param packet  Packet to fill with the message
+    /// \param channel Variable to fill with the channel of the message
+    ///
+    /// \return True if a message was available
+    ///
+    /// \see send, update
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool receive(Packet& packet, std::uint8_t& channel);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Exchange the pending datagrams with the remote peer
+    ///
+    /// This function must be called regularly, typically once
+    /// per frame. It reads the datagrams waiting in the socket,
+    /// resends the reliable messages that were not
+    /// acknowledged in time, and acknowledges the received
+    /// messages.
+    ///
+    /// When several connections share the same socket (like a
+    /// server talking to several clients), the socket must be
+    /// read outside: pass \a readSocket = false and give the
+    /// datagrams of each peer to its connection with
+    /// handleDatagram.
+    ///
+    /// \param readSocket Read the datagrams waiting in the socket?
+    ///
+    /// \see handleDatagram
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(bool readSocket = true);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Process a datagram received from the remote peer
+    ///
+    /// This function is only needed when the socket is read
+    /// outside of update. Datagrams that don't belong to the
+    /// protocol are ignored.
+    ///
+    /// \param data Pointer to the datagram
+    /// \param size Size of the datagram, in bytes
+    ///
+    /// \see update
+    ///
+    ////////////////////////////////////////////////////////////
+    void handleDatagram(const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the estimated round trip time to the remote peer
+    ///
+    /// The estimate is smoothed over the acknowledged
+    /// datagrams, and determines when messages are resent.
+    ///
+    /// \return Round trip time
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getRoundTripTime() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the time elapsed since the last datagram from the remote peer
+    ///
+    /// This can be used to detect that the peer is gone.
+    ///
+    /// \return Time since the last datagram received, or since the creation of the connection
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getTimeSinceLastReceive() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of reliable messages not acknowledged yet
+    ///
+    /// \return Number of reliable messages waiting for an acknowledgment
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getUnacknowledgedCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the statistics of the connection
+    ///
+    /// \return Statistics of the connection
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Statistics& getStatistics() const;
+
+private:
+    struct Impl;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::UdpConnection
+/// \ingroup network
+///
+/// TCP delivers all the data in order: a single lost segment
+/// delays everything sent after it (head-of-line blocking),
+/// which is a problem for real-time applications such as
+/// games. Raw UDP has no such delay, but datagrams may be lost,
+/// duplicated or reordered, and large datagrams are unreliable.
+///
+/// sf::UdpConnection adds the missing guarantees on top of
+/// sf::UdpSocket, message by message:
+/// \li each datagram carries a sequence number and acknowledges
+///     the last 33 datagrams received from the peer
+/// \li reliable messages are resent when they are not
+///     acknowledged within a delay derived from the measured
+///     round trip time, doubled after each resend, and only a
+///     limited number of their fragments are in flight at once
+/// \li large messages are split into fragments and reassembled
+/// \li ordered messages are delivered in order per channel, so
+///     independent streams of data don't delay each other
+///
+/// Both peers must use sf::UdpConnection. There is no
+/// handshake: the connection is established as soon as both
+/// peers have created it. Messages are read and written with
+/// sf::Packet, including derived classes such as
+/// sf::CompressedPacket.
+///
+/// The connection puts its socket in non-blocking mode, and
+/// leaves it that way.
+///
+/// Usage example:
+/// \code
+/// sf::UdpSocket socket;
+/// if (socket.bind(54000) != sf::Socket::Status::Done)
+/// {
+///     // Handle error...
+/// }
+///
+/// sf::UdpConnection connection(socket, serverAddress, 54000);
+///
+/// while (running)
+/// {
+///     // Chat messages must arrive, positions are useless once outdated
+///     sf::Packet chat;
+///     chat << "hello";
+///     (void)connection.send(chat, 1, sf::UdpConnection::Delivery::Ordered);
+///
+///     sf::Packet position;
+///     position << x << y;
+///     (void)connection.send(position, 0, sf::UdpConnection::Delivery::Unreliable);
+///
+///     connection.update();
+///
+///     sf::Packet   message;
+///     std::uint8_t channel = 0;
+///     while (connection.receive(message, channel))
+///     {
+///         // Handle message...
+///     }
+/// }
+/// \endcode
+///
+/// \see sf::UdpSocket, sf::Packet
+///
+////////////////////////////////////////////////////////////
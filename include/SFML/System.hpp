@@ -35,6 +35,7 @@
 #include <SFML/System/Err.hpp>
 #include <SFML/System/FileInputStream.hpp>
 #include <SFML/System/InputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
 #include <SFML/System/MemoryInputStream.hpp>
 #include <SFML/System/Sleep.hpp>
 #include <SFML/System/String.hpp>
@@ -0,0 +1,241 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.hpp>
+
+#include <SFML/System/Export.hpp>
+
+#include <SFML/System/InputStream.hpp>
+
+#include <filesystem>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Implementation of input stream based on a memory-mapped file
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API MappedFileInputStream : public InputStream
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief How the contents of the file will be accessed
+    ///
+    /// This is a hint given to the operating system, to decide
+    /// how much of the file to read ahead and how long to keep
+    /// it in memory.
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class AccessPattern
+    {
+        Normal,     //!< No particular access pattern
+        Sequential, //!< The file is read from the beginning to the end, pages can be read ahead aggressively
+        Random      //!< The file is read at random positions, reading ahead is wasted
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor, unmaps the file
+    ///
+    ////////////////////////////////////////////////////////////
+    ~MappedFileInputStream() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream(const MappedFileInputStream&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream& operator=(const MappedFileInputStream&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream(MappedFileInputStream&& other) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream& operator=(MappedFileInputStream&& other) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open the stream from a file path
+    ///
+    /// The whole file is mapped in the address space of the
+    /// process, its pages are read from the disk when they are
+    /// first accessed. Mapping fails on files that are not
+    /// regular files on disk, such as Android assets, and on
+    /// files too large for the address space; the file can be
+    /// opened with sf::FileInputStream instead.
+    ///
+    /// \warning The file must not be truncated while it is
+    /// mapped: accessing pages past its new end raises SIGBUS
+    /// on Unix, or an access violation on Windows, and crashes
+    /// the program. Prefer sf::FileInputStream for files that
+    /// stay open for long and may be modified meanwhile.
+    ///
+    /// \param filename      Name of the file to open
+    /// \param accessPattern How the contents of the file will be accessed
+    ///
+    /// \return True on success, false on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool open(const std::filesystem::path& filename, AccessPattern accessPattern = AccessPattern::Normal);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Close the stream and unmap the file
+    ///
+    ////////////////////////////////////////////////////////////
+    void close();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the access pattern hint of the open file
+    ///
+    /// On Windows, the hint can only be given when the file is
+    /// opened and this function has no effect.
+    ///
+    /// \param accessPattern How the contents of the file will be accessed
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAccessPattern(AccessPattern accessPattern);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a pointer to the contents of the file
+    ///
+    /// The contents can be accessed directly, without copying
+    /// them with read(). The pointer is valid until the stream
+    /// is closed or destroyed, and the memory is read-only.
+    ///
+    /// \return Pointer to the contents of the file, or a null pointer if the stream is not open or the file is empty
+    ///
+    /// \see getSize
+    ///
+    ////////////////////////////////////////////////////////////
+    const void* getData() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read data from the stream
+    ///
+    /// After reading, the stream's reading position must be
+    /// advanced by the amount of bytes read.
+    ///
+    /// \param data Buffer where to copy the read data
+    /// \param size Desired number of bytes to read
+    ///
+    /// \return The number of bytes actually read, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::int64_t read(void* data, std::int64_t size) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the current reading position
+    ///
+    /// \param position The position to seek to, from the beginning
+    ///
+    /// \return The position actually sought to, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::int64_t seek(std::int64_t position) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current reading position in the stream
+    ///
+    /// \return The current position, or -1 on error.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::int64_t tell() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the stream
+    ///
+    /// \return The total number of bytes available in the stream, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    std::int64_t getSize() override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const std::byte* m_data{};   //!< Pointer to the mapped contents of the file
+    std::int64_t     m_size{-1}; //!< Size of the file, or -1 if the stream is not open
+    std::int64_t     m_offset{}; //!< Current reading position
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::MappedFileInputStream
+/// \ingroup system
+///
+/// This class is a specialization of InputStream that
+/// reads from a file on disk mapped in memory.
+///
+/// Reading from a mapped file copies the data straight from
+/// the pages of the file, without the system calls and the
+/// intermediate buffer of sf::FileInputStream. Code that can
+/// work on data in memory can even skip the copy entirely,
+/// by accessing the contents of the file with getData().
+///
+/// SFML uses it to load images and sound buffers from files,
+/// and to preload the glyphs of fonts, when the file can be
+/// mapped. Fonts, musics and sf::InputSoundFile otherwise read
+/// their files with stdio: they keep them open for as long as
+/// they live, and a mapping can't survive the file being
+/// truncated.
+///
+/// Usage example:
+/// \code
+/// void process(const void* data, std::size_t size);
+///
+/// MappedFileInputStream stream;
+/// if (stream.open("some_file.dat", MappedFileInputStream::AccessPattern::Sequential))
+///    process(stream.getData(), static_cast<std::size_t>(stream.getSize()));
+/// \endcode
+///
+/// InputStream, FileInputStream, MemoryInputStream
+///
+////////////////////////////////////////////////////////////
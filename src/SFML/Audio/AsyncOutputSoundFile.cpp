@@ -0,0 +1,254 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/AsyncOutputSoundFile.hpp>
+#include <SFML/Audio/OutputSoundFile.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct AsyncOutputSoundFile::Impl
+{
+    struct Block
+    {
+        std::vector<std::int16_t> samples;      //!< Integer samples to write
+        std::vector<float>        floatSamples; //!< Float samples to write, if the block has no integer samples
+    };
+
+    explicit Impl(std::size_t maxBlocks) : maxQueuedBlocks(std::max(maxBlocks, std::size_t{1}))
+    {
+    }
+
+    void work();
+
+    template <typename T>
+    bool push(const T* samples, std::uint64_t count);
+
+    void finish();
+
+    OutputSoundFile         file;                //!< File being written, only used by the thread while it runs
+    const std::size_t       maxQueuedBlocks;     //!< Maximum number of blocks in the queue
+    std::thread             thread;              //!< Thread writing the blocks, only used by the owner of the file
+    mutable std::mutex      mutex;               //!< Protects everything below
+    std::condition_variable condition;           //!< Wakes the thread up when a block is queued
+    std::condition_variable written;             //!< Wakes flush() up when a block is written
+    std::deque<Block>       queue;               //!< Blocks waiting to be written
+    std::vector<Block>      freeBlocks;          //!< Written blocks, whose memory is reused for the next ones
+    std::uint64_t           droppedBlockCount{}; //!< Number of blocks dropped because the queue was full
+    bool                    open{};              //!< Are new blocks accepted?
+    bool                    writing{};           //!< Is the thread writing a block?
+    bool                    stopping{};          //!< Is the thread asked to stop?
+};
+
+
+////////////////////////////////////////////////////////////
+void AsyncOutputSoundFile::Impl::work()
+{
+    std::unique_lock lock(mutex);
+
+    for (;;)
+    {
+        condition.wait(lock, [this] { return stopping || !queue.empty(); });
+
+        // Only stop once everything queued is written
+        if (queue.empty())
+            return;
+
+        Block block = std::move(queue.front());
+        queue.pop_front();
+        writing = true;
+
+        // Encoding takes a while, don't hold the lock meanwhile
+        lock.unlock();
+
+        if (!block.samples.empty())
+            file.write(block.samples.data(), block.samples.size());
+        else
+            file.write(block.floatSamples.data(), block.floatSamples.size());
+
+        lock.lock();
+
+        block.samples.clear();
+        block.floatSamples.clear();
+        freeBlocks.push_back(std::move(block));
+        writing = false;
+        written.notify_all();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+bool AsyncOutputSoundFile::Impl::push(const T* samples, std::uint64_t count)
+{
+    if (!samples || !count)
+        return false;
+
+    const std::lock_guard lock(mutex);
+
+    // The thread object can't be used here, it is joined without holding the lock
+    if (!open)
+        return false;
+
+    if (queue.size() >= maxQueuedBlocks)
+    {
+        ++droppedBlockCount;
+        return false;
+    }
+
+    Block block;
+    if (!freeBlocks.empty())
+    {
+        block = std::move(freeBlocks.back());
+        freeBlocks.pop_back();
+    }
+
+    if constexpr (std::is_same_v<T, float>)
+        block.floatSamples.assign(samples, samples + count);
+    else
+        block.samples.assign(samples, samples + count);
+
+    queue.push_back(std::move(block));
+    condition.notify_one();
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void AsyncOutputSoundFile::Impl::finish()
+{
+    {
+        const std::lock_guard lock(mutex);
+        if (!open)
+            return;
+
+        // Refuse new blocks from now on, the ones already queued are still written
+        open     = false;
+        stopping = true;
+    }
+    condition.notify_one();
+
+    thread.join();
+    file.close();
+
+    const std::lock_guard lock(mutex);
+    stopping = false;
+}
+
+
+////////////////////////////////////////////////////////////
+AsyncOutputSoundFile::AsyncOutputSoundFile(std::size_t maxQueuedBlocks) :
+m_impl(std::make_unique<Impl>(maxQueuedBlocks))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+AsyncOutputSoundFile::~AsyncOutputSoundFile()
+{
+    close();
+}
+
+
+////////////////////////////////////////////////////////////
+bool AsyncOutputSoundFile::openFromFile(const std::filesystem::path& filename,
+                                        unsigned int                 sampleRate,
+                                        unsigned int                 channelCount,
+                                        SampleFormat                 sampleFormat)
+{
+    // If a file is already open, first write its samples and close it
+    close();
+
+    if (!m_impl->file.openFromFile(filename, sampleRate, channelCount, sampleFormat))
+        return false;
+
+    const std::lock_guard lock(m_impl->mutex);
+    m_impl->droppedBlockCount = 0;
+    m_impl->thread            = std::thread(&Impl::work, m_impl.get());
+    m_impl->open              = true;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool AsyncOutputSoundFile::write(const std::int16_t* samples, std::uint64_t count)
+{
+    return m_impl->push(samples, count);
+}
+
+
+////////////////////////////////////////////////////////////
+bool AsyncOutputSoundFile::write(const float* samples, std::uint64_t count)
+{
+    return m_impl->push(samples, count);
+}
+
+
+////////////////////////////////////////////////////////////
+void AsyncOutputSoundFile::flush()
+{
+    std::unique_lock lock(m_impl->mutex);
+    m_impl->written.wait(lock, [this] { return m_impl->queue.empty() && !m_impl->writing; });
+}
+
+
+////////////////////////////////////////////////////////////
+void AsyncOutputSoundFile::close()
+{
+    m_impl->finish();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t AsyncOutputSoundFile::getQueuedBlockCount() const
+{
+    const std::lock_guard lock(m_impl->mutex);
+    return m_impl->queue.size() + (m_impl->writing ? 1 : 0);
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t AsyncOutputSoundFile::getDroppedBlockCount() const
+{
+    const std::lock_guard lock(m_impl->mutex);
+    return m_impl->droppedBlockCount;
+}
+
+} // namespace sf
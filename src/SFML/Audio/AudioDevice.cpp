@@ -123,7 +123,7 @@ bool AudioDevice::isExtensionSupported(const std::string& extension)
 
 
 ////////////////////////////////////////////////////////////
-int AudioDevice::getFormatFromChannelCount(unsigned int channelCount)
+int AudioDevice::getFormatFromChannelCount(unsigned int channelCount, SampleFormat sampleFormat)
 {
     // Create a temporary audio device in case none exists yet.
     // This device will not be used in this function and merely
@@ -136,18 +136,40 @@ int AudioDevice::getFormatFromChannelCount(unsigned int channelCount)
     // Find the good format according to the number of channels
     int format = 0;
 
-    // clang-format off
-    switch (channelCount)
+    if (sampleFormat == SampleFormat::Float32)
     {
-        case 1:  format = AL_FORMAT_MONO16;                    break;
-        case 2:  format = AL_FORMAT_STEREO16;                  break;
-        case 4:  format = alGetEnumValue("AL_FORMAT_QUAD16");  break;
-        case 6:  format = alGetEnumValue("AL_FORMAT_51CHN16"); break;
-        case 7:  format = alGetEnumValue("AL_FORMAT_61CHN16"); break;
-        case 8:  format = alGetEnumValue("AL_FORMAT_71CHN16"); break;
-        default: format = 0;                                   break;
+        // Float formats are only available through extensions
+        if (alIsExtensionPresent("AL_EXT_float32") == AL_FALSE)
+            return 0;
+
+        // clang-format off
+        switch (channelCount)
+        {
+            case 1:  format = alGetEnumValue("AL_FORMAT_MONO_FLOAT32");   break;
+            case 2:  format = alGetEnumValue("AL_FORMAT_STEREO_FLOAT32"); break;
+            case 4:  format = alGetEnumValue("AL_FORMAT_QUAD32");         break;
+            case 6:  format = alGetEnumValue("AL_FORMAT_51CHN32");        break;
+            case 7:  format = alGetEnumValue("AL_FORMAT_61CHN32");        break;
+            case 8:  format = alGetEnumValue("AL_FORMAT_71CHN32");        break;
+            default: format = 0;                                          break;
+        }
+        // clang-format on
+    }
+    else
+    {
+        // clang-format off
+        switch (channelCount)
+        {
+            case 1:  format = AL_FORMAT_MONO16;                    break;
+            case 2:  format = AL_FORMAT_STEREO16;                  break;
+            case 4:  format = alGetEnumValue("AL_FORMAT_QUAD16");  break;
+            case 6:  format = alGetEnumValue("AL_FORMAT_51CHN16"); break;
+            case 7:  format = alGetEnumValue("AL_FORMAT_61CHN16"); break;
+            case 8:  format = alGetEnumValue("AL_FORMAT_71CHN16"); break;
+            default: format = 0;                                   break;
+        }
+        // clang-format on
     }
-    // clang-format on
 
     // Fixes a bug on OS X
     if (format == -1)
@@ -27,6 +27,8 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Audio/SampleFormat.hpp>
+
 #include <SFML/System/Vector3.hpp>
 
 #include <string>
@@ -72,12 +74,16 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Get the OpenAL format that matches the given number of channels
     ///
+    /// Float formats require the AL_EXT_float32 extension, 0 is
+    /// returned if the device doesn't support it.
+    ///
     /// \param channelCount Number of channels
+    /// \param sampleFormat Format of the samples
     ///
-    /// \return Corresponding format
+    /// \return Corresponding format, or 0 if there is none
     ///
     ////////////////////////////////////////////////////////////
-    static int getFormatFromChannelCount(unsigned int channelCount);
+    static int getFormatFromChannelCount(unsigned int channelCount, SampleFormat sampleFormat = SampleFormat::Int16);
 
     ////////////////////////////////////////////////////////////
     /// \brief Change the global volume of all the sounds and musics
@@ -0,0 +1,302 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/BiquadFilter.hpp>
+#include <SFML/Audio/Simd.hpp>
+
+#include <algorithm>
+#include <type_traits>
+
+#include <cmath>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+BiquadFilter::BiquadFilter(Type type, float frequency, float q, float gain) :
+m_type(type),
+m_frequency(frequency),
+m_q(q),
+m_gain(gain)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void BiquadFilter::setType(Type type)
+{
+    m_type       = type;
+    m_needUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void BiquadFilter::setFrequency(float frequency)
+{
+    m_frequency  = frequency;
+    m_needUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void BiquadFilter::setQ(float q)
+{
+    m_q          = q;
+    m_needUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void BiquadFilter::setGain(float gain)
+{
+    m_gain       = gain;
+    m_needUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+BiquadFilter::Type BiquadFilter::getType() const
+{
+    return m_type;
+}
+
+
+////////////////////////////////////////////////////////////
+float BiquadFilter::getFrequency() const
+{
+    return m_frequency;
+}
+
+
+////////////////////////////////////////////////////////////
+float BiquadFilter::getQ() const
+{
+    return m_q;
+}
+
+
+////////////////////////////////////////////////////////////
+float BiquadFilter::getGain() const
+{
+    return m_gain;
+}
+
+
+////////////////////////////////////////////////////////////
+void BiquadFilter::process(float* samples, std::size_t frameCount, unsigned int channelCount, unsigned int sampleRate)
+{
+    if (m_needUpdate.exchange(false) || (sampleRate != m_sampleRate))
+        updateCoefficients(sampleRate);
+
+    if (m_states.size() != channelCount)
+        m_states.assign(channelCount, State());
+
+    // Transposed direct form II, which behaves well with float precision
+    unsigned int channel = 0;
+
+#ifdef SFML_AUDIO_SSE
+    // Filter groups of 4 or 2 neighbour channels at once, each lane holding one channel
+    const auto filterLanes = [&](auto lanes)
+    {
+        constexpr unsigned int laneCount = decltype(lanes)::value;
+
+        const auto load = [](const float* source)
+        {
+            if constexpr (laneCount == 4)
+                return _mm_loadu_ps(source);
+            else
+                return _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(source));
+        };
+        const auto store = [](float* target, __m128 value)
+        {
+            if constexpr (laneCount == 4)
+                _mm_storeu_ps(target, value);
+            else
+                _mm_storel_pi(reinterpret_cast<__m64*>(target), value);
+        };
+
+        alignas(16) float z1s[4]{};
+        alignas(16) float z2s[4]{};
+        for (unsigned int lane = 0; lane < laneCount; ++lane)
+        {
+            z1s[lane] = m_states[channel + lane].z1;
+            z2s[lane] = m_states[channel + lane].z2;
+        }
+
+        const __m128 b0 = _mm_set1_ps(m_b0);
+        const __m128 b1 = _mm_set1_ps(m_b1);
+        const __m128 b2 = _mm_set1_ps(m_b2);
+        const __m128 a1 = _mm_set1_ps(m_a1);
+        const __m128 a2 = _mm_set1_ps(m_a2);
+        __m128       z1 = _mm_load_ps(z1s);
+        __m128       z2 = _mm_load_ps(z2s);
+
+        for (float* sample = samples + channel; sample < samples + frameCount * channelCount; sample += channelCount)
+        {
+            const __m128 input  = load(sample);
+            const __m128 output = _mm_add_ps(_mm_mul_ps(b0, input), z1);
+            z1 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(b1, input), _mm_mul_ps(a1, output)), z2);
+            z2 = _mm_sub_ps(_mm_mul_ps(b2, input), _mm_mul_ps(a2, output));
+            store(sample, output);
+        }
+
+        _mm_store_ps(z1s, z1);
+        _mm_store_ps(z2s, z2);
+        for (unsigned int lane = 0; lane < laneCount; ++lane)
+        {
+            m_states[channel + lane].z1 = z1s[lane];
+            m_states[channel + lane].z2 = z2s[lane];
+        }
+
+        channel += laneCount;
+    };
+
+    while (channel + 4 <= channelCount)
+        filterLanes(std::integral_constant<unsigned int, 4>());
+    if (channel + 2 <= channelCount)
+        filterLanes(std::integral_constant<unsigned int, 2>());
+#endif
+
+    for (; channel < channelCount; ++channel)
+    {
+        State& state = m_states[channel];
+        float  z1    = state.z1;
+        float  z2    = state.z2;
+
+        for (float* sample = samples + channel; sample < samples + frameCount * channelCount; sample += channelCount)
+        {
+            const float input  = *sample;
+            const float output = m_b0 * input + z1;
+            z1                 = m_b1 * input - m_a1 * output + z2;
+            z2                 = m_b2 * input - m_a2 * output;
+            *sample            = output;
+        }
+
+        state.z1 = z1;
+        state.z2 = z2;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void BiquadFilter::reset()
+{
+    m_states.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+void BiquadFilter::updateCoefficients(unsigned int sampleRate)
+{
+    m_sampleRate = sampleRate;
+
+    // Formulas from the Audio EQ Cookbook by Robert Bristow-Johnson
+    const double nyquist   = sampleRate / 2.0;
+    const double frequency = std::clamp(static_cast<double>(m_frequency), 1.0, nyquist * 0.99);
+    const double omega     = 2.0 * 3.141592653589793 * frequency / sampleRate;
+    const double cosine    = std::cos(omega);
+    const double alpha     = std::sin(omega) / (2.0 * std::max(static_cast<double>(m_q), 0.001));
+    const double amplitude = std::pow(10.0, static_cast<double>(m_gain) / 40.0);
+    const double shelf     = 2.0 * std::sqrt(amplitude) * alpha;
+
+    double b0 = 1;
+    double b1 = 0;
+    double b2 = 0;
+    double a0 = 1;
+    double a1 = 0;
+    double a2 = 0;
+
+    switch (m_type)
+    {
+        case Type::LowPass:
+            b0 = b2 = (1 - cosine) / 2;
+            b1      = 1 - cosine;
+            a0      = 1 + alpha;
+            a1      = -2 * cosine;
+            a2      = 1 - alpha;
+            break;
+
+        case Type::HighPass:
+            b0 = b2 = (1 + cosine) / 2;
+            b1      = -(1 + cosine);
+            a0      = 1 + alpha;
+            a1      = -2 * cosine;
+            a2      = 1 - alpha;
+            break;
+
+        case Type::BandPass:
+            b0 = alpha;
+            b1 = 0;
+            b2 = -alpha;
+            a0 = 1 + alpha;
+            a1 = -2 * cosine;
+            a2 = 1 - alpha;
+            break;
+
+        case Type::Notch:
+            b0 = b2 = 1;
+            b1 = a1 = -2 * cosine;
+            a0      = 1 + alpha;
+            a2      = 1 - alpha;
+            break;
+
+        case Type::Peak:
+            b0 = 1 + alpha * amplitude;
+            b1 = a1 = -2 * cosine;
+            b2      = 1 - alpha * amplitude;
+            a0      = 1 + alpha / amplitude;
+            a2      = 1 - alpha / amplitude;
+            break;
+
+        case Type::LowShelf:
+            b0 = amplitude * ((amplitude + 1) - (amplitude - 1) * cosine + shelf);
+            b1 = 2 * amplitude * ((amplitude - 1) - (amplitude + 1) * cosine);
+            b2 = amplitude * ((amplitude + 1) - (amplitude - 1) * cosine - shelf);
+            a0 = (amplitude + 1) + (amplitude - 1) * cosine + shelf;
+            a1 = -2 * ((amplitude - 1) + (amplitude + 1) * cosine);
+            a2 = (amplitude + 1) + (amplitude - 1) * cosine - shelf;
+            break;
+
+        case Type::HighShelf:
+            b0 = amplitude * ((amplitude + 1) + (amplitude - 1) * cosine + shelf);
+            b1 = -2 * amplitude * ((amplitude - 1) + (amplitude + 1) * cosine);
+            b2 = amplitude * ((amplitude + 1) + (amplitude - 1) * cosine - shelf);
+            a0 = (amplitude + 1) - (amplitude - 1) * cosine + shelf;
+            a1 = 2 * ((amplitude - 1) - (amplitude + 1) * cosine);
+            a2 = (amplitude + 1) - (amplitude - 1) * cosine - shelf;
+            break;
+    }
+
+    m_b0 = static_cast<float>(b0 / a0);
+    m_b1 = static_cast<float>(b1 / a0);
+    m_b2 = static_cast<float>(b2 / a0);
+    m_a1 = static_cast<float>(a1 / a0);
+    m_a2 = static_cast<float>(a2 / a0);
+}
+
+} // namespace sf
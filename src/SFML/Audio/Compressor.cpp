@@ -0,0 +1,183 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Compressor.hpp>
+
+#include <algorithm>
+
+#include <cmath>
+
+
+namespace
+{
+// Smoothing coefficient reaching about 63% of a change after the given time
+float smoothingCoefficient(sf::Time time, unsigned int sampleRate)
+{
+    const float samples = time.asSeconds() * static_cast<float>(sampleRate);
+    return samples > 0.f ? std::exp(-1.f / samples) : 0.f;
+}
+
+float toLinear(float decibels)
+{
+    return std::pow(10.f, decibels / 20.f);
+}
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+Compressor::Compressor(float threshold, float ratio) : m_threshold(threshold), m_ratio(ratio)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Compressor::setThreshold(float threshold)
+{
+    m_threshold = threshold;
+}
+
+
+////////////////////////////////////////////////////////////
+void Compressor::setRatio(float ratio)
+{
+    m_ratio = ratio;
+}
+
+
+////////////////////////////////////////////////////////////
+void Compressor::setAttack(Time attack)
+{
+    m_attack = attack;
+}
+
+
+////////////////////////////////////////////////////////////
+void Compressor::setRelease(Time release)
+{
+    m_release = release;
+}
+
+
+////////////////////////////////////////////////////////////
+void Compressor::setMakeupGain(float gain)
+{
+    m_makeupGain = gain;
+}
+
+
+////////////////////////////////////////////////////////////
+float Compressor::getThreshold() const
+{
+    return m_threshold;
+}
+
+
+////////////////////////////////////////////////////////////
+float Compressor::getRatio() const
+{
+    return m_ratio;
+}
+
+
+////////////////////////////////////////////////////////////
+Time Compressor::getAttack() const
+{
+    return m_attack;
+}
+
+
+////////////////////////////////////////////////////////////
+Time Compressor::getRelease() const
+{
+    return m_release;
+}
+
+
+////////////////////////////////////////////////////////////
+float Compressor::getMakeupGain() const
+{
+    return m_makeupGain;
+}
+
+
+////////////////////////////////////////////////////////////
+float Compressor::getGainReduction() const
+{
+    return m_gainReduction;
+}
+
+
+////////////////////////////////////////////////////////////
+void Compressor::process(float* samples, std::size_t frameCount, unsigned int channelCount, unsigned int sampleRate)
+{
+    // Read the parameters once per block, they may be changed by another thread
+    const float threshold       = m_threshold;
+    const float thresholdLinear = toLinear(threshold);
+    const float slope           = 1.f - 1.f / std::max(m_ratio.load(), 1.f);
+    const float attack          = smoothingCoefficient(m_attack, sampleRate);
+    const float release         = smoothingCoefficient(m_release, sampleRate);
+    const float makeupGain      = m_makeupGain;
+    const float makeupLinear    = toLinear(makeupGain);
+
+    float envelope = m_envelope;
+
+    for (float* frame = samples; frame < samples + frameCount * channelCount; frame += channelCount)
+    {
+        // Detect the level from the loudest channel, so that all channels are reduced together
+        float peak = 0.f;
+        for (unsigned int channel = 0; channel < channelCount; ++channel)
+            peak = std::max(peak, std::abs(frame[channel]));
+
+        // Gain reduction wanted for this frame, in dB
+        const float target = (peak > thresholdLinear) ? (20.f * std::log10(peak) - threshold) * slope : 0.f;
+
+        // Smooth it, quickly when the level rises and slowly when it falls
+        const float coefficient = (target > envelope) ? attack : release;
+        envelope                = target + coefficient * (envelope - target);
+
+        // Most of the time the signal is below the threshold, don't compute the gain then
+        const float gain = (envelope > 1e-4f) ? toLinear(makeupGain - envelope) : makeupLinear;
+        for (unsigned int channel = 0; channel < channelCount; ++channel)
+            frame[channel] *= gain;
+    }
+
+    m_envelope      = envelope;
+    m_gainReduction = envelope;
+}
+
+
+////////////////////////////////////////////////////////////
+void Compressor::reset()
+{
+    m_envelope      = 0.f;
+    m_gainReduction = 0.f;
+}
+
+} // namespace sf
@@ -34,10 +34,15 @@
 #include <SFML/System/InputStream.hpp>
 #include <SFML/System/MemoryInputStream.hpp>
 #include <SFML/System/Time.hpp>
+#include <SFML/System/Utils.hpp>
 
 #include <algorithm>
+#include <fstream>
+#include <memory>
+#include <optional>
 #include <ostream>
 #include <utility>
+#include <vector>
 
 
 namespace sf
@@ -65,6 +70,13 @@ void InputSoundFile::StreamDeleter::operator()(InputStream* ptr) const
 
 ////////////////////////////////////////////////////////////
 bool InputSoundFile::openFromFile(const std::filesystem::path& filename)
+{
+    return openFromFile(filename, {});
+}
+
+
+////////////////////////////////////////////////////////////
+bool InputSoundFile::openFromFile(const std::filesystem::path& filename, const std::filesystem::path& seekIndexFilename)
 {
     // If the file is already open, first close it
     close();
@@ -74,7 +86,21 @@ bool InputSoundFile::openFromFile(const std::filesystem::path& filename)
     if (!reader)
         return false;
 
-    // Wrap the file into a stream
+    // Give it the saved seek index, if any; a missing index is not an error, it may not have been saved yet
+    if (!seekIndexFilename.empty())
+    {
+        FileInputStream indexFile;
+        if (indexFile.open(seekIndexFilename))
+        {
+            std::vector<std::uint8_t> index(static_cast<std::size_t>(std::max<std::int64_t>(indexFile.getSize(), 0)));
+            if (indexFile.read(index.data(), static_cast<std::int64_t>(index.size())) ==
+                static_cast<std::int64_t>(index.size()))
+                reader->setSeekIndex(std::move(index));
+        }
+    }
+
+    // Wrap the file into a stream; it isn't mapped in memory, because the
+    // sound file may stay open for long and the file be truncated meanwhile
     auto file = std::make_unique<FileInputStream>();
 
     // Open it
@@ -253,6 +279,44 @@ std::uint64_t InputSoundFile::read(std::int16_t* samples, std::uint64_t maxCount
 }
 
 
+////////////////////////////////////////////////////////////
+std::uint64_t InputSoundFile::read(float* samples, std::uint64_t maxCount)
+{
+    std::uint64_t readSamples = 0;
+    if (m_reader && samples && maxCount)
+        readSamples = m_reader->readFloat(samples, maxCount);
+    m_sampleOffset += readSamples;
+    return readSamples;
+}
+
+
+////////////////////////////////////////////////////////////
+bool InputSoundFile::saveSeekIndex(const std::filesystem::path& filename)
+{
+    if (!m_reader)
+    {
+        err() << "Failed to save seek index (no file is open)" << std::endl;
+        return false;
+    }
+
+    const std::optional<std::vector<std::uint8_t>> index = m_reader->getSeekIndex();
+    if (!index)
+    {
+        err() << "Failed to save seek index (the format of the file doesn't use one)" << std::endl;
+        return false;
+    }
+
+    std::ofstream file(filename, std::ios_base::binary | std::ios_base::trunc);
+    if (!file.write(reinterpret_cast<const char*>(index->data()), static_cast<std::streamsize>(index->size())))
+    {
+        err() << "Failed to save seek index\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 void InputSoundFile::close()
 {
@@ -0,0 +1,592 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Mixer.hpp>
+#include <SFML/Audio/MixerEffect.hpp>
+#include <SFML/Audio/SampleConversion.hpp>
+#include <SFML/Audio/Simd.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <vector>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace
+{
+// The mix is computed in blocks of 10 ms, the effects never see larger blocks
+constexpr unsigned int blocksPerSecond = 100;
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct Mixer::Impl
+{
+    struct Parameters
+    {
+        float volume{1.f}; //!< Volume of the input, in the range [0, 1]
+        float pan{};       //!< Stereo position of the input, in the range [-1, 1]
+        float pitch{1.f};  //!< Pitch of the input
+    };
+
+    struct Input
+    {
+        InputId                   id{};           //!< Identifier of the input
+        const SoundBuffer*        buffer{};       //!< Sound buffer played by the input, if it is a sound
+        SoundStream*              stream{};       //!< Stream played by the input, if it is a stream
+        bool                      loop{};         //!< Does the sound restart when it ends?
+        std::uint64_t             bufferOffset{}; //!< Next sample to read from the sound buffer
+        unsigned int              channelCount{}; //!< Number of channels of the source
+        unsigned int              sampleRate{};   //!< Sample rate of the source
+        std::vector<float>        pending;        //!< Source samples not consumed by the resampler yet
+        double                    position{};     //!< Position of the next frame to mix in the pending samples
+        bool                      ended{};        //!< Has the source no more samples to provide?
+        Parameters                parameters;     //!< Parameters set by the user, protected by the mutex
+        Parameters                mixed;          //!< Copy of the parameters for the block being mixed
+        std::array<float, 2>      gains{};        //!< Left and right gains reached at the end of the last block
+        std::vector<MixerEffect*> effects;        //!< Chain of effects of the input
+        std::vector<float>        resampled;      //!< Block of samples resampled to the sample rate of the mix
+    };
+
+    Impl(unsigned int theChannelCount, unsigned int theSampleRate) :
+    channelCount(std::max(theChannelCount, 1u)),
+    sampleRate(std::max(theSampleRate, 1u)),
+    blockFrameCount(std::max(sampleRate / blocksPerSecond, 1u)),
+    output(blockFrameCount * channelCount)
+    {
+    }
+
+    Input* findInput(InputId id);
+
+    std::optional<InputId> addInput(Input input);
+
+    std::array<float, 2> getTargetGains(const Input& input) const;
+
+    void readSound(Input& input, std::size_t sampleCount);
+
+    bool readStream(Input& input);
+
+    void resample(Input& input, std::size_t frameCount);
+
+    void accumulate(Input& input, float* samples, std::size_t frameCount);
+
+    void mix(float* samples, std::size_t frameCount);
+
+    const unsigned int        channelCount;    //!< Number of channels of the mix
+    const unsigned int        sampleRate;      //!< Sample rate of the mix
+    const std::size_t         blockFrameCount; //!< Number of frames mixed at once
+    std::mutex                renderMutex;     //!< Held while mixing; the streams are decoded with this mutex only
+    mutable std::mutex        mutex;           //!< Protects the parameters of the inputs
+    std::vector<Input>        inputs;          //!< Sounds and streams being mixed
+    std::vector<MixerEffect*> effects;         //!< Chain of effects of the output
+    std::vector<float>        output;          //!< Block of mixed samples, for the stream
+    InputId                   nextId{1};       //!< Identifier of the next input
+
+    // Adding or removing inputs and effects requires both mutexes, reading them requires either
+};
+
+
+////////////////////////////////////////////////////////////
+Mixer::Impl::Input* Mixer::Impl::findInput(InputId id)
+{
+    const auto it = std::find_if(inputs.begin(), inputs.end(), [id](const Input& input) { return input.id == id; });
+    return (it != inputs.end()) ? &*it : nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Mixer::InputId> Mixer::Impl::addInput(Input input)
+{
+    // Allocate the buffers up front, so that mixing doesn't allocate in the common cases
+    input.mixed = input.parameters;
+    input.gains = getTargetGains(input);
+    input.resampled.resize(blockFrameCount * input.channelCount);
+    input.pending.reserve(blockFrameCount * input.channelCount * 4);
+
+    const std::lock_guard renderLock(renderMutex);
+    const std::lock_guard lock(mutex);
+    input.id = nextId++;
+    inputs.push_back(std::move(input));
+    return inputs.back().id;
+}
+
+
+////////////////////////////////////////////////////////////
+std::array<float, 2> Mixer::Impl::getTargetGains(const Input& input) const
+{
+    // Balance law: the centered input keeps its level on both sides
+    const Parameters& mixed = input.mixed;
+    if (channelCount == 2)
+        return {mixed.volume * std::min(1.f - mixed.pan, 1.f), mixed.volume * std::min(1.f + mixed.pan, 1.f)};
+
+    return {mixed.volume, mixed.volume};
+}
+
+
+////////////////////////////////////////////////////////////
+void Mixer::Impl::readSound(Input& input, std::size_t sampleCount)
+{
+    // The samples may have been released from memory since the sound was added
+    const std::int16_t* samples      = input.buffer->getSamples();
+    const float*        floatSamples = input.buffer->getFloatSamples();
+    const std::uint64_t totalCount   = input.buffer->getSampleCount();
+    if ((!samples && !floatSamples) || (totalCount == 0))
+    {
+        input.ended = true;
+        return;
+    }
+
+    while (sampleCount > 0)
+    {
+        if (input.bufferOffset >= totalCount)
+        {
+            if (!input.loop)
+            {
+                input.ended = true;
+                return;
+            }
+
+            input.bufferOffset = 0;
+        }
+
+        const std::uint64_t remaining = totalCount - input.bufferOffset;
+        const auto          count     = static_cast<std::size_t>(std::min<std::uint64_t>(sampleCount, remaining));
+        const std::size_t   offset    = input.pending.size();
+        input.pending.resize(offset + count);
+
+        float* target = input.pending.data() + offset;
+        if (floatSamples)
+            std::copy(floatSamples + input.bufferOffset, floatSamples + input.bufferOffset + count, target);
+        else
+            priv::toFloatSamples(samples + input.bufferOffset, count, target);
+
+        input.bufferOffset += count;
+        sampleCount -= count;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool Mixer::Impl::readStream(Input& input)
+{
+    SoundStream::Chunk chunk{nullptr, 0};
+    const bool         more = input.stream->onGetData(chunk);
+
+    const std::size_t offset = input.pending.size();
+    if ((input.stream->getSampleFormat() == SampleFormat::Float32) && chunk.floatSamples)
+    {
+        input.pending.insert(input.pending.end(), chunk.floatSamples, chunk.floatSamples + chunk.sampleCount);
+    }
+    else if (chunk.samples)
+    {
+        input.pending.resize(offset + chunk.sampleCount);
+        priv::toFloatSamples(chunk.samples, chunk.sampleCount, input.pending.data() + offset);
+    }
+
+    input.ended = !more;
+
+    return input.pending.size() != offset;
+}
+
+
+////////////////////////////////////////////////////////////
+void Mixer::Impl::resample(Input& input, std::size_t frameCount)
+{
+    const std::size_t channels = input.channelCount;
+    const double      pitch    = static_cast<double>(input.mixed.pitch);
+    const double      step     = static_cast<double>(input.sampleRate) / sampleRate * pitch;
+
+    // Read enough source frames to interpolate the whole block
+    const auto neededFrames = static_cast<std::size_t>(input.position + step * static_cast<double>(frameCount - 1)) + 2;
+    while (!input.ended && (input.pending.size() < neededFrames * channels))
+    {
+        if (input.buffer)
+            readSound(input, neededFrames * channels - input.pending.size());
+        else if (!readStream(input))
+            break;
+    }
+
+    const std::size_t availableFrames = input.pending.size() / channels;
+    const float*      source          = input.pending.data();
+    float*            target          = input.resampled.data();
+
+    if ((step == 1.0) && (input.position == std::floor(input.position)))
+    {
+        // Same rate and no fractional position: copy the frames as they are
+        const auto        first = static_cast<std::size_t>(input.position);
+        const std::size_t count = std::min(frameCount, availableFrames - std::min(first, availableFrames));
+        std::copy(source + first * channels, source + (first + count) * channels, target);
+        std::fill(target + count * channels, target + frameCount * channels, 0.f);
+    }
+    else
+    {
+        std::size_t frame = 0;
+
+#ifdef SFML_AUDIO_SSE
+        // Stereo sources: interpolate two frames at once, as long as all their source frames are available
+        if (channels == 2)
+        {
+            for (; frame + 2 <= frameCount; frame += 2)
+            {
+                const double first  = input.position + step * static_cast<double>(frame);
+                const double second = input.position + step * static_cast<double>(frame + 1);
+                const auto   index0 = static_cast<std::size_t>(first);
+                const auto   index1 = static_cast<std::size_t>(second);
+                if (index1 + 1 >= availableFrames)
+                    break;
+
+                const auto   weight0 = static_cast<float>(first - static_cast<double>(index0));
+                const auto   weight1 = static_cast<float>(second - static_cast<double>(index1));
+                const __m128 frames0 = _mm_loadu_ps(source + index0 * 2); // a0 left, a0 right, b0 left, b0 right
+                const __m128 frames1 = _mm_loadu_ps(source + index1 * 2); // a1 left, a1 right, b1 left, b1 right
+                const __m128 a       = _mm_movelh_ps(frames0, frames1);
+                const __m128 b       = _mm_movehl_ps(frames1, frames0);
+                const __m128 weight  = _mm_setr_ps(weight0, weight0, weight1, weight1);
+                _mm_storeu_ps(target + frame * 2, _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), weight)));
+            }
+        }
+#endif
+
+        // Linear interpolation between the two closest source frames; past the end of the source, fade to silence
+        for (; frame < frameCount; ++frame)
+        {
+            const double      position = input.position + step * static_cast<double>(frame);
+            const auto        index    = static_cast<std::size_t>(position);
+            const auto        weight   = static_cast<float>(position - static_cast<double>(index));
+            const float*      current  = source + index * channels;
+            const std::size_t offset   = frame * channels;
+
+            for (std::size_t channel = 0; channel < channels; ++channel)
+            {
+                const float a = (index < availableFrames) ? current[channel] : 0.f;
+                const float b = (index + 1 < availableFrames) ? current[channel + channels] : 0.f;
+                target[offset + channel] = a + (b - a) * weight;
+            }
+        }
+    }
+
+    // Drop the source frames that won't be needed anymore
+    input.position += step * static_cast<double>(frameCount);
+    const std::size_t consumed = std::min(static_cast<std::size_t>(input.position), availableFrames);
+    const auto consumedEnd = input.pending.begin() + static_cast<std::ptrdiff_t>(consumed * channels);
+    input.pending.erase(input.pending.begin(), consumedEnd);
+    input.position -= static_cast<double>(consumed);
+}
+
+
+////////////////////////////////////////////////////////////
+void Mixer::Impl::accumulate(Input& input, float* samples, std::size_t frameCount)
+{
+    // Ramp the gains from their previous values to the current ones, to avoid clicks
+    const std::array<float, 2> startGains = input.gains;
+    const std::array<float, 2> endGains   = getTargetGains(input);
+    const float                stepLeft   = (endGains[0] - startGains[0]) / static_cast<float>(frameCount);
+    const float                stepRight  = (endGains[1] - startGains[1]) / static_cast<float>(frameCount);
+    input.gains                           = endGains;
+
+    const float*       source         = input.resampled.data();
+    const unsigned int sourceChannels = input.channelCount;
+    std::size_t        frame          = 0;
+
+#ifdef SFML_AUDIO_SSE
+    // Stereo output of mono and stereo sources: mix two frames at once
+    if ((channelCount == 2) && (sourceChannels <= 2))
+    {
+        const __m128 startGain = _mm_setr_ps(startGains[0], startGains[1], startGains[0], startGains[1]);
+        const __m128 gainStep  = _mm_setr_ps(stepLeft, stepRight, stepLeft, stepRight);
+
+        for (; frame + 2 <= frameCount; frame += 2)
+        {
+            const auto   next  = static_cast<float>(frame + 1);
+            const auto   after = static_cast<float>(frame + 2);
+            const __m128 gain  = _mm_add_ps(startGain, _mm_mul_ps(gainStep, _mm_setr_ps(next, next, after, after)));
+            const __m128 in    = (sourceChannels == 2)
+                                     ? _mm_loadu_ps(source + frame * 2)
+                                     : _mm_setr_ps(source[frame], source[frame], source[frame + 1], source[frame + 1]);
+            float*       out   = samples + frame * 2;
+            _mm_storeu_ps(out, _mm_add_ps(_mm_loadu_ps(out), _mm_mul_ps(in, gain)));
+        }
+    }
+#endif
+
+    for (; frame < frameCount; ++frame)
+    {
+        const float  left  = startGains[0] + stepLeft * static_cast<float>(frame + 1);
+        const float  right = startGains[1] + stepRight * static_cast<float>(frame + 1);
+        const float* in    = source + frame * sourceChannels;
+        float*       out   = samples + frame * channelCount;
+
+        if (channelCount == 2)
+        {
+            // Mono sources are spread on both sides, other sources only give their first two channels
+            out[0] += in[0] * left;
+            out[1] += in[sourceChannels > 1 ? 1 : 0] * right;
+        }
+        else if (channelCount == 1)
+        {
+            // Down-mix all the channels of the source
+            float sum = 0.f;
+            for (unsigned int channel = 0; channel < sourceChannels; ++channel)
+                sum += in[channel];
+            out[0] += sum / static_cast<float>(sourceChannels) * left;
+        }
+        else
+        {
+            // Mono sources go to all channels, other sources to the matching channels
+            for (unsigned int channel = 0; channel < channelCount; ++channel)
+            {
+                if (sourceChannels == 1)
+                    out[channel] += in[0] * left;
+                else if (channel < sourceChannels)
+                    out[channel] += in[channel] * left;
+            }
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Mixer::Impl::mix(float* samples, std::size_t frameCount)
+{
+    // Decoding the streams takes a while, so the parameters are copied and the mix is computed without the mutex
+    {
+        const std::lock_guard lock(mutex);
+        for (Input& input : inputs)
+            input.mixed = input.parameters;
+    }
+
+    std::fill(samples, samples + frameCount * channelCount, 0.f);
+
+    for (Input& input : inputs)
+    {
+        resample(input, frameCount);
+
+        for (MixerEffect* effect : input.effects)
+            effect->process(input.resampled.data(), frameCount, input.channelCount, sampleRate);
+
+        accumulate(input, samples, frameCount);
+    }
+
+    // Remove the inputs that have played all their samples
+    {
+        const std::lock_guard lock(mutex);
+        inputs.erase(std::remove_if(inputs.begin(),
+                                    inputs.end(),
+                                    [](const Input& input) { return input.ended && input.pending.empty(); }),
+                     inputs.end());
+    }
+
+    for (MixerEffect* effect : effects)
+        effect->process(samples, frameCount, channelCount, sampleRate);
+}
+
+
+////////////////////////////////////////////////////////////
+Mixer::Mixer(unsigned int channelCount, unsigned int sampleRate) :
+m_impl(std::make_unique<Impl>(channelCount, sampleRate))
+{
+    initialize(m_impl->channelCount, m_impl->sampleRate, SampleFormat::Float32);
+}
+
+
+////////////////////////////////////////////////////////////
+Mixer::~Mixer()
+{
+    // We must stop before destroying the inputs, as our stream thread reads them
+    stop();
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Mixer::InputId> Mixer::addSound(const SoundBuffer& buffer, bool loop)
+{
+    if ((!buffer.getSamples() && !buffer.getFloatSamples()) || (buffer.getChannelCount() == 0))
+        return std::nullopt;
+
+    Impl::Input input;
+    input.buffer       = &buffer;
+    input.loop         = loop;
+    input.channelCount = buffer.getChannelCount();
+    input.sampleRate   = buffer.getSampleRate();
+
+    return m_impl->addInput(std::move(input));
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Mixer::InputId> Mixer::addStream(SoundStream& stream)
+{
+    if ((&stream == this) || (stream.getChannelCount() == 0) || (stream.getSampleRate() == 0))
+        return std::nullopt;
+
+    Impl::Input input;
+    input.stream       = &stream;
+    input.channelCount = stream.getChannelCount();
+    input.sampleRate   = stream.getSampleRate();
+
+    return m_impl->addInput(std::move(input));
+}
+
+
+////////////////////////////////////////////////////////////
+void Mixer::removeInput(InputId id)
+{
+    const std::lock_guard renderLock(m_impl->renderMutex);
+    const std::lock_guard lock(m_impl->mutex);
+
+    auto& inputs = m_impl->inputs;
+    inputs.erase(std::remove_if(inputs.begin(),
+                                inputs.end(),
+                                [id](const Impl::Input& input) { return input.id == id; }),
+                 inputs.end());
+}
+
+
+////////////////////////////////////////////////////////////
+bool Mixer::hasInput(InputId id) const
+{
+    const std::lock_guard lock(m_impl->mutex);
+    return m_impl->findInput(id) != nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Mixer::getInputCount() const
+{
+    const std::lock_guard lock(m_impl->mutex);
+    return m_impl->inputs.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void Mixer::setInputVolume(InputId id, float volume)
+{
+    const std::lock_guard lock(m_impl->mutex);
+    if (Impl::Input* input = m_impl->findInput(id))
+        input->parameters.volume = std::clamp(volume, 0.f, 100.f) / 100.f;
+}
+
+
+////////////////////////////////////////////////////////////
+void Mixer::setInputPan(InputId id, float pan)
+{
+    const std::lock_guard lock(m_impl->mutex);
+    if (Impl::Input* input = m_impl->findInput(id))
+        input->parameters.pan = std::clamp(pan, -1.f, 1.f);
+}
+
+
+////////////////////////////////////////////////////////////
+void Mixer::setInputPitch(InputId id, float pitch)
+{
+    const std::lock_guard lock(m_impl->mutex);
+    if (Impl::Input* input = m_impl->findInput(id))
+        input->parameters.pitch = std::max(pitch, 0.001f);
+}
+
+
+////////////////////////////////////////////////////////////
+void Mixer::addEffect(MixerEffect& effect)
+{
+    const std::lock_guard renderLock(m_impl->renderMutex);
+    const std::lock_guard lock(m_impl->mutex);
+    effect.reset();
+    m_impl->effects.push_back(&effect);
+}
+
+
+////////////////////////////////////////////////////////////
+void Mixer::addEffect(InputId id, MixerEffect& effect)
+{
+    const std::lock_guard renderLock(m_impl->renderMutex);
+    const std::lock_guard lock(m_impl->mutex);
+    if (Impl::Input* input = m_impl->findInput(id))
+    {
+        effect.reset();
+        input->effects.push_back(&effect);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Mixer::removeEffect(MixerEffect& effect)
+{
+    const std::lock_guard renderLock(m_impl->renderMutex);
+    const std::lock_guard lock(m_impl->mutex);
+
+    const auto removeFrom = [&effect](std::vector<MixerEffect*>& chain)
+    { chain.erase(std::remove(chain.begin(), chain.end(), &effect), chain.end()); };
+
+    removeFrom(m_impl->effects);
+    for (Impl::Input& input : m_impl->inputs)
+        removeFrom(input.effects);
+}
+
+
+////////////////////////////////////////////////////////////
+void Mixer::render(float* samples, std::size_t frameCount)
+{
+    const std::lock_guard lock(m_impl->renderMutex);
+
+    // Mix in blocks, the effects and the buffers of the inputs are sized for them
+    while (frameCount > 0)
+    {
+        const std::size_t count = std::min(frameCount, m_impl->blockFrameCount);
+        m_impl->mix(samples, count);
+        samples += count * m_impl->channelCount;
+        frameCount -= count;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool Mixer::onGetData(Chunk& data)
+{
+    render(m_impl->output.data(), m_impl->blockFrameCount);
+
+    data.samples      = nullptr;
+    data.floatSamples = m_impl->output.data();
+    data.sampleCount  = m_impl->output.size();
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void Mixer::onSeek(Time /* timeOffset */)
+{
+}
+
+} // namespace sf
@@ -51,24 +51,38 @@ Music::~Music()
 
 
 ////////////////////////////////////////////////////////////
-bool Music::openFromFile(const std::filesystem::path& filename)
+bool Music::openFromFile(const std::filesystem::path& filename, SampleFormat sampleFormat)
+{
+    return openFromFile(filename, std::filesystem::path(), sampleFormat);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Music::openFromFile(const std::filesystem::path& filename,
+                         const std::filesystem::path& seekIndexFilename,
+                         SampleFormat                 sampleFormat)
 {
     // First stop the music if it was already running
     stop();
 
     // Open the underlying sound file
-    if (!m_file.openFromFile(filename))
+    if (!m_file.openFromFile(filename, seekIndexFilename))
         return false;
 
+    // Remember where the file is, to scan it again in saveSeekIndex
+    m_filename = filename;
+    m_data     = nullptr;
+    m_dataSize = 0;
+
     // Perform common initializations
-    initialize();
+    initialize(sampleFormat);
 
     return true;
 }
 
 
 ////////////////////////////////////////////////////////////
-bool Music::openFromMemory(const void* data, std::size_t sizeInBytes)
+bool Music::openFromMemory(const void* data, std::size_t sizeInBytes, SampleFormat sampleFormat)
 {
     // First stop the music if it was already running
     stop();
@@ -77,15 +91,20 @@ bool Music::openFromMemory(const void* data, std::size_t sizeInBytes)
     if (!m_file.openFromMemory(data, sizeInBytes))
         return false;
 
+    // Remember where the file is, to scan it again in saveSeekIndex
+    m_filename.clear();
+    m_data     = data;
+    m_dataSize = sizeInBytes;
+
     // Perform common initializations
-    initialize();
+    initialize(sampleFormat);
 
     return true;
 }
 
 
 ////////////////////////////////////////////////////////////
-bool Music::openFromStream(InputStream& stream)
+bool Music::openFromStream(InputStream& stream, SampleFormat sampleFormat)
 {
     // First stop the music if it was already running
     stop();
@@ -94,8 +113,13 @@ bool Music::openFromStream(InputStream& stream)
     if (!m_file.openFromStream(stream))
         return false;
 
+    // A stream can't be read again by another reader
+    m_filename.clear();
+    m_data     = nullptr;
+    m_dataSize = 0;
+
     // Perform common initializations
-    initialize();
+    initialize(sampleFormat);
 
     return true;
 }
@@ -108,6 +132,28 @@ Time Music::getDuration() const
 }
 
 
+////////////////////////////////////////////////////////////
+bool Music::saveSeekIndex(const std::filesystem::path& filename)
+{
+    // Scan the file with a reader of its own, so that the streaming thread isn't blocked meanwhile
+    if (!m_filename.empty())
+    {
+        InputSoundFile file;
+        return file.openFromFile(m_filename) && file.saveSeekIndex(filename);
+    }
+
+    if (m_data)
+    {
+        InputSoundFile file;
+        return file.openFromMemory(m_data, m_dataSize) && file.saveSeekIndex(filename);
+    }
+
+    // The file was opened from a stream, only the reader of the music can scan it
+    const std::lock_guard lock(m_mutex);
+    return m_file.saveSeekIndex(filename);
+}
+
+
 ////////////////////////////////////////////////////////////
 Music::TimeSpan Music::getLoopPoints() const
 {
@@ -179,7 +225,8 @@ bool Music::onGetData(SoundStream::Chunk& data)
 {
     const std::lock_guard lock(m_mutex);
 
-    std::size_t         toFill        = m_samples.size();
+    const bool          isFloat       = (getSampleFormat() == SampleFormat::Float32);
+    std::size_t         toFill        = isFloat ? m_floatSamples.size() : m_samples.size();
     std::uint64_t       currentOffset = m_file.getSampleOffset();
     const std::uint64_t loopEnd       = m_loopSpan.offset + m_loopSpan.length;
 
@@ -190,8 +237,17 @@ bool Music::onGetData(SoundStream::Chunk& data)
         toFill = static_cast<std::size_t>(loopEnd - currentOffset);
 
     // Fill the chunk parameters
-    data.samples     = m_samples.data();
-    data.sampleCount = static_cast<std::size_t>(m_file.read(m_samples.data(), toFill));
+    if (isFloat)
+    {
+        data.samples      = nullptr;
+        data.floatSamples = m_floatSamples.data();
+        data.sampleCount  = static_cast<std::size_t>(m_file.read(m_floatSamples.data(), toFill));
+    }
+    else
+    {
+        data.samples     = m_samples.data();
+        data.sampleCount = static_cast<std::size_t>(m_file.read(m_samples.data(), toFill));
+    }
     currentOffset += data.sampleCount;
 
     // Check if we have stopped obtaining samples or reached either the EOF or the loop end point
@@ -232,17 +288,27 @@ std::int64_t Music::onLoop()
 
 
 ////////////////////////////////////////////////////////////
-void Music::initialize()
+void Music::initialize(SampleFormat sampleFormat)
 {
     // Compute the music positions
     m_loopSpan.offset = 0;
     m_loopSpan.length = m_file.getSampleCount();
 
-    // Resize the internal buffer so that it can contain 1 second of audio samples
-    m_samples.resize(m_file.getSampleRate() * m_file.getChannelCount());
+    // Resize the internal buffer so that it can contain 1 second of audio samples, in the streamed format
+    const std::size_t bufferSize = m_file.getSampleRate() * m_file.getChannelCount();
+    if (sampleFormat == SampleFormat::Float32)
+    {
+        std::vector<std::int16_t>().swap(m_samples);
+        m_floatSamples.resize(bufferSize);
+    }
+    else
+    {
+        std::vector<float>().swap(m_floatSamples);
+        m_samples.resize(bufferSize);
+    }
 
     // Initialize the stream
-    SoundStream::initialize(m_file.getChannelCount(), m_file.getSampleRate());
+    SoundStream::initialize(m_file.getChannelCount(), m_file.getSampleRate(), sampleFormat);
 }
 
 ////////////////////////////////////////////////////////////
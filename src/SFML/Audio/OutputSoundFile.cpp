@@ -33,7 +33,10 @@
 namespace sf
 {
 ////////////////////////////////////////////////////////////
-bool OutputSoundFile::openFromFile(const std::filesystem::path& filename, unsigned int sampleRate, unsigned int channelCount)
+bool OutputSoundFile::openFromFile(const std::filesystem::path& filename,
+                                   unsigned int                 sampleRate,
+                                   unsigned int                 channelCount,
+                                   SampleFormat                 sampleFormat)
 {
     // If the file is already open, first close it
     close();
@@ -44,6 +47,7 @@ bool OutputSoundFile::openFromFile(const std::filesystem::path& filename, unsign
         return false;
 
     // Pass the stream to the reader
+    m_writer->setSampleFormat(sampleFormat);
     if (!m_writer->open(filename, sampleRate, channelCount))
     {
         close();
@@ -62,6 +66,14 @@ void OutputSoundFile::write(const std::int16_t* samples, std::uint64_t count)
 }
 
 
+////////////////////////////////////////////////////////////
+void OutputSoundFile::write(const float* samples, std::uint64_t count)
+{
+    if (m_writer && samples && count)
+        m_writer->writeFloat(samples, count);
+}
+
+
 ////////////////////////////////////////////////////////////
 void OutputSoundFile::close()
 {
@@ -0,0 +1,77 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+
+#include <cmath>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Convert a 16-bit sample to a float sample in the [-1, 1] range
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] constexpr float toFloatSample(std::int16_t sample)
+{
+    return static_cast<float>(sample) / 32768.f;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Convert a float sample to a 16-bit sample
+///
+/// Values outside of the [-1, 1] range are clamped, and
+/// 16-bit samples converted with toFloatSample come back
+/// unchanged.
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] inline std::int16_t toInt16Sample(float sample)
+{
+    return static_cast<std::int16_t>(std::lrint(std::clamp(sample * 32768.f, -32768.f, 32767.f)));
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Convert an array of 16-bit samples to float samples
+///
+////////////////////////////////////////////////////////////
+inline void toFloatSamples(const std::int16_t* samples, std::uint64_t count, float* result)
+{
+    std::transform(samples, samples + count, result, toFloatSample);
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Convert an array of float samples to 16-bit samples
+///
+////////////////////////////////////////////////////////////
+inline void toInt16Samples(const float* samples, std::uint64_t count, std::int16_t* result)
+{
+    std::transform(samples, samples + count, result, toInt16Sample);
+}
+
+} // namespace sf::priv
@@ -0,0 +1,195 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Lock-free ring buffer of audio samples, with one
+///        writing thread and one reading thread
+///
+////////////////////////////////////////////////////////////
+class SampleRing
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Allocate the buffer and forget its contents and counters
+    ///
+    /// The capacity is rounded up to the next power of two, which
+    /// makes wrapping around a simple mask. This function must
+    /// not be called while another thread uses the ring.
+    ///
+    /// \param capacity     Minimum number of samples that the ring can hold
+    /// \param channelCount Number of channels of the samples
+    ///
+    ////////////////////////////////////////////////////////////
+    void reset(std::size_t capacity, unsigned int channelCount)
+    {
+        std::size_t size = 2;
+        while (size < capacity)
+            size *= 2;
+
+        if (m_buffer.size() != size)
+            m_buffer.assign(size, 0);
+
+        m_channelCount  = std::max(channelCount, 1u);
+        m_writeOffset   = 0;
+        m_readOffset    = 0;
+        m_overrunCount  = 0;
+        m_underrunCount = 0;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write samples, from the writing thread
+    ///
+    /// If the ring is too full to take all the samples, only
+    /// the whole frames that fit are written, the newest samples
+    /// are dropped and an overrun is counted.
+    ///
+    /// \param samples Samples to write
+    /// \param count   Number of samples to write
+    ///
+    /// \return Number of samples actually written
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t write(const std::int16_t* samples, std::size_t count)
+    {
+        const std::size_t writeOffset = m_writeOffset.load(std::memory_order_relaxed);
+        const std::size_t free = m_buffer.size() - (writeOffset - m_readOffset.load(std::memory_order_acquire));
+
+        if (count > free)
+        {
+            count = free - free % m_channelCount;
+            m_overrunCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (count > 0)
+        {
+            const std::size_t index = writeOffset & (m_buffer.size() - 1);
+            const std::size_t first = std::min(count, m_buffer.size() - index);
+            std::copy(samples, samples + first, m_buffer.data() + index);
+            std::copy(samples + first, samples + count, m_buffer.data());
+            m_writeOffset.store(writeOffset + count, std::memory_order_release);
+        }
+
+        return count;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read samples, from the reading thread
+    ///
+    /// Only whole frames are read. If less than \a maxCount
+    /// samples are available, an underrun is counted.
+    ///
+    /// \param samples  Array to fill with the samples
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t read(std::int16_t* samples, std::size_t maxCount)
+    {
+        const std::size_t requested = maxCount - maxCount % m_channelCount;
+
+        const std::size_t readOffset = m_readOffset.load(std::memory_order_relaxed);
+        const std::size_t available  = m_writeOffset.load(std::memory_order_acquire) - readOffset;
+        const std::size_t count      = std::min(requested, available);
+
+        if (count < requested)
+            m_underrunCount.fetch_add(1, std::memory_order_relaxed);
+
+        if (count > 0)
+        {
+            const std::size_t index = readOffset & (m_buffer.size() - 1);
+            const std::size_t first = std::min(count, m_buffer.size() - index);
+            std::copy(m_buffer.data() + index, m_buffer.data() + index + first, samples);
+            std::copy(m_buffer.data(), m_buffer.data() + (count - first), samples + first);
+            m_readOffset.store(readOffset + count, std::memory_order_release);
+        }
+
+        return count;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of samples that can be read
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getAvailableSamples() const
+    {
+        const std::size_t readOffset = m_readOffset.load(std::memory_order_acquire);
+        return m_writeOffset.load(std::memory_order_acquire) - readOffset;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of samples that the ring can hold
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getCapacity() const
+    {
+        return m_buffer.size();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of writes that dropped samples
+    ///
+    ////////////////////////////////////////////////////////////
+    std::uint64_t getOverrunCount() const
+    {
+        return m_overrunCount.load(std::memory_order_relaxed);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of reads that couldn't be fully satisfied
+    ///
+    ////////////////////////////////////////////////////////////
+    std::uint64_t getUnderrunCount() const
+    {
+        return m_underrunCount.load(std::memory_order_relaxed);
+    }
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<std::int16_t>  m_buffer;          //!< Ring buffer, its size is a power of two
+    unsigned int               m_channelCount{1}; //!< Number of channels, reads and writes keep whole frames
+    std::atomic<std::size_t>   m_writeOffset{};   //!< Total number of samples written by the writing thread
+    std::atomic<std::size_t>   m_readOffset{};    //!< Total number of samples read by the reading thread
+    std::atomic<std::uint64_t> m_overrunCount{};  //!< Number of writes which dropped samples
+    std::atomic<std::uint64_t> m_underrunCount{}; //!< Number of reads which couldn't be fully satisfied
+};
+
+} // namespace sf::priv
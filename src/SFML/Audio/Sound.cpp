@@ -28,6 +28,8 @@
 #include <SFML/Audio/ALCheck.hpp>
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Audio/VoiceManager.hpp>
+#include <SFML/Audio/VoicePolicy.hpp>
 
 #if defined(__APPLE__)
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
@@ -39,16 +41,20 @@ namespace sf
 Sound::Sound(const SoundBuffer& buffer) : m_buffer(&buffer)
 {
     m_buffer->attachSound(this);
-    alCheck(alSourcei(m_source, AL_BUFFER, static_cast<ALint>(m_buffer->m_buffer)));
+    priv::VoiceManager::addSound();
 }
 
 
 ////////////////////////////////////////////////////////////
-Sound::Sound(const Sound& copy) : SoundSource(copy), m_buffer(copy.m_buffer)
+Sound::Sound(const Sound& copy) :
+SoundSource(copy),
+m_buffer(copy.m_buffer),
+m_loop(copy.m_loop),
+m_priority(copy.m_priority),
+m_cullDistance(copy.m_cullDistance)
 {
     m_buffer->attachSound(this);
-    alCheck(alSourcei(m_source, AL_BUFFER, static_cast<ALint>(m_buffer->m_buffer)));
-    setLoop(copy.getLoop());
+    priv::VoiceManager::addSound();
 }
 
 
@@ -57,27 +63,50 @@ Sound::~Sound()
 {
     stop();
     m_buffer->detachSound(this);
+    priv::VoiceManager::removeSound();
 }
 
 
 ////////////////////////////////////////////////////////////
 void Sound::play()
 {
-    alCheck(alSourcePlay(m_source));
+    // A sound that holds a voice is restarted from the beginning
+    if (m_source)
+    {
+        alCheck(alSourcePlay(m_source));
+        m_status = Playing;
+        return;
+    }
+
+    // Otherwise resume it if it was paused, or start it from the beginning
+    if (m_status != Paused)
+        m_offset = Time::Zero;
+
+    m_status = Playing;
+    m_clock.restart();
+    priv::VoiceManager::play(*this);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Sound::pause()
 {
-    alCheck(alSourcePause(m_source));
+    if (getStatus() != Playing)
+        return;
+
+    // Paused sounds don't need a voice, the playing position is saved when giving it back
+    m_offset = getPlayingOffset();
+    m_status = Paused;
+    priv::VoiceManager::release(*this);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Sound::stop()
 {
-    alCheck(alSourceStop(m_source));
+    priv::VoiceManager::release(*this);
+    m_status = Stopped;
+    m_offset = Time::Zero;
 }
 
 
@@ -88,24 +117,34 @@ void Sound::setBuffer(const SoundBuffer& buffer)
     stop();
     m_buffer->detachSound(this);
 
-    // Assign and use the new buffer
+    // Assign and use the new buffer, it is bound to the source when the sound gets a voice
     m_buffer = &buffer;
     m_buffer->attachSound(this);
-    alCheck(alSourcei(m_source, AL_BUFFER, static_cast<ALint>(m_buffer->m_buffer)));
 }
 
 
 ////////////////////////////////////////////////////////////
 void Sound::setLoop(bool loop)
 {
-    alCheck(alSourcei(m_source, AL_LOOPING, loop));
+    m_loop = loop;
+
+    if (m_source)
+        alCheck(alSourcei(m_source, AL_LOOPING, loop));
 }
 
 
 ////////////////////////////////////////////////////////////
 void Sound::setPlayingOffset(Time timeOffset)
 {
-    alCheck(alSourcef(m_source, AL_SEC_OFFSET, timeOffset.asSeconds()));
+    if (m_source)
+    {
+        alCheck(alSourcef(m_source, AL_SEC_OFFSET, timeOffset.asSeconds()));
+    }
+    else if (getStatus() != Stopped)
+    {
+        m_offset = timeOffset;
+        m_clock.restart();
+    }
 }
 
 
@@ -119,27 +158,71 @@ const SoundBuffer& Sound::getBuffer() const
 ////////////////////////////////////////////////////////////
 bool Sound::getLoop() const
 {
-    ALint loop;
-    alCheck(alGetSourcei(m_source, AL_LOOPING, &loop));
-
-    return loop != 0;
+    return m_loop;
 }
 
 
 ////////////////////////////////////////////////////////////
 Time Sound::getPlayingOffset() const
 {
-    ALfloat secs = 0.f;
-    alCheck(alGetSourcef(m_source, AL_SEC_OFFSET, &secs));
+    if (m_source)
+    {
+        ALfloat secs = 0.f;
+        alCheck(alGetSourcef(m_source, AL_SEC_OFFSET, &secs));
+
+        return seconds(secs);
+    }
+
+    return (getStatus() != Stopped) ? getVirtualOffset() : Time::Zero;
+}
+
+
+////////////////////////////////////////////////////////////
+void Sound::setPriority(int priority)
+{
+    m_priority = priority;
+}
+
 
-    return seconds(secs);
+////////////////////////////////////////////////////////////
+int Sound::getPriority() const
+{
+    return m_priority;
+}
+
+
+////////////////////////////////////////////////////////////
+void Sound::setCullDistance(float distance)
+{
+    m_cullDistance = distance;
+}
+
+
+////////////////////////////////////////////////////////////
+float Sound::getCullDistance() const
+{
+    return m_cullDistance;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Sound::isVirtual() const
+{
+    return !m_source && (getStatus() == Playing);
 }
 
 
 ////////////////////////////////////////////////////////////
 Sound::Status Sound::getStatus() const
 {
-    return SoundSource::getStatus();
+    if (m_source)
+        return SoundSource::getStatus();
+
+    // A virtual sound stops when it reaches its end
+    if ((m_status == Playing) && !m_loop && (getVirtualOffset() >= m_buffer->getDuration()))
+        return Stopped;
+
+    return m_status;
 }
 
 
@@ -160,6 +243,8 @@ Sound& Sound::operator=(const Sound& right)
     // Copy the remaining sound attributes
     setBuffer(*right.m_buffer);
     setLoop(right.getLoop());
+    setPriority(right.getPriority());
+    setCullDistance(right.getCullDistance());
 
     return *this;
 }
@@ -168,18 +253,63 @@ Sound& Sound::operator=(const Sound& right)
 ////////////////////////////////////////////////////////////
 void Sound::detachBuffer()
 {
-    // First stop the sound in case it is playing
+    // Stop the sound in case it is playing, which gives its voice back and unbinds the buffer
     stop();
-
-    // Detach the buffer
-    alCheck(alSourcei(m_source, AL_BUFFER, 0));
 }
 
 
 ////////////////////////////////////////////////////////////
 void Sound::reattachBuffer()
 {
+    if (m_source)
+        alCheck(alSourcei(m_source, AL_BUFFER, static_cast<ALint>(m_buffer->m_buffer)));
+}
+
+
+////////////////////////////////////////////////////////////
+void Sound::startVoice(unsigned int source)
+{
+    const Time offset = getVirtualOffset();
+
+    m_source = source;
+    applyProperties();
     alCheck(alSourcei(m_source, AL_BUFFER, static_cast<ALint>(m_buffer->m_buffer)));
+    alCheck(alSourcei(m_source, AL_LOOPING, m_loop));
+    alCheck(alSourcef(m_source, AL_SEC_OFFSET, offset.asSeconds()));
+    alCheck(alSourcePlay(m_source));
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int Sound::stopVoice()
+{
+    // Save the playing position, or notice that the sound has reached its end
+    if (SoundSource::getStatus() == Stopped)
+    {
+        m_status = Stopped;
+        m_offset = Time::Zero;
+    }
+    else
+    {
+        m_offset = getPlayingOffset();
+    }
+
+    m_clock.restart();
+
+    alCheck(alSourceStop(m_source));
+    alCheck(alSourcei(m_source, AL_BUFFER, 0));
+
+    const unsigned int source = m_source;
+    m_source                  = 0;
+    return source;
+}
+
+
+////////////////////////////////////////////////////////////
+Time Sound::getVirtualOffset() const
+{
+    const Time elapsed = (m_status == Playing) ? m_clock.getElapsedTime() : Time::Zero;
+    return priv::computeVirtualOffset(m_offset, elapsed, getPitch(), m_buffer->getDuration(), m_loop);
 }
 
 } // namespace sf
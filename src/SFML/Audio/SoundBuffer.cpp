@@ -29,12 +29,16 @@
 #include <SFML/Audio/AudioDevice.hpp>
 #include <SFML/Audio/InputSoundFile.hpp>
 #include <SFML/Audio/OutputSoundFile.hpp>
+#include <SFML/Audio/SampleConversion.hpp>
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
 
 #include <SFML/System/Err.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
 #include <SFML/System/Time.hpp>
+#include <SFML/System/Utils.hpp>
 
+#include <atomic>
 #include <exception>
 #include <ostream>
 #include <utility>
@@ -43,6 +47,68 @@
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 #endif
 
+namespace
+{
+// Memory used by all the live sound buffers, read by SoundBuffer::getMemoryUsage from any thread
+std::atomic<std::uint64_t> totalSampleBytes(0);
+std::atomic<std::uint64_t> totalOpenAlBytes(0);
+std::atomic<std::size_t>   totalBufferCount(0);
+
+// Replace the contribution of a buffer to a total
+void adjustTotal(std::atomic<std::uint64_t>& total, std::uint64_t& accounted, std::uint64_t bytes)
+{
+    if (bytes > accounted)
+        total += bytes - accounted;
+    else
+        total -= accounted - bytes;
+
+    accounted = bytes;
+}
+
+// Open a sound file that is decoded at once: map it in memory if possible, the decoder
+// then reads it without system calls; the mapping must outlive the sound file
+bool openForDecoding(const std::filesystem::path& filename,
+                     sf::MappedFileInputStream&   mapping,
+                     sf::InputSoundFile&          file)
+{
+    if (mapping.open(filename, sf::MappedFileInputStream::AccessPattern::Sequential))
+        return file.openFromStream(mapping);
+
+    return file.openFromFile(filename);
+}
+
+// Decode all the samples of a file, in the format of the vector; the file
+// must still have the layout it had when the buffer was loaded from it
+template <typename T>
+bool readSamples(const std::filesystem::path& filename,
+                 std::uint64_t                sampleCount,
+                 unsigned int                 channelCount,
+                 unsigned int                 sampleRate,
+                 std::vector<T>&              samples)
+{
+    sf::MappedFileInputStream mapping;
+    sf::InputSoundFile        file;
+    if (!openForDecoding(filename, mapping, file))
+        return false;
+
+    if ((file.getSampleCount() != sampleCount) || (file.getChannelCount() != channelCount) ||
+        (file.getSampleRate() != sampleRate))
+    {
+        sf::err() << "Failed to restore the samples of a sound buffer (the source file has changed)\n"
+                  << sf::formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    samples.resize(static_cast<std::size_t>(sampleCount));
+    if (file.read(samples.data(), sampleCount) == sampleCount)
+        return true;
+
+    // Don't leave partial samples behind, they would look restored
+    std::vector<T>().swap(samples);
+    return false;
+}
+} // namespace
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
@@ -50,16 +116,39 @@ SoundBuffer::SoundBuffer()
 {
     // Create the buffer
     alCheck(alGenBuffers(1, &m_buffer));
+
+    ++totalBufferCount;
 }
 
 
 ////////////////////////////////////////////////////////////
-SoundBuffer::SoundBuffer(const SoundBuffer& copy) : m_samples(copy.m_samples), m_duration(copy.m_duration)
+SoundBuffer::SoundBuffer(const SoundBuffer& copy) :
+m_samples(copy.m_samples),
+m_floatSamples(copy.m_floatSamples),
+m_sampleFormat(copy.m_sampleFormat),
+m_sampleCount(copy.m_sampleCount),
+m_duration(copy.m_duration),
+m_sourceFile(copy.m_sourceFile),
+m_keepSamples(copy.m_keepSamples)
 // don't copy the attached sounds
 {
     // Create the buffer
     alCheck(alGenBuffers(1, &m_buffer));
 
+    ++totalBufferCount;
+
+    // Samples released by the source buffer have to be decoded again; the
+    // source buffer checks them, since this one has no sample rate yet
+    const bool released = m_samples.empty() && m_floatSamples.empty() && (copy.m_sampleCount > 0);
+    if (released && !((m_sampleFormat == SampleFormat::Float32) ? copy.readSourceSamples(m_floatSamples)
+                                                                : copy.readSourceSamples(m_samples)))
+    {
+        err() << "Failed to copy sound buffer (its samples were released and can't be restored)" << std::endl;
+        m_sampleCount = 0;
+        m_duration    = Time::Zero;
+        return;
+    }
+
     // Update the internal buffer with the new samples
     if (!update(copy.getChannelCount(), copy.getSampleRate()))
         err() << "Failed to update copy-constructed sound buffer" << std::endl;
@@ -79,39 +168,51 @@ SoundBuffer::~SoundBuffer()
     // Destroy the buffer
     if (m_buffer)
         alCheck(alDeleteBuffers(1, &m_buffer));
+
+    totalSampleBytes -= m_sampleBytes;
+    totalOpenAlBytes -= m_openAlBytes;
+    --totalBufferCount;
 }
 
 
 ////////////////////////////////////////////////////////////
-bool SoundBuffer::loadFromFile(const std::filesystem::path& filename)
+bool SoundBuffer::loadFromFile(const std::filesystem::path& filename, SampleFormat sampleFormat)
 {
-    InputSoundFile file;
-    if (file.openFromFile(filename))
-        return initialize(file);
-    else
+    MappedFileInputStream mapping;
+    InputSoundFile        file;
+    if (!openForDecoding(filename, mapping, file))
         return false;
+
+    if (!initialize(file, sampleFormat))
+        return false;
+
+    // Remember the file, so that released samples can be decoded again
+    m_sourceFile = filename;
+    return true;
 }
 
 
 ////////////////////////////////////////////////////////////
-bool SoundBuffer::loadFromMemory(const void* data, std::size_t sizeInBytes)
+bool SoundBuffer::loadFromMemory(const void* data, std::size_t sizeInBytes, SampleFormat sampleFormat)
 {
     InputSoundFile file;
-    if (file.openFromMemory(data, sizeInBytes))
-        return initialize(file);
-    else
+    if (!file.openFromMemory(data, sizeInBytes) || !initialize(file, sampleFormat))
         return false;
+
+    m_sourceFile.clear();
+    return true;
 }
 
 
 ////////////////////////////////////////////////////////////
-bool SoundBuffer::loadFromStream(InputStream& stream)
+bool SoundBuffer::loadFromStream(InputStream& stream, SampleFormat sampleFormat)
 {
     InputSoundFile file;
-    if (file.openFromStream(stream))
-        return initialize(file);
-    else
+    if (!file.openFromStream(stream) || !initialize(file, sampleFormat))
         return false;
+
+    m_sourceFile.clear();
+    return true;
 }
 
 
@@ -125,6 +226,9 @@ bool SoundBuffer::loadFromSamples(const std::int16_t* samples,
     {
         // Copy the new audio samples
         m_samples.assign(samples, samples + sampleCount);
+        std::vector<float>().swap(m_floatSamples);
+        m_sampleFormat = SampleFormat::Int16;
+        m_sourceFile.clear();
 
         // Update the internal buffer with the new samples
         return update(channelCount, sampleRate);
@@ -143,15 +247,85 @@ bool SoundBuffer::loadFromSamples(const std::int16_t* samples,
 }
 
 
+////////////////////////////////////////////////////////////
+bool SoundBuffer::loadFromSamples(const float*  samples,
+                                  std::uint64_t sampleCount,
+                                  unsigned int  channelCount,
+                                  unsigned int  sampleRate)
+{
+    if (samples && sampleCount && channelCount && sampleRate)
+    {
+        // Copy the new audio samples
+        m_floatSamples.assign(samples, samples + sampleCount);
+        std::vector<std::int16_t>().swap(m_samples);
+        m_sampleFormat = SampleFormat::Float32;
+        m_sourceFile.clear();
+
+        // Update the internal buffer with the new samples
+        return update(channelCount, sampleRate);
+    }
+    else
+    {
+        // Error...
+        err() << "Failed to load sound buffer from float samples ("
+              << "array: " << samples << ", "
+              << "count: " << sampleCount << ", "
+              << "channels: " << channelCount << ", "
+              << "samplerate: " << sampleRate << ")" << std::endl;
+
+        return false;
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 bool SoundBuffer::saveToFile(const std::filesystem::path& filename) const
 {
+    // Float samples are saved with their full precision
+    if (m_sampleFormat == SampleFormat::Float32)
+    {
+        // Samples released from system memory have to be decoded again
+        const std::vector<float>* samples = &m_floatSamples;
+        std::vector<float>        restoredSamples;
+        if (m_floatSamples.empty() && (m_sampleCount > 0))
+        {
+            if (!readSourceSamples(restoredSamples))
+            {
+                err() << "Failed to save sound buffer (its samples were released and can't be restored)" << std::endl;
+                return false;
+            }
+
+            samples = &restoredSamples;
+        }
+
+        OutputSoundFile file;
+        if (!file.openFromFile(filename, getSampleRate(), getChannelCount(), SampleFormat::Float32))
+            return false;
+
+        file.write(samples->data(), samples->size());
+        return true;
+    }
+
+    // Samples released from system memory have to be decoded again
+    const std::vector<std::int16_t>* samples = &m_samples;
+    std::vector<std::int16_t>        restoredSamples;
+    if (m_samples.empty() && (m_sampleCount > 0))
+    {
+        if (!readSourceSamples(restoredSamples))
+        {
+            err() << "Failed to save sound buffer (its samples were released and can't be restored)" << std::endl;
+            return false;
+        }
+
+        samples = &restoredSamples;
+    }
+
     // Create the sound file in write mode
     OutputSoundFile file;
     if (file.openFromFile(filename, getSampleRate(), getChannelCount()))
     {
         // Write the samples to the opened file
-        file.write(m_samples.data(), m_samples.size());
+        file.write(samples->data(), samples->size());
 
         return true;
     }
@@ -169,10 +343,24 @@ const std::int16_t* SoundBuffer::getSamples() const
 }
 
 
+////////////////////////////////////////////////////////////
+const float* SoundBuffer::getFloatSamples() const
+{
+    return m_floatSamples.empty() ? nullptr : m_floatSamples.data();
+}
+
+
+////////////////////////////////////////////////////////////
+SampleFormat SoundBuffer::getSampleFormat() const
+{
+    return m_sampleFormat;
+}
+
+
 ////////////////////////////////////////////////////////////
 std::uint64_t SoundBuffer::getSampleCount() const
 {
-    return m_samples.size();
+    return m_sampleCount;
 }
 
 
@@ -203,14 +391,82 @@ Time SoundBuffer::getDuration() const
 }
 
 
+////////////////////////////////////////////////////////////
+void SoundBuffer::setKeepSamples(bool keep)
+{
+    m_keepSamples = keep;
+
+    if (!m_keepSamples)
+        releaseSamples();
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundBuffer::getKeepSamples() const
+{
+    return m_keepSamples;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundBuffer::releaseSamples()
+{
+    // Only samples that OpenAL holds a copy of can be released
+    if (m_sampleCount == 0)
+        return;
+
+    std::vector<std::int16_t>().swap(m_samples);
+    std::vector<float>().swap(m_floatSamples);
+    updateMemoryUsage(m_openAlBytes);
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundBuffer::restoreSamples()
+{
+    if (!m_samples.empty() || !m_floatSamples.empty() || (m_sampleCount == 0))
+        return true;
+
+    if (m_sourceFile.empty())
+    {
+        err() << "Failed to restore the samples of a sound buffer that wasn't loaded from a file" << std::endl;
+        return false;
+    }
+
+    if (!restoreSourceSamples())
+        return false;
+
+    updateMemoryUsage(m_openAlBytes);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+SoundBuffer::MemoryUsage SoundBuffer::getMemoryUsage()
+{
+    MemoryUsage usage;
+    usage.sampleBytes = totalSampleBytes;
+    usage.openAlBytes = totalOpenAlBytes;
+    usage.bufferCount = totalBufferCount;
+    return usage;
+}
+
+
 ////////////////////////////////////////////////////////////
 SoundBuffer& SoundBuffer::operator=(const SoundBuffer& right)
 {
     SoundBuffer temp(right);
 
     std::swap(m_samples, temp.m_samples);
+    std::swap(m_floatSamples, temp.m_floatSamples);
+    std::swap(m_sampleFormat, temp.m_sampleFormat);
     std::swap(m_buffer, temp.m_buffer);
+    std::swap(m_sampleCount, temp.m_sampleCount);
     std::swap(m_duration, temp.m_duration);
+    std::swap(m_sourceFile, temp.m_sourceFile);
+    std::swap(m_keepSamples, temp.m_keepSamples);
+    std::swap(m_sampleBytes, temp.m_sampleBytes);
+    std::swap(m_openAlBytes, temp.m_openAlBytes);
 
     // Reattach sounds that use this buffer so they get bound to the new OpenAL buffer
     for (Sound* soundPtr : m_sounds)
@@ -224,24 +480,43 @@ SoundBuffer& SoundBuffer::operator=(const SoundBuffer& right)
 
 
 ////////////////////////////////////////////////////////////
-bool SoundBuffer::initialize(InputSoundFile& file)
+bool SoundBuffer::initialize(InputSoundFile& file, SampleFormat sampleFormat)
 {
     // Retrieve the sound parameters
     const std::uint64_t sampleCount  = file.getSampleCount();
     const unsigned int  channelCount = file.getChannelCount();
     const unsigned int  sampleRate   = file.getSampleRate();
 
-    // Read the samples from the provided file
-    m_samples.resize(static_cast<std::size_t>(sampleCount));
-    if (file.read(m_samples.data(), sampleCount) == sampleCount)
+    // Read the samples from the provided file, in the requested format; the current
+    // samples are left untouched until the new ones are known to be valid
+    std::vector<std::int16_t> samples;
+    std::vector<float>        floatSamples;
+    std::uint64_t             readCount = 0;
+    if (sampleFormat == SampleFormat::Float32)
     {
-        // Update the internal buffer with the new samples
-        return update(channelCount, sampleRate);
+        floatSamples.resize(static_cast<std::size_t>(sampleCount));
+        readCount = file.read(floatSamples.data(), sampleCount);
     }
     else
     {
-        return false;
+        samples.resize(static_cast<std::size_t>(sampleCount));
+        readCount = file.read(samples.data(), sampleCount);
     }
+
+    if (readCount != sampleCount)
+        return false;
+
+    // Update the internal buffer with the new samples, or go back to the current ones
+    m_samples.swap(samples);
+    m_floatSamples.swap(floatSamples);
+    const SampleFormat previousFormat = std::exchange(m_sampleFormat, sampleFormat);
+    if (update(channelCount, sampleRate))
+        return true;
+
+    m_samples.swap(samples);
+    m_floatSamples.swap(floatSamples);
+    m_sampleFormat = previousFormat;
+    return false;
 }
 
 
@@ -249,11 +524,18 @@ bool SoundBuffer::initialize(InputSoundFile& file)
 bool SoundBuffer::update(unsigned int channelCount, unsigned int sampleRate)
 {
     // Check parameters
-    if (!channelCount || !sampleRate || m_samples.empty())
+    const bool isFloat = (m_sampleFormat == SampleFormat::Float32);
+    if (!channelCount || !sampleRate || (isFloat ? m_floatSamples.empty() : m_samples.empty()))
         return false;
 
-    // Find the good format according to the number of channels
-    const ALenum format = priv::AudioDevice::getFormatFromChannelCount(channelCount);
+    // Find the good format according to the number of channels; float samples
+    // are converted to 16-bit if the device doesn't support float formats
+    ALenum format = 0;
+    if (isFloat)
+        format = priv::AudioDevice::getFormatFromChannelCount(channelCount, SampleFormat::Float32);
+    const bool convertSamples = isFloat && (format == 0);
+    if (format == 0)
+        format = priv::AudioDevice::getFormatFromChannelCount(channelCount);
 
     // Check if the format is valid
     if (format == 0)
@@ -267,21 +549,81 @@ bool SoundBuffer::update(unsigned int channelCount, unsigned int sampleRate)
         soundPtr->detachBuffer();
 
     // Fill the buffer
-    const auto size = static_cast<ALsizei>(m_samples.size() * sizeof(std::int16_t));
-    alCheck(alBufferData(m_buffer, format, m_samples.data(), size, static_cast<ALsizei>(sampleRate)));
+    std::vector<std::int16_t> convertedSamples;
+    const void*               data = m_samples.data();
+    std::size_t               size = m_samples.size() * sizeof(std::int16_t);
+    if (convertSamples)
+    {
+        convertedSamples.resize(m_floatSamples.size());
+        priv::toInt16Samples(m_floatSamples.data(), m_floatSamples.size(), convertedSamples.data());
+        data = convertedSamples.data();
+        size = convertedSamples.size() * sizeof(std::int16_t);
+    }
+    else if (isFloat)
+    {
+        data = m_floatSamples.data();
+        size = m_floatSamples.size() * sizeof(float);
+    }
+    alCheck(alBufferData(m_buffer, format, data, static_cast<ALsizei>(size), static_cast<ALsizei>(sampleRate)));
 
     // Compute the duration
-    m_duration = seconds(
-        static_cast<float>(m_samples.size()) / static_cast<float>(sampleRate) / static_cast<float>(channelCount));
+    m_sampleCount = isFloat ? m_floatSamples.size() : m_samples.size();
+    m_duration    = seconds(
+        static_cast<float>(m_sampleCount) / static_cast<float>(sampleRate) / static_cast<float>(channelCount));
 
     // Now reattach the buffer to the sounds that use it
     for (Sound* soundPtr : m_sounds)
         soundPtr->reattachBuffer();
 
+    // OpenAL has its own copy of the samples now
+    if (!m_keepSamples)
+    {
+        std::vector<std::int16_t>().swap(m_samples);
+        std::vector<float>().swap(m_floatSamples);
+    }
+
+    updateMemoryUsage(size);
+
     return true;
 }
 
 
+////////////////////////////////////////////////////////////
+bool SoundBuffer::readSourceSamples(std::vector<std::int16_t>& samples) const
+{
+    return !m_sourceFile.empty() &&
+           readSamples(m_sourceFile, m_sampleCount, getChannelCount(), getSampleRate(), samples);
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundBuffer::readSourceSamples(std::vector<float>& samples) const
+{
+    return !m_sourceFile.empty() &&
+           readSamples(m_sourceFile, m_sampleCount, getChannelCount(), getSampleRate(), samples);
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundBuffer::restoreSourceSamples()
+{
+    if (m_sampleFormat == SampleFormat::Float32)
+        return readSourceSamples(m_floatSamples);
+
+    return readSourceSamples(m_samples);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundBuffer::updateMemoryUsage(std::uint64_t openAlBytes)
+{
+    adjustTotal(totalSampleBytes,
+                m_sampleBytes,
+                m_samples.capacity() * sizeof(std::int16_t) + m_floatSamples.capacity() * sizeof(float));
+    adjustTotal(totalOpenAlBytes, m_openAlBytes, openAlBytes);
+}
+
+
 ////////////////////////////////////////////////////////////
 void SoundBuffer::attachSound(Sound* sound) const
 {
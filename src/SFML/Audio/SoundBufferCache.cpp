@@ -0,0 +1,367 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Audio/SoundBufferCache.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+
+namespace
+{
+// Number of sound buffers added to the cache between two removals of the expired ones
+constexpr std::size_t purgeInterval = 64;
+
+// FNV-1a hash of a file in memory; two different offset bases give two independent hashes
+std::uint64_t hashContents(const void* data, std::size_t sizeInBytes, std::uint64_t offsetBasis)
+{
+    std::uint64_t hash = offsetBasis;
+    for (std::size_t i = 0; i < sizeInBytes; ++i)
+    {
+        hash ^= static_cast<const unsigned char*>(data)[i];
+        hash *= 1099511628211ull;
+    }
+
+    return hash ^ sizeInBytes;
+}
+
+// Offset basis of the hash that finds the entries that may have the same contents
+constexpr std::uint64_t bucketBasis = 14695981039346656037ull;
+
+// Offset basis of the hash that tells apart different contents with the same bucket hash
+constexpr std::uint64_t fingerprintBasis = 0x9e3779b97f4a7c15ull;
+
+struct PathHash
+{
+    std::size_t operator()(const std::filesystem::path& path) const
+    {
+        return std::filesystem::hash_value(path);
+    }
+};
+
+// Remove the entries that are no longer referred to by any handle
+template <typename Map>
+void removeExpired(Map& map)
+{
+    for (auto it = map.begin(); it != map.end();)
+        it = it->second.expired() ? map.erase(it) : std::next(it);
+}
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct SoundBufferCache::Entry
+{
+    void finish(std::unique_ptr<SoundBuffer> loadedBuffer)
+    {
+        {
+            const std::lock_guard lock(mutex);
+            buffer = std::move(loadedBuffer);
+            status = buffer ? Status::Ready : Status::Failed;
+        }
+
+        // The copy of the file in memory is not needed anymore, don't keep it alive along with the sound buffer
+        contents = std::vector<std::byte>();
+        condition.notify_all();
+    }
+
+    std::atomic<Status>             status{Status::Loading}; //!< Loading status of the sound buffer
+    std::unique_ptr<SoundBuffer>    buffer;                  //!< Sound buffer, once loaded
+    std::vector<std::byte>          contents;                //!< Copy of the file in memory until it is decoded
+    std::uint64_t                   fingerprint{};           //!< Second hash of the file in memory, 0 for a file
+    std::size_t                     size{};                  //!< Size of the file in memory, 0 for a file
+    mutable std::mutex              mutex;                   //!< Protects the sound buffer while it is being set
+    mutable std::condition_variable condition;               //!< Wakes up the handles waiting for the sound buffer
+};
+
+
+////////////////////////////////////////////////////////////
+struct SoundBufferCache::Impl
+{
+    using FileMap    = std::unordered_map<std::filesystem::path, std::weak_ptr<Entry>, PathHash>;
+    using ContentMap = std::unordered_multimap<std::uint64_t, std::weak_ptr<Entry>>;
+
+    struct Job
+    {
+        std::weak_ptr<Entry>  entry;    //!< Entry receiving the sound buffer
+        std::filesystem::path filename; //!< File to load, empty for a file in memory
+    };
+
+    void work();
+
+    void removeExpiredEntries();
+
+    std::weak_ptr<Entry>& findContents(std::uint64_t hash, std::uint64_t fingerprint, std::size_t sizeInBytes);
+
+    Handle request(std::weak_ptr<Entry>& slot,
+                   Job                   job,
+                   const std::byte*      data        = nullptr,
+                   std::size_t           sizeInBytes = 0,
+                   std::uint64_t         fingerprint = 0);
+
+    mutable std::mutex       mutex;        //!< Protects everything below
+    std::condition_variable  condition;    //!< Wakes the threads up when a job is queued
+    FileMap                  files;        //!< Entries loaded from files, by path
+    ContentMap               contents;     //!< Entries loaded from memory, by hash
+    std::deque<Job>          queue;        //!< Sound buffers waiting for a thread
+    std::size_t              insertions{}; //!< Entries added since the last purge
+    bool                     stopping{};   //!< Are the threads asked to stop?
+    std::vector<std::thread> threads;      //!< Threads loading the sound buffers
+};
+
+
+////////////////////////////////////////////////////////////
+void SoundBufferCache::Impl::work()
+{
+    std::unique_lock lock(mutex);
+
+    for (;;)
+    {
+        condition.wait(lock, [this] { return stopping || !queue.empty(); });
+        if (stopping)
+            return;
+
+        const Job job = std::move(queue.front());
+        queue.pop_front();
+
+        // Don't load sound buffers that nobody wants anymore
+        const std::shared_ptr<Entry> entry = job.entry.lock();
+        if (!entry)
+            continue;
+
+        // Decoding takes a while, don't hold the lock meanwhile; only finish() releases the contents of the entry
+        lock.unlock();
+
+        auto       buffer = std::make_unique<SoundBuffer>();
+        const bool loaded = job.filename.empty()
+                                ? buffer->loadFromMemory(entry->contents.data(), entry->contents.size())
+                                : buffer->loadFromFile(job.filename);
+
+        // Finish under the lock, so that getBufferCount() never counts the reference held by this thread
+        lock.lock();
+        entry->finish(loaded ? std::move(buffer) : nullptr);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundBufferCache::Impl::removeExpiredEntries()
+{
+    // Expired entries are otherwise only replaced when they are requested again
+    if (insertions >= purgeInterval)
+    {
+        removeExpired(files);
+        removeExpired(contents);
+        insertions = 0;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::weak_ptr<SoundBufferCache::Entry>& SoundBufferCache::Impl::findContents(std::uint64_t hash,
+                                                                             std::uint64_t fingerprint,
+                                                                             std::size_t   sizeInBytes)
+{
+    // Different contents may have the same hash, compare their fingerprints to be sure
+    const auto [first, last] = contents.equal_range(hash);
+    auto       expired       = last;
+    for (auto it = first; it != last; ++it)
+    {
+        const std::shared_ptr<Entry> entry = it->second.lock();
+        if (!entry)
+            expired = it;
+        else if ((entry->fingerprint == fingerprint) && (entry->size == sizeInBytes))
+            return it->second;
+    }
+
+    // Reuse the slot of an expired entry rather than adding a new one
+    if (expired != last)
+        return expired->second;
+
+    return contents.emplace(hash, std::weak_ptr<Entry>())->second;
+}
+
+
+////////////////////////////////////////////////////////////
+SoundBufferCache::Handle SoundBufferCache::Impl::request(std::weak_ptr<Entry>& slot,
+                                                        Job                   job,
+                                                        const std::byte*      data,
+                                                        std::size_t           sizeInBytes,
+                                                        std::uint64_t         fingerprint)
+{
+    Handle handle;
+
+    // Share the existing sound buffer, unless it failed to load and must be tried again
+    std::shared_ptr<Entry> entry = slot.lock();
+    if (entry && (entry->status != Status::Failed))
+    {
+        handle.m_entry = std::move(entry);
+        return handle;
+    }
+
+    entry = std::make_shared<Entry>();
+    entry->contents.assign(data, data + sizeInBytes);
+    entry->fingerprint = fingerprint;
+    entry->size        = sizeInBytes;
+    slot               = entry;
+    job.entry          = entry;
+    queue.push_back(std::move(job));
+    condition.notify_one();
+
+    ++insertions;
+    handle.m_entry = std::move(entry);
+    return handle;
+}
+
+
+////////////////////////////////////////////////////////////
+SoundBufferCache::Status SoundBufferCache::Handle::getStatus() const
+{
+    return m_entry ? m_entry->status.load() : Status::Failed;
+}
+
+
+////////////////////////////////////////////////////////////
+SoundBufferCache::Status SoundBufferCache::Handle::wait() const
+{
+    if (!m_entry)
+        return Status::Failed;
+
+    std::unique_lock lock(m_entry->mutex);
+    m_entry->condition.wait(lock, [this] { return m_entry->status != Status::Loading; });
+    return m_entry->status;
+}
+
+
+////////////////////////////////////////////////////////////
+const SoundBuffer* SoundBufferCache::Handle::get() const
+{
+    return (getStatus() == Status::Ready) ? m_entry->buffer.get() : nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+SoundBufferCache::Handle::operator bool() const
+{
+    return m_entry != nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+SoundBufferCache::SoundBufferCache(std::size_t threadCount) : m_impl(std::make_unique<Impl>())
+{
+    for (std::size_t i = 0; i < std::max(threadCount, std::size_t{1}); ++i)
+        m_impl->threads.emplace_back([this] { m_impl->work(); });
+}
+
+
+////////////////////////////////////////////////////////////
+SoundBufferCache::~SoundBufferCache()
+{
+    // Abandon the sound buffers that no thread has started loading
+    std::vector<std::shared_ptr<Entry>> abandoned;
+    {
+        const std::lock_guard lock(m_impl->mutex);
+        m_impl->stopping = true;
+
+        for (const Impl::Job& job : m_impl->queue)
+        {
+            if (std::shared_ptr<Entry> entry = job.entry.lock())
+                abandoned.push_back(std::move(entry));
+        }
+        m_impl->queue.clear();
+    }
+    m_impl->condition.notify_all();
+
+    for (const std::shared_ptr<Entry>& entry : abandoned)
+        entry->finish(nullptr);
+
+    for (std::thread& thread : m_impl->threads)
+        thread.join();
+}
+
+
+////////////////////////////////////////////////////////////
+SoundBufferCache::Handle SoundBufferCache::loadFromFile(const std::filesystem::path& filename)
+{
+    // Different paths to the same file must share the sound buffer
+    std::error_code       error;
+    std::filesystem::path key = std::filesystem::weakly_canonical(filename, error);
+    if (error)
+        key = filename.lexically_normal();
+
+    const std::lock_guard lock(m_impl->mutex);
+
+    m_impl->removeExpiredEntries();
+
+    return m_impl->request(m_impl->files[key], Impl::Job{{}, filename});
+}
+
+
+////////////////////////////////////////////////////////////
+SoundBufferCache::Handle SoundBufferCache::loadFromMemory(const void* data, std::size_t sizeInBytes)
+{
+    const auto*         bytes       = static_cast<const std::byte*>(data);
+    const std::uint64_t hash        = hashContents(bytes, sizeInBytes, bucketBasis);
+    const std::uint64_t fingerprint = hashContents(bytes, sizeInBytes, fingerprintBasis);
+
+    const std::lock_guard lock(m_impl->mutex);
+
+    m_impl->removeExpiredEntries();
+
+    return m_impl->request(m_impl->findContents(hash, fingerprint, sizeInBytes),
+                           Impl::Job{{}, {}},
+                           bytes,
+                           sizeInBytes,
+                           fingerprint);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SoundBufferCache::getBufferCount() const
+{
+    const std::lock_guard lock(m_impl->mutex);
+
+    const auto isAlive = [](const auto& pair) { return !pair.second.expired(); };
+    return static_cast<std::size_t>(std::count_if(m_impl->files.begin(), m_impl->files.end(), isAlive) +
+                                    std::count_if(m_impl->contents.begin(), m_impl->contents.end(), isAlive));
+}
+
+} // namespace sf
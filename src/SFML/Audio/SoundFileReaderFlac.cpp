@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <ostream>
+#include <type_traits>
 
 #include <cassert>
 #include <cstddef>
@@ -40,6 +41,16 @@
 
 namespace
 {
+// Convert a sample scaled to the full 32-bit range to the requested sample type
+template <typename T>
+T convertSample(std::int32_t sample)
+{
+    if constexpr (std::is_same_v<T, float>)
+        return static_cast<float>(sample) / 2147483648.f;
+    else
+        return static_cast<std::int16_t>(sample >> 16);
+}
+
 FLAC__StreamDecoderReadStatus streamRead(const FLAC__StreamDecoder*, FLAC__byte buffer[], std::size_t* bytes, void* clientData)
 {
     auto* data = static_cast<sf::priv::SoundFileReaderFlac::ClientData*>(clientData);
@@ -122,36 +133,23 @@ FLAC__StreamDecoderWriteStatus streamWrite(const FLAC__StreamDecoder*,
     if (data->remaining < frameSamples)
         data->leftovers.reserve(static_cast<std::size_t>(frameSamples - data->remaining));
 
-    // Decode the samples
+    // Decode the samples, scaled to the full 32-bit range
+    const unsigned int shift = 32 - frame->header.bits_per_sample;
     for (unsigned i = 0; i < frame->header.blocksize; ++i)
     {
         for (unsigned int j = 0; j < frame->header.channels; ++j)
         {
-            // Decode the current sample
-            std::int16_t sample = 0;
-            switch (frame->header.bits_per_sample)
-            {
-                case 8:
-                    sample = static_cast<std::int16_t>(buffer[j][i] << 8);
-                    break;
-                case 16:
-                    sample = static_cast<std::int16_t>(buffer[j][i]);
-                    break;
-                case 24:
-                    sample = static_cast<std::int16_t>(buffer[j][i] >> 8);
-                    break;
-                case 32:
-                    sample = static_cast<std::int16_t>(buffer[j][i] >> 16);
-                    break;
-                default:
-                    assert(false && "Invalid bits per sample. Must be 8, 16, 24, or 32.");
-                    break;
-            }
+            const auto sample = static_cast<std::int32_t>(static_cast<std::uint32_t>(buffer[j][i]) << shift);
 
             if (data->buffer && data->remaining > 0)
             {
                 // If there's room in the output buffer, copy the sample there
-                *data->buffer++ = sample;
+                *data->buffer++ = convertSample<std::int16_t>(sample);
+                --data->remaining;
+            }
+            else if (data->floatBuffer && data->remaining > 0)
+            {
+                *data->floatBuffer++ = convertSample<float>(sample);
                 --data->remaining;
             }
             else
@@ -272,8 +270,9 @@ void SoundFileReaderFlac::seek(std::uint64_t sampleOffset)
     assert(m_decoder && "No decoder available. Call SoundFileReaderFlac::open() to create a new one.");
 
     // Reset the callback data (the "write" callback will be called)
-    m_clientData.buffer    = nullptr;
-    m_clientData.remaining = 0;
+    m_clientData.buffer      = nullptr;
+    m_clientData.floatBuffer = nullptr;
+    m_clientData.remaining   = 0;
     m_clientData.leftovers.clear();
 
     // FLAC decoder expects absolute sample offset, so we take the channel count out
@@ -298,36 +297,42 @@ void SoundFileReaderFlac::seek(std::uint64_t sampleOffset)
 
 ////////////////////////////////////////////////////////////
 std::uint64_t SoundFileReaderFlac::read(std::int16_t* samples, std::uint64_t maxCount)
+{
+    return readSamples(samples, maxCount);
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t SoundFileReaderFlac::readFloat(float* samples, std::uint64_t maxCount)
+{
+    return readSamples(samples, maxCount);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::uint64_t SoundFileReaderFlac::readSamples(T* samples, std::uint64_t maxCount)
 {
     assert(m_decoder && "No decoder available. Call SoundFileReaderFlac::open() to create a new one.");
 
-    // If there are leftovers from previous call, use it first
-    const std::size_t left = m_clientData.leftovers.size();
-    if (left > 0)
-    {
-        if (left > maxCount)
-        {
-            // There are more leftovers than needed
-            std::copy(m_clientData.leftovers.begin(),
-                      m_clientData.leftovers.begin() + static_cast<std::vector<std::int16_t>::difference_type>(maxCount),
-                      samples);
-            std::vector<std::int16_t> leftovers(m_clientData.leftovers.begin() +
-                                                    static_cast<std::vector<std::int16_t>::difference_type>(maxCount),
-                                                m_clientData.leftovers.end());
-            m_clientData.leftovers.swap(leftovers);
-            return maxCount;
-        }
-        else
-        {
-            // We can use all the leftovers and decode new frames
-            std::copy(m_clientData.leftovers.begin(), m_clientData.leftovers.end(), samples);
-        }
-    }
+    // If there are leftovers from previous call, use them first
+    const std::uint64_t left    = std::min<std::uint64_t>(m_clientData.leftovers.size(), maxCount);
+    const auto leftEnd = m_clientData.leftovers.begin() + static_cast<std::vector<std::int32_t>::difference_type>(left);
+    std::transform(m_clientData.leftovers.begin(), leftEnd, samples, convertSample<T>);
+    m_clientData.leftovers.erase(m_clientData.leftovers.begin(), leftEnd);
 
     // Reset the data that will be used in the callback
-    m_clientData.buffer    = samples + left;
+    if constexpr (std::is_same_v<T, float>)
+    {
+        m_clientData.buffer      = nullptr;
+        m_clientData.floatBuffer = samples + left;
+    }
+    else
+    {
+        m_clientData.buffer      = samples + left;
+        m_clientData.floatBuffer = nullptr;
+    }
     m_clientData.remaining = maxCount - left;
-    m_clientData.leftovers.clear();
 
     // Decode frames one by one until we reach the requested sample count, the end of file or an error
     while (m_clientData.remaining > 0)
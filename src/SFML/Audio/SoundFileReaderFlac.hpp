@@ -97,6 +97,17 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::uint64_t read(std::int16_t* samples, std::uint64_t maxCount) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read audio samples from the open file, as floats
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t readFloat(float* samples, std::uint64_t maxCount) override;
+
     ////////////////////////////////////////////////////////////
     /// \brief Hold the state that is passed to the decoder callbacks
     ///
@@ -106,12 +117,25 @@ public:
         InputStream*              stream{};
         SoundFileReader::Info     info;
         std::int16_t*             buffer{};
+        float*                    floatBuffer{};
         std::uint64_t             remaining{};
-        std::vector<std::int16_t> leftovers;
+        std::vector<std::int32_t> leftovers; // Scaled to the full 32-bit range
         bool                      error{};
     };
 
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Read and convert samples to the requested type
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    std::uint64_t readSamples(T* samples, std::uint64_t maxCount);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -52,11 +52,16 @@
 
 #include <SFML/Audio/SoundFileReaderMp3.hpp>
 
+#include <SFML/System/Err.hpp>
 #include <SFML/System/InputStream.hpp>
 
 #include <algorithm>
+#include <limits>
+#include <ostream>
+#include <utility>
 
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
 
 
@@ -80,6 +85,65 @@ bool hasValidId3Tag(const std::uint8_t* header)
     return std::memcmp(header, "ID3", 3) == 0 &&
            !((header[5] & 15) || (header[6] & 0x80) || (header[7] & 0x80) || (header[8] & 0x80) || (header[9] & 0x80));
 }
+
+// Seek index layout: a header followed by the sample and byte offset of each frame,
+// every value is a 64-bit integer stored in little endian byte order
+constexpr char          seekIndexMagic[8]     = {'S', 'F', 'M', 'L', 'M', 'P', '3', 'I'};
+constexpr std::uint64_t seekIndexVersion      = 1;
+constexpr std::size_t   seekIndexHeaderValues = 7;
+
+void writeValue(std::vector<std::uint8_t>& index, std::uint64_t value)
+{
+    for (int i = 0; i < 8; ++i)
+        index.push_back(static_cast<std::uint8_t>(value >> (i * 8)));
+}
+
+std::uint64_t readValue(const std::vector<std::uint8_t>& index, std::size_t& position)
+{
+    std::uint64_t value = 0;
+    for (int i = 0; i < 8; ++i)
+        value |= static_cast<std::uint64_t>(index[position++]) << (i * 8);
+    return value;
+}
+
+// State of an incremental scan of the frames, see SoundFileReaderMp3::extendSeekIndex
+struct IndexScan
+{
+    mp3dec_ex_t*  decoder{};      // Decoder whose index is extended
+    std::uint64_t startOffset{};  // Position in the stream where the scan started
+    std::uint64_t targetSample{}; // Sample after which the scan can stop
+    std::uint64_t resumeOffset{}; // Position in the stream right after the last indexed frame
+};
+
+int scanCallback(void*                data,
+                 const std::uint8_t*  frame,
+                 int                  frameSize,
+                 int                  freeFormatBytes,
+                 std::size_t          bufferSize,
+                 std::uint64_t        offset,
+                 mp3dec_frame_info_t* info)
+{
+    auto& scan = *static_cast<IndexScan*>(data);
+
+    // Let minimp3 index the frame, as it would do when scanning the whole file
+    const std::uint64_t frameOffset = scan.startOffset + offset;
+    const int           result = mp3dec_load_index(scan.decoder,
+                                                   frame,
+                                                   frameSize,
+                                                   freeFormatBytes,
+                                                   bufferSize,
+                                                   frameOffset,
+                                                   info);
+    if (result != 0)
+        return result;
+
+    scan.resumeOffset = frameOffset + static_cast<std::uint64_t>(frameSize);
+
+    // Stop once the target is covered, but not before the first decodable frame is found
+    // (minimp3 tries to decode up to 255 frames to find it, and its decoder state can't be kept between scans)
+    const bool decodingStarted = (scan.decoder->buffer_samples != 0) || (scan.decoder->index.num_frames >= 256);
+    return (decodingStarted && (scan.decoder->samples > scan.targetSample)) ? MP3D_E_USER : 0;
+}
 } // namespace
 
 namespace sf::priv
@@ -124,8 +188,19 @@ std::optional<SoundFileReader::Info> SoundFileReaderMp3::open(InputStream& strea
     m_io.read_data = &stream;
     m_io.seek_data = &stream;
 
-    // Init mp3 decoder
-    mp3dec_ex_open_cb(&m_decoder, &m_io, MP3D_SEEK_TO_SAMPLE);
+    // Init mp3 decoder, without scanning the file: if it has a Xing/Info
+    // header, its length is known right away and the frames are indexed
+    // only when seeking
+    mp3dec_ex_open_cb(&m_decoder, &m_io, MP3D_SEEK_TO_SAMPLE | MP3D_DO_NOT_SCAN);
+
+    // Otherwise the whole file has to be scanned to know its length, unless a saved index is available
+    m_streamSize = stream.getSize();
+    if (!loadSeekIndex() && !m_decoder.vbr_tag_found)
+    {
+        mp3dec_ex_close(&m_decoder);
+        mp3dec_ex_open_cb(&m_decoder, &m_io, MP3D_SEEK_TO_SAMPLE);
+    }
+
     if (!m_decoder.samples)
         return std::nullopt;
 
@@ -135,7 +210,9 @@ std::optional<SoundFileReader::Info> SoundFileReaderMp3::open(InputStream& strea
     info.sampleRate   = static_cast<unsigned int>(m_decoder.info.hz);
     info.sampleCount  = m_decoder.samples;
 
-    m_numSamples = info.sampleCount;
+    m_numSamples    = info.sampleCount;
+    m_indexComplete = m_decoder.indexes_built != 0;
+    m_scanOffset    = m_decoder.start_offset;
     return info;
 }
 
@@ -144,6 +221,7 @@ std::optional<SoundFileReader::Info> SoundFileReaderMp3::open(InputStream& strea
 void SoundFileReaderMp3::seek(std::uint64_t sampleOffset)
 {
     m_position = std::min(sampleOffset, m_numSamples);
+    extendSeekIndex(m_position + static_cast<std::uint64_t>(m_decoder.start_delay));
     mp3dec_ex_seek(&m_decoder, m_position);
 }
 
@@ -157,4 +235,136 @@ std::uint64_t SoundFileReaderMp3::read(std::int16_t* samples, std::uint64_t maxC
     return toRead;
 }
 
+
+////////////////////////////////////////////////////////////
+void SoundFileReaderMp3::setSeekIndex(std::vector<std::uint8_t> index)
+{
+    m_seekIndex = std::move(index);
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::vector<std::uint8_t>> SoundFileReaderMp3::getSeekIndex()
+{
+    // Index the remaining frames, and restore the read position that the scan moved
+    if (!m_indexComplete)
+    {
+        extendSeekIndex(std::numeric_limits<std::uint64_t>::max());
+        mp3dec_ex_seek(&m_decoder, m_position);
+    }
+
+    const mp3dec_index_t& frames = m_decoder.index;
+
+    std::vector<std::uint8_t> index(seekIndexMagic, seekIndexMagic + sizeof(seekIndexMagic));
+    index.reserve(sizeof(seekIndexMagic) + (seekIndexHeaderValues + frames.num_frames * 2) * 8);
+    writeValue(index, seekIndexVersion);
+    writeValue(index, static_cast<std::uint64_t>(m_streamSize));
+    writeValue(index, m_decoder.start_offset);
+    writeValue(index, static_cast<std::uint64_t>(m_decoder.info.channels));
+    writeValue(index, static_cast<std::uint64_t>(m_decoder.info.hz));
+    writeValue(index, m_numSamples);
+    writeValue(index, frames.num_frames);
+    for (std::size_t i = 0; i < frames.num_frames; ++i)
+    {
+        writeValue(index, frames.frames[i].sample);
+        writeValue(index, frames.frames[i].offset);
+    }
+
+    return index;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundFileReaderMp3::loadSeekIndex()
+{
+    const std::vector<std::uint8_t> index = std::exchange(m_seekIndex, {});
+    if (index.empty())
+        return false;
+
+    const auto fail = []
+    {
+        err() << "Ignoring the seek index of MP3 file (it doesn't match the file)" << std::endl;
+        return false;
+    };
+
+    // Check the header: the index must have been built for this very file
+    constexpr std::size_t headerSize = sizeof(seekIndexMagic) + seekIndexHeaderValues * 8;
+    if ((index.size() < headerSize) || (std::memcmp(index.data(), seekIndexMagic, sizeof(seekIndexMagic)) != 0))
+        return fail();
+
+    std::size_t         position    = sizeof(seekIndexMagic);
+    const std::uint64_t version     = readValue(index, position);
+    const std::uint64_t streamSize  = readValue(index, position);
+    const std::uint64_t startOffset = readValue(index, position);
+    const std::uint64_t channels    = readValue(index, position);
+    const std::uint64_t sampleRate  = readValue(index, position);
+    const std::uint64_t sampleCount = readValue(index, position);
+    const std::uint64_t frameCount  = readValue(index, position);
+    if ((version != seekIndexVersion) || (streamSize != static_cast<std::uint64_t>(m_streamSize)) ||
+        (startOffset != m_decoder.start_offset) || (channels != static_cast<std::uint64_t>(m_decoder.info.channels)) ||
+        (sampleRate != static_cast<std::uint64_t>(m_decoder.info.hz)) || (sampleCount == 0) ||
+        (m_decoder.vbr_tag_found && (sampleCount != m_decoder.samples)) || (frameCount == 0) ||
+        (frameCount != (index.size() - headerSize) / 16) || ((index.size() - headerSize) % 16 != 0))
+        return fail();
+
+    // Read the frames; minimp3 owns its index and releases it with free()
+    const auto frameArraySize = static_cast<std::size_t>(frameCount);
+    auto*      frames         = static_cast<mp3dec_frame_t*>(std::malloc(sizeof(mp3dec_frame_t) * frameArraySize));
+    if (!frames)
+        return false;
+
+    for (std::size_t i = 0; i < frameArraySize; ++i)
+    {
+        frames[i].sample = readValue(index, position);
+        frames[i].offset = readValue(index, position);
+        if ((frames[i].offset >= streamSize) || ((i > 0) && (frames[i].sample < frames[i - 1].sample)))
+        {
+            std::free(frames);
+            return fail();
+        }
+    }
+
+    // Install the index, as if the whole file had been scanned
+    std::free(m_decoder.index.frames);
+    m_decoder.index.frames     = frames;
+    m_decoder.index.num_frames = frameArraySize;
+    m_decoder.index.capacity   = frameArraySize;
+    m_decoder.indexes_built    = 1;
+    m_decoder.samples          = sampleCount;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundFileReaderMp3::extendSeekIndex(std::uint64_t sample)
+{
+    if (m_indexComplete || (m_scanSamples > sample))
+        return;
+
+    // The decoder counts the indexed samples in the same member as the total
+    // number of samples, and tracks the first decodable frame in its buffer state:
+    // swap in the state of the scan for the duration of the scan
+    const std::uint64_t sampleCount   = std::exchange(m_decoder.samples, m_scanSamples);
+    const int           bufferSamples = std::exchange(m_decoder.buffer_samples, m_scanBufferSamples);
+
+    IndexScan scan{&m_decoder, m_scanOffset, sample, m_scanOffset};
+
+    int result = MP3D_E_IOERROR;
+    if (m_io.seek(m_scanOffset, m_io.seek_data) == 0)
+        result = mp3dec_iterate_cb(&m_io,
+                                   const_cast<std::uint8_t*>(m_decoder.file.buffer),
+                                   m_decoder.file.size,
+                                   scanCallback,
+                                   &scan);
+
+    m_scanSamples       = std::exchange(m_decoder.samples, sampleCount);
+    m_scanBufferSamples = std::exchange(m_decoder.buffer_samples, bufferSamples);
+    m_scanOffset        = scan.resumeOffset;
+
+    // The scan either stopped after the target, or reached the end of the
+    // file (or a part it can't read, in which case there's nothing more to index)
+    m_decoder.indexes_built = 1;
+    m_indexComplete         = result != MP3D_E_USER;
+}
+
 } // namespace sf::priv
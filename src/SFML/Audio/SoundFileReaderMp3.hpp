@@ -49,6 +49,7 @@
 #include <SFML/Audio/SoundFileReader.hpp>
 
 #include <optional>
+#include <vector>
 
 #include <cstdint>
 
@@ -120,14 +121,57 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::uint64_t read(std::int16_t* samples, std::uint64_t maxCount) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Provide the seek index to use when opening the file
+    ///
+    /// \param index Seek index previously returned by getSeekIndex
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSeekIndex(std::vector<std::uint8_t> index) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Build the complete seek index of the open file
+    ///
+    /// \return Seek index of the file
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<std::vector<std::uint8_t>> getSeekIndex() override;
+
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Install the seek index given to setSeekIndex in the decoder
+    ///
+    /// \return True if the index matches the open file and was installed
+    ///
+    ////////////////////////////////////////////////////////////
+    bool loadSeekIndex();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extend the seek index until it covers a sample
+    ///
+    /// The frames are indexed incrementally, from the last one
+    /// indexed so far, so that opening a file doesn't have to
+    /// scan it entirely. This moves the stream's read position,
+    /// the decoder must seek afterwards.
+    ///
+    /// \param sample Sample (including the encoder delay) that the index must cover
+    ///
+    ////////////////////////////////////////////////////////////
+    void extendSeekIndex(std::uint64_t sample);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    mp3dec_io_t   m_io{};
-    mp3dec_ex_t   m_decoder{};
-    std::uint64_t m_numSamples{}; // Decompressed audio storage size
-    std::uint64_t m_position{};   // Position in decompressed audio buffer
+    mp3dec_io_t               m_io{};
+    mp3dec_ex_t               m_decoder{};
+    std::uint64_t             m_numSamples{};        // Decompressed audio storage size
+    std::uint64_t             m_position{};          // Position in decompressed audio buffer
+    std::int64_t              m_streamSize{};        // Size of the open stream, in bytes
+    std::vector<std::uint8_t> m_seekIndex;           // Seek index to install when opening the file
+    bool                      m_indexComplete{};     // Whether every frame of the file is indexed
+    std::uint64_t             m_scanOffset{};        // Position in the stream where indexing resumes
+    std::uint64_t             m_scanSamples{};       // Number of samples in the frames indexed so far
+    int                       m_scanBufferSamples{}; // Samples of the first decodable frame, 0 if not found yet
 };
 
 } // namespace sf::priv
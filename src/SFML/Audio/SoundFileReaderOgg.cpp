@@ -30,6 +30,7 @@
 #include <SFML/System/Err.hpp>
 #include <SFML/System/InputStream.hpp>
 
+#include <algorithm>
 #include <ostream>
 
 #include <cassert>
@@ -156,6 +157,35 @@ std::uint64_t SoundFileReaderOgg::read(std::int16_t* samples, std::uint64_t maxC
 }
 
 
+////////////////////////////////////////////////////////////
+std::uint64_t SoundFileReaderOgg::readFloat(float* samples, std::uint64_t maxCount)
+{
+    assert(m_vorbis.datasource && "Vorbis datasource is missing. Call SoundFileReaderOgg::open() to initialize it.");
+
+    // Vorbis decodes whole frames of planar samples, which we interleave
+    std::uint64_t count = 0;
+    while (maxCount - count >= m_channelCount)
+    {
+        const auto frameCount = static_cast<int>(std::min<std::uint64_t>((maxCount - count) / m_channelCount, 4096));
+        float**    pcm        = nullptr;
+        const long framesRead = ov_read_float(&m_vorbis, &pcm, frameCount, nullptr);
+        if (framesRead <= 0)
+        {
+            // error or end of file
+            break;
+        }
+
+        for (long i = 0; i < framesRead; ++i)
+            for (unsigned int j = 0; j < m_channelCount; ++j)
+                *samples++ = pcm[j][i];
+
+        count += static_cast<std::uint64_t>(framesRead) * m_channelCount;
+    }
+
+    return count;
+}
+
+
 ////////////////////////////////////////////////////////////
 void SoundFileReaderOgg::close()
 {
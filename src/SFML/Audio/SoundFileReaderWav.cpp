@@ -25,13 +25,17 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Audio/SampleConversion.hpp>
 #include <SFML/Audio/SoundFileReaderWav.hpp>
 
 #include <SFML/System/Err.hpp>
 #include <SFML/System/InputStream.hpp>
 #include <SFML/System/Utils.hpp>
 
+#include <algorithm>
+#include <array>
 #include <ostream>
+#include <type_traits>
 
 #include <cassert>
 #include <cstddef>
@@ -43,22 +47,6 @@ namespace
 // The following functions read integers as little endian and
 // return them in the host byte order
 
-bool decode(sf::InputStream& stream, std::uint8_t& value)
-{
-    return static_cast<std::size_t>(stream.read(&value, sizeof(value))) == sizeof(value);
-}
-
-bool decode(sf::InputStream& stream, std::int16_t& value)
-{
-    std::byte bytes[sizeof(value)];
-    if (static_cast<std::size_t>(stream.read(bytes, static_cast<std::int64_t>(sizeof(bytes)))) != sizeof(bytes))
-        return false;
-
-    value = sf::toInteger<std::int16_t>(bytes[0], bytes[1]);
-
-    return true;
-}
-
 bool decode(sf::InputStream& stream, std::uint16_t& value)
 {
     std::byte bytes[sizeof(value)];
@@ -70,37 +58,75 @@ bool decode(sf::InputStream& stream, std::uint16_t& value)
     return true;
 }
 
-bool decode24bit(sf::InputStream& stream, std::uint32_t& value)
+bool decode(sf::InputStream& stream, std::uint32_t& value)
 {
-    std::byte bytes[3];
+    std::byte bytes[sizeof(value)];
     if (static_cast<std::size_t>(stream.read(bytes, static_cast<std::int64_t>(sizeof(bytes)))) != sizeof(bytes))
         return false;
 
-    value = sf::toInteger<std::uint32_t>(bytes[0], bytes[1], bytes[2]);
+    value = sf::toInteger<std::uint32_t>(bytes[0], bytes[1], bytes[2], bytes[3]);
 
     return true;
 }
 
-bool decode(sf::InputStream& stream, std::uint32_t& value)
+// Decode a little endian sample and convert it to the requested sample type
+template <typename T>
+T decodeSample(const std::byte* bytes, unsigned int bytesPerSample, bool isFloat)
 {
-    std::byte bytes[sizeof(value)];
-    if (static_cast<std::size_t>(stream.read(bytes, static_cast<std::int64_t>(sizeof(bytes)))) != sizeof(bytes))
-        return false;
+    if (isFloat)
+    {
+        const auto bits   = sf::toInteger<std::uint32_t>(bytes[0], bytes[1], bytes[2], bytes[3]);
+        float      sample = 0.f;
+        std::memcpy(&sample, &bits, sizeof(sample));
 
-    value = sf::toInteger<std::uint32_t>(bytes[0], bytes[1], bytes[2], bytes[3]);
+        if constexpr (std::is_same_v<T, float>)
+            return sample;
+        else
+            return sf::priv::toInt16Sample(sample);
+    }
 
-    return true;
+    // Integer samples are scaled to the full 32-bit range, 8-bit samples are unsigned
+    std::uint32_t sample = 0;
+    switch (bytesPerSample)
+    {
+        case 1:
+            sample = (std::to_integer<std::uint32_t>(bytes[0]) ^ 0x80u) << 24;
+            break;
+        case 2:
+            sample = sf::toInteger<std::uint32_t>(bytes[0], bytes[1]) << 16;
+            break;
+        case 3:
+            sample = sf::toInteger<std::uint32_t>(bytes[0], bytes[1], bytes[2]) << 8;
+            break;
+        case 4:
+            sample = sf::toInteger<std::uint32_t>(bytes[0], bytes[1], bytes[2], bytes[3]);
+            break;
+        default:
+            assert(false && "Invalid bytes per sample. Must be 1, 2, 3, or 4.");
+            break;
+    }
+
+    if constexpr (std::is_same_v<T, float>)
+        return static_cast<float>(static_cast<std::int32_t>(sample)) / 2147483648.f;
+    else
+        return static_cast<std::int16_t>(sample >> 16);
 }
 
 const std::uint64_t mainChunkSize = 12;
 
 const std::uint16_t waveFormatPcm = 1;
 
+const std::uint16_t waveFormatIeeeFloat = 3;
+
 const std::uint16_t waveFormatExtensible = 65534;
 
 const char* waveSubformatPcm =
     "\x01\x00\x00\x00\x00\x00\x10\x00"
     "\x80\x00\x00\xAA\x00\x38\x9B\x71";
+
+const char* waveSubformatIeeeFloat =
+    "\x03\x00\x00\x00\x00\x00\x10\x00"
+    "\x80\x00\x00\xAA\x00\x38\x9B\x71";
 } // namespace
 
 namespace sf::priv
@@ -135,7 +161,7 @@ void SoundFileReaderWav::seek(std::uint64_t sampleOffset)
 {
     assert(m_stream && "Input stream cannot be null. Call SoundFileReaderWav::open() to initialize it.");
 
-    if (m_stream->seek(static_cast<std::int64_t>(m_dataStart + sampleOffset * m_bytesPerSample) == -1))
+    if (m_stream->seek(static_cast<std::int64_t>(m_dataStart + sampleOffset * m_bytesPerSample)) == -1)
         err() << "Failed to seek WAV sound stream" << std::endl;
 }
 
@@ -143,65 +169,48 @@ void SoundFileReaderWav::seek(std::uint64_t sampleOffset)
 ////////////////////////////////////////////////////////////
 std::uint64_t SoundFileReaderWav::read(std::int16_t* samples, std::uint64_t maxCount)
 {
-    assert(m_stream && "Input stream cannot be null. Call SoundFileReaderWav::open() to initialize it.");
-
-    std::uint64_t count    = 0;
-    const auto    startPos = static_cast<std::uint64_t>(m_stream->tell());
+    return readSamples(samples, maxCount);
+}
 
-    // Tracking of m_dataEnd is important to prevent sf::Music from reading
-    // data until EOF, as WAV files may have metadata at the end.
-    while ((count < maxCount) && (startPos + count * m_bytesPerSample < m_dataEnd))
-    {
-        switch (m_bytesPerSample)
-        {
-            case 1:
-            {
-                std::uint8_t sample = 0;
-                if (decode(*m_stream, sample))
-                    *samples++ = static_cast<std::int16_t>((static_cast<std::int16_t>(sample) - 128) << 8);
-                else
-                    return count;
-                break;
-            }
 
-            case 2:
-            {
-                std::int16_t sample = 0;
-                if (decode(*m_stream, sample))
-                    *samples++ = sample;
-                else
-                    return count;
-                break;
-            }
+////////////////////////////////////////////////////////////
+std::uint64_t SoundFileReaderWav::readFloat(float* samples, std::uint64_t maxCount)
+{
+    return readSamples(samples, maxCount);
+}
 
-            case 3:
-            {
-                std::uint32_t sample = 0;
-                if (decode24bit(*m_stream, sample))
-                    *samples++ = static_cast<std::int16_t>(sample >> 8);
-                else
-                    return count;
-                break;
-            }
 
-            case 4:
-            {
-                std::uint32_t sample = 0;
-                if (decode(*m_stream, sample))
-                    *samples++ = static_cast<std::int16_t>(sample >> 16);
-                else
-                    return count;
-                break;
-            }
-
-            default:
-            {
-                assert(false && "Invalid bytes per sample. Must be 1, 2, 3, or 4.");
-                return 0;
-            }
-        }
+////////////////////////////////////////////////////////////
+template <typename T>
+std::uint64_t SoundFileReaderWav::readSamples(T* samples, std::uint64_t maxCount)
+{
+    assert(m_stream && "Input stream cannot be null. Call SoundFileReaderWav::open() to initialize it.");
 
-        ++count;
+    // Tracking of m_dataEnd is important to prevent sf::Music from reading
+    // data until EOF, as WAV files may have metadata at the end.
+    const std::int64_t position = m_stream->tell();
+    if ((position < 0) || (static_cast<std::uint64_t>(position) >= m_dataEnd))
+        return 0;
+    maxCount = std::min(maxCount, (m_dataEnd - static_cast<std::uint64_t>(position)) / m_bytesPerSample);
+
+    // Read the raw samples by blocks, and decode them
+    std::array<std::byte, 12288> buffer; // Multiple of all the supported sample sizes
+    std::uint64_t                count = 0;
+    while (count < maxCount)
+    {
+        const std::uint64_t blockCount = std::min<std::uint64_t>(buffer.size() / m_bytesPerSample, maxCount - count);
+        const std::int64_t  bytesRead  = m_stream->read(buffer.data(),
+                                                      static_cast<std::int64_t>(blockCount * m_bytesPerSample));
+        if (bytesRead <= 0)
+            break;
+
+        const std::uint64_t samplesRead = static_cast<std::uint64_t>(bytesRead) / m_bytesPerSample;
+        for (std::uint64_t i = 0; i < samplesRead; ++i)
+            *samples++ = decodeSample<T>(buffer.data() + i * m_bytesPerSample, m_bytesPerSample, m_isFloat);
+
+        count += samplesRead;
+        if (samplesRead < blockCount)
+            break;
     }
 
     return count;
@@ -246,8 +255,9 @@ std::optional<SoundFileReader::Info> SoundFileReaderWav::parseHeader()
             std::uint16_t format = 0;
             if (!decode(*m_stream, format))
                 return std::nullopt;
-            if ((format != waveFormatPcm) && (format != waveFormatExtensible))
+            if ((format != waveFormatPcm) && (format != waveFormatIeeeFloat) && (format != waveFormatExtensible))
                 return std::nullopt;
+            m_isFloat = (format == waveFormatIeeeFloat);
 
             // Channel count
             std::uint16_t channelCount = 0;
@@ -306,7 +316,8 @@ std::optional<SoundFileReader::Info> SoundFileReaderWav::parseHeader()
                     sizeof(subformat))
                     return std::nullopt;
 
-                if (std::memcmp(subformat, waveSubformatPcm, sizeof(subformat)) != 0)
+                m_isFloat = (std::memcmp(subformat, waveSubformatIeeeFloat, sizeof(subformat)) == 0);
+                if (!m_isFloat && (std::memcmp(subformat, waveSubformatPcm, sizeof(subformat)) != 0))
                 {
                     err() << "Unsupported format: extensible format with non-PCM subformat" << std::endl;
                     return std::nullopt;
@@ -322,6 +333,13 @@ std::optional<SoundFileReader::Info> SoundFileReaderWav::parseHeader()
                 }
             }
 
+            if (m_isFloat && (bitsPerSample != 32))
+            {
+                err() << "Unsupported sample size: " << bitsPerSample
+                      << " bit float (Supported float sample size is 32 bit)" << std::endl;
+                return std::nullopt;
+            }
+
             // Skip potential extra information
             if (m_stream->seek(subChunkStart + subChunkSize) == -1)
                 return std::nullopt;
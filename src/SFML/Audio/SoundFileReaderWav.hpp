@@ -94,6 +94,17 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::uint64_t read(std::int16_t* samples, std::uint64_t maxCount) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read audio samples from the open file, as floats
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t readFloat(float* samples, std::uint64_t maxCount) override;
+
 private:
     ////////////////////////////////////////////////////////////
     /// \brief Read the header of the open file
@@ -105,11 +116,24 @@ private:
     ////////////////////////////////////////////////////////////
     std::optional<Info> parseHeader();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read and decode samples of any supported format
+    ///
+    /// \param samples  Pointer to the sample array to fill
+    /// \param maxCount Maximum number of samples to read
+    ///
+    /// \return Number of samples actually read (may be less than \a maxCount)
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    std::uint64_t readSamples(T* samples, std::uint64_t maxCount);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
     InputStream*  m_stream{};         //!< Source stream to read from
     unsigned int  m_bytesPerSample{}; //!< Size of a sample, in bytes
+    bool          m_isFloat{};        //!< Whether the samples are stored as 32-bit floats
     std::uint64_t m_dataStart{};      //!< Starting position of the audio data in the open file
     std::uint64_t m_dataEnd{};        //!< Position one byte past the end of the audio data in the open file
 };
@@ -33,6 +33,24 @@
 #include <algorithm>
 #include <ostream>
 
+#include <cmath>
+
+
+namespace
+{
+// Convert a sample to a FLAC sample of the given size (16 or 24 bits)
+std::int32_t toFlacSample(std::int16_t sample, unsigned int bitsPerSample)
+{
+    return sample * (1 << (bitsPerSample - 16));
+}
+
+std::int32_t toFlacSample(float sample, unsigned int bitsPerSample)
+{
+    const auto scale = static_cast<float>(1 << (bitsPerSample - 1));
+    return static_cast<std::int32_t>(std::lrint(std::clamp(sample * scale, -scale, scale - 1.f)));
+}
+} // namespace
+
 
 namespace sf::priv
 {
@@ -51,6 +69,14 @@ bool SoundFileWriterFlac::check(const std::filesystem::path& filename)
 }
 
 
+////////////////////////////////////////////////////////////
+void SoundFileWriterFlac::setSampleFormat(SampleFormat sampleFormat)
+{
+    // FLAC has no float samples, 24 bits keep all the precision that matters for audio
+    m_bitsPerSample = (sampleFormat == SampleFormat::Float32) ? 24 : 16;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool SoundFileWriterFlac::open(const std::filesystem::path& filename, unsigned int sampleRate, unsigned int channelCount)
 {
@@ -65,7 +91,7 @@ bool SoundFileWriterFlac::open(const std::filesystem::path& filename, unsigned i
 
     // Setup the encoder
     FLAC__stream_encoder_set_channels(m_encoder.get(), channelCount);
-    FLAC__stream_encoder_set_bits_per_sample(m_encoder.get(), 16);
+    FLAC__stream_encoder_set_bits_per_sample(m_encoder.get(), m_bitsPerSample);
     FLAC__stream_encoder_set_sample_rate(m_encoder.get(), sampleRate);
 
     // Initialize the output stream
@@ -86,6 +112,21 @@ bool SoundFileWriterFlac::open(const std::filesystem::path& filename, unsigned i
 
 ////////////////////////////////////////////////////////////
 void SoundFileWriterFlac::write(const std::int16_t* samples, std::uint64_t count)
+{
+    writeSamples(samples, count);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundFileWriterFlac::writeFloat(const float* samples, std::uint64_t count)
+{
+    writeSamples(samples, count);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void SoundFileWriterFlac::writeSamples(const T* samples, std::uint64_t count)
 {
     while (count > 0)
     {
@@ -93,7 +134,11 @@ void SoundFileWriterFlac::write(const std::int16_t* samples, std::uint64_t count
         const unsigned int frames = std::min(static_cast<unsigned int>(count / m_channelCount), 10000u);
 
         // Convert the samples to 32-bits
-        m_samples32.assign(samples, samples + frames * m_channelCount);
+        m_samples32.resize(frames * m_channelCount);
+        std::transform(samples,
+                       samples + m_samples32.size(),
+                       m_samples32.begin(),
+                       [this](T sample) { return toFlacSample(sample, m_bitsPerSample); });
 
         // Write them to the FLAC stream
         FLAC__stream_encoder_process_interleaved(m_encoder.get(), m_samples32.data(), frames);
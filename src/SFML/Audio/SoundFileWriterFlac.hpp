@@ -56,6 +56,16 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static bool check(const std::filesystem::path& filename);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Choose the format of the samples stored in the file
+    ///
+    /// Float samples are stored as 24-bit integers.
+    ///
+    /// \param sampleFormat Format of the samples to store
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSampleFormat(SampleFormat sampleFormat) override;
+
     ////////////////////////////////////////////////////////////
     /// \brief Open a sound file for writing
     ///
@@ -77,7 +87,26 @@ public:
     ////////////////////////////////////////////////////////////
     void write(const std::int16_t* samples, std::uint64_t count) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Write float audio samples to the open file
+    ///
+    /// \param samples Pointer to the sample array to write
+    /// \param count   Number of samples to write
+    ///
+    ////////////////////////////////////////////////////////////
+    void writeFloat(const float* samples, std::uint64_t count) override;
+
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert samples and pass them to the encoder
+    ///
+    /// \param samples Pointer to the sample array to write
+    /// \param count   Number of samples to write
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    void writeSamples(const T* samples, std::uint64_t count);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -85,9 +114,10 @@ private:
     {
         void operator()(FLAC__StreamEncoder* encoder) const;
     };
-    std::unique_ptr<FLAC__StreamEncoder, FlacStreamEncoderDeleter> m_encoder;        //!< FLAC stream encoder
-    unsigned int                                                   m_channelCount{}; //!< Number of channels
-    std::vector<std::int32_t>                                      m_samples32;      //!< Conversion buffer
+    std::unique_ptr<FLAC__StreamEncoder, FlacStreamEncoderDeleter> m_encoder;           //!< FLAC stream encoder
+    unsigned int                                                   m_channelCount{};    //!< Number of channels
+    unsigned int                                                   m_bitsPerSample{16}; //!< Size of the stored samples
+    std::vector<std::int32_t>                                      m_samples32;         //!< Conversion buffer
 };
 
 } // namespace sf::priv
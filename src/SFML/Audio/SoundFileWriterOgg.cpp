@@ -37,6 +37,21 @@
 #include <cassert>
 
 
+namespace
+{
+// Vorbis encodes float samples
+float toVorbisSample(std::int16_t sample)
+{
+    return sample / 32767.0f;
+}
+
+float toVorbisSample(float sample)
+{
+    return sample;
+}
+} // namespace
+
+
 namespace sf::priv
 {
 ////////////////////////////////////////////////////////////
@@ -122,6 +137,21 @@ bool SoundFileWriterOgg::open(const std::filesystem::path& filename, unsigned in
 
 ////////////////////////////////////////////////////////////
 void SoundFileWriterOgg::write(const std::int16_t* samples, std::uint64_t count)
+{
+    writeSamples(samples, count);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundFileWriterOgg::writeFloat(const float* samples, std::uint64_t count)
+{
+    writeSamples(samples, count);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void SoundFileWriterOgg::writeSamples(const T* samples, std::uint64_t count)
 {
     // Vorbis has issues with buffers that are too large, so we ask for 64K
     constexpr int bufferSize = 65536;
@@ -135,10 +165,10 @@ void SoundFileWriterOgg::write(const std::int16_t* samples, std::uint64_t count)
         float** buffer = vorbis_analysis_buffer(&m_state, bufferSize);
         assert(buffer && "Vorbis buffer failed to allocate");
 
-        // Write the samples to the buffer, converted to float
+        // Write the samples to the buffer, as float
         for (int i = 0; i < std::min(frameCount, bufferSize); ++i)
             for (unsigned int j = 0; j < m_channelCount; ++j)
-                buffer[j][i] = *samples++ / 32767.0f;
+                buffer[j][i] = toVorbisSample(*samples++);
 
         // Tell the library how many samples we've written
         vorbis_analysis_wrote(&m_state, std::min(frameCount, bufferSize));
@@ -83,7 +83,26 @@ public:
     ////////////////////////////////////////////////////////////
     void write(const std::int16_t* samples, std::uint64_t count) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Write float audio samples to the open file
+    ///
+    /// \param samples Pointer to the sample array to write
+    /// \param count   Number of samples to write
+    ///
+    ////////////////////////////////////////////////////////////
+    void writeFloat(const float* samples, std::uint64_t count) override;
+
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Pass samples to the encoder
+    ///
+    /// \param samples Pointer to the sample array to write
+    /// \param count   Number of samples to write
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    void writeSamples(const T* samples, std::uint64_t count);
+
     ////////////////////////////////////////////////////////////
     /// \brief Flush blocks produced by the ogg stream, if any
     ///
@@ -25,6 +25,7 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Audio/SampleConversion.hpp>
 #include <SFML/Audio/SoundFileWriterWav.hpp>
 
 #include <SFML/System/Err.hpp>
@@ -34,6 +35,7 @@
 
 #include <cassert>
 #include <cstddef>
+#include <cstring>
 
 
 namespace
@@ -63,6 +65,13 @@ void encode(std::ostream& stream, std::uint32_t value)
     };
     stream.write(reinterpret_cast<const char*>(bytes), sizeof(bytes));
 }
+
+void encode(std::ostream& stream, float value)
+{
+    std::uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    encode(stream, bits);
+}
 } // namespace
 
 namespace sf::priv
@@ -81,6 +90,13 @@ SoundFileWriterWav::~SoundFileWriterWav()
 }
 
 
+////////////////////////////////////////////////////////////
+void SoundFileWriterWav::setSampleFormat(SampleFormat sampleFormat)
+{
+    m_sampleFormat = sampleFormat;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool SoundFileWriterWav::open(const std::filesystem::path& filename, unsigned int sampleRate, unsigned int channelCount)
 {
@@ -104,8 +120,34 @@ void SoundFileWriterWav::write(const std::int16_t* samples, std::uint64_t count)
 {
     assert(m_file.good() && "Most recent I/O operation failed");
 
-    while (count--)
-        encode(m_file, *samples++);
+    if (m_sampleFormat == SampleFormat::Float32)
+    {
+        while (count--)
+            encode(m_file, toFloatSample(*samples++));
+    }
+    else
+    {
+        while (count--)
+            encode(m_file, *samples++);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundFileWriterWav::writeFloat(const float* samples, std::uint64_t count)
+{
+    assert(m_file.good() && "Most recent I/O operation failed");
+
+    if (m_sampleFormat == SampleFormat::Float32)
+    {
+        while (count--)
+            encode(m_file, *samples++);
+    }
+    else
+    {
+        while (count--)
+            encode(m_file, toInt16Sample(*samples++));
+    }
 }
 
 
@@ -129,18 +171,20 @@ void SoundFileWriterWav::writeHeader(unsigned int sampleRate, unsigned int chann
     const std::uint32_t fmtChunkSize = 16;
     encode(m_file, fmtChunkSize);
 
-    // Write the format (PCM)
-    const std::uint16_t format = 1;
+    // Write the format (PCM or IEEE float)
+    const bool          isFloat = (m_sampleFormat == SampleFormat::Float32);
+    const std::uint16_t format  = isFloat ? 3 : 1;
     encode(m_file, format);
 
     // Write the sound attributes
+    const unsigned int bytesPerSample = isFloat ? 4 : 2;
     encode(m_file, static_cast<std::uint16_t>(channelCount));
     encode(m_file, sampleRate);
-    const std::uint32_t byteRate = sampleRate * channelCount * 2;
+    const std::uint32_t byteRate = sampleRate * channelCount * bytesPerSample;
     encode(m_file, byteRate);
-    const auto blockAlign = static_cast<std::uint16_t>(channelCount * 2);
+    const auto blockAlign = static_cast<std::uint16_t>(channelCount * bytesPerSample);
     encode(m_file, blockAlign);
-    const std::uint16_t bitsPerSample = 16;
+    const auto bitsPerSample = static_cast<std::uint16_t>(bytesPerSample * 8);
     encode(m_file, bitsPerSample);
 
     // Write the sub-chunk 2 ("data") id and size
@@ -60,6 +60,14 @@ public:
     ////////////////////////////////////////////////////////////
     ~SoundFileWriterWav() override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Choose the format of the samples stored in the file
+    ///
+    /// \param sampleFormat Format of the samples to store
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSampleFormat(SampleFormat sampleFormat) override;
+
     ////////////////////////////////////////////////////////////
     /// \brief Open a sound file for writing
     ///
@@ -81,6 +89,15 @@ public:
     ////////////////////////////////////////////////////////////
     void write(const std::int16_t* samples, std::uint64_t count) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Write float audio samples to the open file
+    ///
+    /// \param samples Pointer to the sample array to write
+    /// \param count   Number of samples to write
+    ///
+    ////////////////////////////////////////////////////////////
+    void writeFloat(const float* samples, std::uint64_t count) override;
+
 private:
     ////////////////////////////////////////////////////////////
     /// \brief Write the header of the open file
@@ -100,7 +117,8 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::ofstream m_file; //!< File stream to write to
+    std::ofstream m_file;                              //!< File stream to write to
+    SampleFormat  m_sampleFormat{SampleFormat::Int16}; //!< Format of the samples stored in the file
 };
 
 } // namespace sf::priv
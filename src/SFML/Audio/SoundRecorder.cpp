@@ -32,6 +32,7 @@
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Sleep.hpp>
 
+#include <algorithm>
 #include <ostream>
 
 #include <cassert>
@@ -96,8 +97,10 @@ bool SoundRecorder::start(unsigned int sampleRate)
         return false;
     }
 
-    // Clear the array of samples
+    // Clear the array of samples, and make room for a full capture buffer so that
+    // the capturing thread never has to allocate
     m_samples.clear();
+    m_samples.reserve(static_cast<std::size_t>(sampleRate) * m_channelCount);
 
     // Store the sample rate
     m_sampleRate = sampleRate;
@@ -292,6 +295,10 @@ void SoundRecorder::processCapturedSamples()
     ALCint samplesAvailable;
     alcGetIntegerv(captureDevice, ALC_CAPTURE_SAMPLES, 1, &samplesAvailable);
 
+    // Never get more than the preallocated buffer can hold, the rest is processed next time
+    const auto maxFrames = static_cast<ALCint>(m_samples.capacity() / m_channelCount);
+    samplesAvailable     = std::min(samplesAvailable, maxFrames);
+
     if (samplesAvailable > 0)
     {
         // Get the recorded samples
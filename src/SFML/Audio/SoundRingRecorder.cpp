@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/SampleRing.hpp>
+#include <SFML/Audio/SoundRingRecorder.hpp>
+
+#include <algorithm>
+
+#include <cassert>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SoundRingRecorder::SoundRingRecorder() : m_ring(std::make_unique<priv::SampleRing>())
+{
+    setProcessingInterval(milliseconds(5));
+}
+
+
+////////////////////////////////////////////////////////////
+SoundRingRecorder::~SoundRingRecorder()
+{
+    // Make sure to stop the recording thread
+    stop();
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundRingRecorder::setBufferDuration(Time duration)
+{
+    m_bufferDuration = duration;
+}
+
+
+////////////////////////////////////////////////////////////
+Time SoundRingRecorder::getBufferDuration() const
+{
+    return m_bufferDuration;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SoundRingRecorder::read(std::int16_t* samples, std::size_t maxCount)
+{
+    assert(samples || maxCount == 0);
+
+    return m_ring->read(samples, maxCount);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SoundRingRecorder::getAvailableSamples() const
+{
+    return m_ring->getAvailableSamples();
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t SoundRingRecorder::getOverrunCount() const
+{
+    return m_ring->getOverrunCount();
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t SoundRingRecorder::getUnderrunCount() const
+{
+    return m_ring->getUnderrunCount();
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundRingRecorder::onStart()
+{
+    // Allocate the ring buffer up front, so that the capture thread never has to
+    const auto frames = std::max(m_bufferDuration.asMicroseconds(), std::int64_t{0}) * getSampleRate() / 1000000;
+    m_ring->reset(static_cast<std::size_t>(frames) * getChannelCount(), getChannelCount());
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundRingRecorder::onProcessSamples(const std::int16_t* samples, std::size_t sampleCount)
+{
+    // When the reader is late, keep what was already captured and drop the newest samples
+    m_ring->write(samples, sampleCount);
+
+    return true;
+}
+
+} // namespace sf
@@ -36,135 +36,133 @@ namespace sf
 {
 // NOLINTBEGIN(readability-make-member-function-const)
 ////////////////////////////////////////////////////////////
-SoundSource::SoundSource()
-{
-    alCheck(alGenSources(1, &m_source));
-    alCheck(alSourcei(m_source, AL_BUFFER, 0));
-}
+SoundSource::SoundSource() = default;
 
 
 ////////////////////////////////////////////////////////////
-SoundSource::SoundSource(const SoundSource& copy)
+SoundSource::SoundSource(const SoundSource& copy) :
+AlResource(),
+m_pitch(copy.m_pitch),
+m_volume(copy.m_volume),
+m_position(copy.m_position),
+m_relative(copy.m_relative),
+m_minDistance(copy.m_minDistance),
+m_attenuation(copy.m_attenuation)
+// don't copy the OpenAL source
 {
-    alCheck(alGenSources(1, &m_source));
-    alCheck(alSourcei(m_source, AL_BUFFER, 0));
-
-    setPitch(copy.getPitch());
-    setVolume(copy.getVolume());
-    setPosition(copy.getPosition());
-    setRelativeToListener(copy.isRelativeToListener());
-    setMinDistance(copy.getMinDistance());
-    setAttenuation(copy.getAttenuation());
 }
 
 
 ////////////////////////////////////////////////////////////
 SoundSource::~SoundSource()
 {
-    alCheck(alSourcei(m_source, AL_BUFFER, 0));
-    alCheck(alDeleteSources(1, &m_source));
+    if (m_source)
+    {
+        alCheck(alSourcei(m_source, AL_BUFFER, 0));
+        alCheck(alDeleteSources(1, &m_source));
+    }
 }
 
 
 ////////////////////////////////////////////////////////////
 void SoundSource::setPitch(float pitch)
 {
-    alCheck(alSourcef(m_source, AL_PITCH, pitch));
+    m_pitch = pitch;
+
+    if (m_source)
+        alCheck(alSourcef(m_source, AL_PITCH, pitch));
 }
 
 
 ////////////////////////////////////////////////////////////
 void SoundSource::setVolume(float volume)
 {
-    alCheck(alSourcef(m_source, AL_GAIN, volume * 0.01f));
+    m_volume = volume;
+
+    if (m_source)
+        alCheck(alSourcef(m_source, AL_GAIN, volume * 0.01f));
 }
 
 
 ////////////////////////////////////////////////////////////
 void SoundSource::setPosition(const Vector3f& position)
 {
-    alCheck(alSource3f(m_source, AL_POSITION, position.x, position.y, position.z));
+    m_position = position;
+
+    if (m_source)
+        alCheck(alSource3f(m_source, AL_POSITION, position.x, position.y, position.z));
 }
 
 
 ////////////////////////////////////////////////////////////
 void SoundSource::setRelativeToListener(bool relative)
 {
-    alCheck(alSourcei(m_source, AL_SOURCE_RELATIVE, relative));
+    m_relative = relative;
+
+    if (m_source)
+        alCheck(alSourcei(m_source, AL_SOURCE_RELATIVE, relative));
 }
 
 
 ////////////////////////////////////////////////////////////
 void SoundSource::setMinDistance(float distance)
 {
-    alCheck(alSourcef(m_source, AL_REFERENCE_DISTANCE, distance));
+    m_minDistance = distance;
+
+    if (m_source)
+        alCheck(alSourcef(m_source, AL_REFERENCE_DISTANCE, distance));
 }
 
 
 ////////////////////////////////////////////////////////////
 void SoundSource::setAttenuation(float attenuation)
 {
-    alCheck(alSourcef(m_source, AL_ROLLOFF_FACTOR, attenuation));
+    m_attenuation = attenuation;
+
+    if (m_source)
+        alCheck(alSourcef(m_source, AL_ROLLOFF_FACTOR, attenuation));
 }
 
 
 ////////////////////////////////////////////////////////////
 float SoundSource::getPitch() const
 {
-    ALfloat pitch;
-    alCheck(alGetSourcef(m_source, AL_PITCH, &pitch));
-
-    return pitch;
+    return m_pitch;
 }
 
 
 ////////////////////////////////////////////////////////////
 float SoundSource::getVolume() const
 {
-    ALfloat gain;
-    alCheck(alGetSourcef(m_source, AL_GAIN, &gain));
-
-    return gain * 100.f;
+    return m_volume;
 }
 
 
 ////////////////////////////////////////////////////////////
 Vector3f SoundSource::getPosition() const
 {
-    Vector3f position;
-    alCheck(alGetSource3f(m_source, AL_POSITION, &position.x, &position.y, &position.z));
-
-    return position;
+    return m_position;
 }
 
 
 ////////////////////////////////////////////////////////////
 bool SoundSource::isRelativeToListener() const
 {
-    ALint relative;
-    alCheck(alGetSourcei(m_source, AL_SOURCE_RELATIVE, &relative));
-
-    return relative != 0;
+    return m_relative;
 }
 
 
 ////////////////////////////////////////////////////////////
 float SoundSource::getMinDistance() const
 {
-    ALfloat distance;
-    alCheck(alGetSourcef(m_source, AL_REFERENCE_DISTANCE, &distance));
-
-    return distance;
+    return m_minDistance;
 }
 
 
 ////////////////////////////////////////////////////////////
 float SoundSource::getAttenuation() const
 {
-    ALfloat attenuation;
-    alCheck(alGetSourcef(m_source, AL_ROLLOFF_FACTOR, &attenuation));
-
-    return attenuation;
+    return m_attenuation;
 }
 
 
@@ -189,6 +187,10 @@ SoundSource& SoundSource::operator=(const SoundSource& right)
 ////////////////////////////////////////////////////////////
 SoundSource::Status SoundSource::getStatus() const
 {
+    // A sound without an OpenAL source can't be playing
+    if (!m_source)
+        return Stopped;
+
     ALint status;
     alCheck(alGetSourcei(m_source, AL_SOURCE_STATE, &status));
 
@@ -205,6 +207,27 @@ SoundSource::Status SoundSource::getStatus() const
 
     return Stopped;
 }
+
+
+////////////////////////////////////////////////////////////
+void SoundSource::createSource()
+{
+    alCheck(alGenSources(1, &m_source));
+    applyProperties();
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundSource::applyProperties()
+{
+    alCheck(alSourcei(m_source, AL_BUFFER, 0));
+    alCheck(alSourcef(m_source, AL_PITCH, m_pitch));
+    alCheck(alSourcef(m_source, AL_GAIN, m_volume * 0.01f));
+    alCheck(alSource3f(m_source, AL_POSITION, m_position.x, m_position.y, m_position.z));
+    alCheck(alSourcei(m_source, AL_SOURCE_RELATIVE, m_relative));
+    alCheck(alSourcef(m_source, AL_REFERENCE_DISTANCE, m_minDistance));
+    alCheck(alSourcef(m_source, AL_ROLLOFF_FACTOR, m_attenuation));
+}
 // NOLINTEND(readability-make-member-function-const)
 
 } // namespace sf
@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/ALCheck.hpp>
 #include <SFML/Audio/AudioDevice.hpp>
+#include <SFML/Audio/SampleConversion.hpp>
 #include <SFML/Audio/SoundStream.hpp>
 
 #include <SFML/System/Err.hpp>
@@ -47,6 +48,14 @@
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+SoundStream::SoundStream()
+{
+    // Streams keep their source for their whole lifetime, the streaming thread relies on it
+    createSource();
+}
+
+
 ////////////////////////////////////////////////////////////
 SoundStream::~SoundStream()
 {
@@ -58,10 +67,11 @@ SoundStream::~SoundStream()
 
 
 ////////////////////////////////////////////////////////////
-void SoundStream::initialize(unsigned int channelCount, unsigned int sampleRate)
+void SoundStream::initialize(unsigned int channelCount, unsigned int sampleRate, SampleFormat sampleFormat)
 {
     m_channelCount     = channelCount;
     m_sampleRate       = sampleRate;
+    m_sampleFormat     = sampleFormat;
     m_samplesProcessed = 0;
 
     {
@@ -69,8 +79,12 @@ void SoundStream::initialize(unsigned int channelCount, unsigned int sampleRate)
         m_isStreaming = false;
     }
 
-    // Deduce the format from the number of channels
-    m_format = priv::AudioDevice::getFormatFromChannelCount(channelCount);
+    // Deduce the format from the number of channels; float samples
+    // are converted to 16-bit if the device doesn't support float formats
+    m_format         = priv::AudioDevice::getFormatFromChannelCount(channelCount, sampleFormat);
+    m_convertSamples = (sampleFormat == SampleFormat::Float32) && (m_format == 0);
+    if (m_convertSamples)
+        m_format = priv::AudioDevice::getFormatFromChannelCount(channelCount);
 
     // Check if the format is valid
     if (m_format == 0)
@@ -171,6 +185,13 @@ unsigned int SoundStream::getSampleRate() const
 }
 
 
+////////////////////////////////////////////////////////////
+SampleFormat SoundStream::getSampleFormat() const
+{
+    return m_sampleFormat;
+}
+
+
 ////////////////////////////////////////////////////////////
 SoundStream::Status SoundStream::getStatus() const
 {
@@ -409,6 +430,14 @@ bool SoundStream::fillAndPushBuffer(unsigned int bufferNum, bool immediateLoop)
 {
     bool requestStop = false;
 
+    // The chunk holds 16-bit or float samples, depending on the format of the stream
+    const auto hasSamples = [this](const Chunk& chunk)
+    {
+        const bool hasPointer = (m_sampleFormat == SampleFormat::Float32) ? (chunk.floatSamples != nullptr)
+                                                                          : (chunk.samples != nullptr);
+        return hasPointer && (chunk.sampleCount != 0);
+    };
+
     // Acquire audio data, also address EOF and error cases if they occur
     Chunk data = {nullptr, 0};
     for (std::uint32_t retryCount = 0; !onGetData(data) && (retryCount < BufferRetries); ++retryCount)
@@ -417,7 +446,7 @@ bool SoundStream::fillAndPushBuffer(unsigned int bufferNum, bool immediateLoop)
         if (!m_loop)
         {
             // Not looping: Mark this buffer as ending with 0 and request stop
-            if (data.samples != nullptr && data.sampleCount != 0)
+            if (hasSamples(data))
                 m_bufferSeeks[bufferNum] = 0;
             requestStop = true;
             break;
@@ -428,7 +457,7 @@ bool SoundStream::fillAndPushBuffer(unsigned int bufferNum, bool immediateLoop)
         m_bufferSeeks[bufferNum] = onLoop();
 
         // If we got data, break and process it, else try to fill the buffer once again
-        if (data.samples != nullptr && data.sampleCount != 0)
+        if (hasSamples(data))
             break;
 
         // If immediateLoop is specified, we have to immediately adjust the sample count
@@ -443,13 +472,26 @@ bool SoundStream::fillAndPushBuffer(unsigned int bufferNum, bool immediateLoop)
     }
 
     // Fill the buffer if some data was returned
-    if (data.samples && data.sampleCount)
+    if (hasSamples(data))
     {
         const unsigned int buffer = m_buffers[bufferNum];
 
         // Fill the buffer
-        const auto size = static_cast<ALsizei>(data.sampleCount * sizeof(std::int16_t));
-        alCheck(alBufferData(buffer, m_format, data.samples, size, static_cast<ALsizei>(m_sampleRate)));
+        const void* samples = data.samples;
+        std::size_t size    = data.sampleCount * sizeof(std::int16_t);
+        if (m_convertSamples)
+        {
+            m_convertedSamples.resize(data.sampleCount);
+            priv::toInt16Samples(data.floatSamples, data.sampleCount, m_convertedSamples.data());
+            samples = m_convertedSamples.data();
+        }
+        else if (m_sampleFormat == SampleFormat::Float32)
+        {
+            samples = data.floatSamples;
+            size    = data.sampleCount * sizeof(float);
+        }
+        const auto sampleRate = static_cast<ALsizei>(m_sampleRate);
+        alCheck(alBufferData(buffer, m_format, samples, static_cast<ALsizei>(size), sampleRate));
 
         // Push it into the sound queue
         alCheck(alSourceQueueBuffers(m_source, 1, &buffer));
@@ -0,0 +1,373 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/ALCheck.hpp>
+#include <SFML/Audio/AudioDevice.hpp>
+#include <SFML/Audio/Sound.hpp>
+#include <SFML/Audio/VoiceManager.hpp>
+#include <SFML/Audio/VoicePolicy.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+#if defined(__APPLE__)
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+
+namespace
+{
+// State of the pool, shared by all the sounds; the mutex protects the lists and
+// counters, not the sounds, which must all be used from the same thread
+std::mutex                mutex;
+std::vector<unsigned int> freeSources;
+std::vector<sf::Sound*>   activeSounds;
+std::vector<sf::Sound*>   virtualSounds;
+std::size_t               maxVoices    = 64;
+std::size_t               soundCount   = 0;
+std::size_t               sourceCount  = 0;
+std::uint64_t             stolenVoices = 0;
+
+// Estimate how loud a sound is heard by the listener, or return a negative value if it is culled
+float getAudibility(const sf::Sound& sound)
+{
+    sf::Vector3f offset = sound.getPosition();
+    if (!sound.isRelativeToListener())
+        offset -= sf::priv::AudioDevice::getPosition();
+
+    return sf::priv::computeAudibility(offset,
+                                       sound.getVolume(),
+                                       sound.getMinDistance(),
+                                       sound.getAttenuation(),
+                                       sound.getCullDistance());
+}
+
+// Candidate for a voice, ranked by priority then by audibility
+struct Candidate
+{
+    sf::Sound*          sound;
+    sf::priv::VoiceRank rank;
+};
+
+Candidate makeCandidate(sf::Sound& sound)
+{
+    return {&sound, {sound.getPriority(), getAudibility(sound)}};
+}
+
+// Find the least audible sound that holds a voice
+std::vector<sf::Sound*>::iterator findQuietestActiveSound()
+{
+    return std::min_element(activeSounds.begin(),
+                            activeSounds.end(),
+                            [](sf::Sound* left, sf::Sound* right)
+                            { return sf::priv::isQuieter(makeCandidate(*left).rank, makeCandidate(*right).rank); });
+}
+
+void eraseSound(std::vector<sf::Sound*>& sounds, const sf::Sound& sound)
+{
+    const auto it = std::find(sounds.begin(), sounds.end(), &sound);
+    if (it != sounds.end())
+        sounds.erase(it);
+}
+} // namespace
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+void VoiceManager::addSound()
+{
+    const std::lock_guard lock(mutex);
+    ++soundCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void VoiceManager::removeSound()
+{
+    const std::lock_guard lock(mutex);
+
+    // Delete the sources with the last sound, while the audio device still exists
+    if (--soundCount == 0)
+    {
+        for (unsigned int source : freeSources)
+            alCheck(alDeleteSources(1, &source));
+
+        sourceCount -= freeSources.size();
+        freeSources.clear();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void VoiceManager::play(Sound& sound)
+{
+    const std::lock_guard lock(mutex);
+
+    // The sound may be restarted while it is virtual
+    eraseSound(virtualSounds, sound);
+
+    const Candidate candidate = makeCandidate(sound);
+    if (candidate.rank.audibility < 0.f)
+    {
+        virtualSounds.push_back(&sound);
+        return;
+    }
+
+    unsigned int source = takeFreeVoice();
+    if (!source)
+    {
+        // Steal the voice of the least audible sound, if this one is more audible
+        const auto quietest = findQuietestActiveSound();
+        if ((quietest == activeSounds.end()) || !isQuieter(makeCandidate(**quietest).rank, candidate.rank))
+        {
+            virtualSounds.push_back(&sound);
+            return;
+        }
+
+        source = takeVoice(**quietest);
+        ++stolenVoices;
+    }
+
+    sound.startVoice(source);
+    activeSounds.push_back(&sound);
+}
+
+
+////////////////////////////////////////////////////////////
+void VoiceManager::release(Sound& sound)
+{
+    const std::lock_guard lock(mutex);
+
+    if (sound.m_source)
+    {
+        eraseSound(activeSounds, sound);
+        freeSources.push_back(sound.stopVoice());
+
+        // Somebody else can use the voice now
+        fillVoices();
+    }
+    else
+    {
+        eraseSound(virtualSounds, sound);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void VoiceManager::update()
+{
+    const std::lock_guard lock(mutex);
+
+    // Take the voices back from the sounds that have finished or that are now out of range
+    for (std::size_t i = activeSounds.size(); i-- > 0;)
+    {
+        Sound& sound = *activeSounds[i];
+        if ((sound.getStatus() == Sound::Stopped) || (getAudibility(sound) < 0.f))
+            freeSources.push_back(takeVoice(sound));
+    }
+
+    fillVoices();
+
+    // Swap the voices of the least audible playing sounds with the most audible virtual ones;
+    // after fillVoices() the virtual sounds are sorted from the most to the least audible
+    std::vector<VoiceRank> activeRanks;
+    activeRanks.reserve(activeSounds.size());
+    for (Sound* sound : activeSounds)
+        activeRanks.push_back(makeCandidate(*sound).rank);
+
+    std::vector<VoiceRank> waitingRanks;
+    waitingRanks.reserve(virtualSounds.size());
+    for (Sound* sound : virtualSounds)
+        waitingRanks.push_back(makeCandidate(*sound).rank);
+
+    const std::vector<VoiceSwap> swaps = planVoiceSwaps(std::move(activeRanks), waitingRanks);
+    for (const VoiceSwap& swap : swaps)
+    {
+        Sound&             sound  = *virtualSounds[swap.waiting];
+        Sound&             victim = *activeSounds[swap.active];
+        const unsigned int source = victim.stopVoice();
+
+        sound.startVoice(source);
+        activeSounds[swap.active] = &sound;
+        ++stolenVoices;
+
+        // The victim is added to the end of the list, after the sounds that were candidates
+        if (victim.m_status == Sound::Playing)
+            virtualSounds.push_back(&victim);
+    }
+
+    // The swaps always promote the first candidates
+    virtualSounds.erase(virtualSounds.begin(), virtualSounds.begin() + static_cast<std::ptrdiff_t>(swaps.size()));
+}
+
+
+////////////////////////////////////////////////////////////
+void VoiceManager::setMaxVoices(std::size_t count)
+{
+    const std::lock_guard lock(mutex);
+
+    maxVoices = count;
+
+    // Delete the extra voices, starting with the free ones
+    while (sourceCount > maxVoices)
+    {
+        if (freeSources.empty())
+            freeSources.push_back(takeVoice(**findQuietestActiveSound()));
+
+        alCheck(alDeleteSources(1, &freeSources.back()));
+        freeSources.pop_back();
+        --sourceCount;
+    }
+
+    fillVoices();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t VoiceManager::getMaxVoices()
+{
+    const std::lock_guard lock(mutex);
+    return maxVoices;
+}
+
+
+////////////////////////////////////////////////////////////
+VoicePool::Statistics VoiceManager::getStatistics()
+{
+    const std::lock_guard lock(mutex);
+
+    VoicePool::Statistics statistics;
+    statistics.activeVoices  = activeSounds.size();
+    statistics.virtualVoices = virtualSounds.size();
+    statistics.sourceCount   = sourceCount;
+    statistics.stolenVoices  = stolenVoices;
+    return statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int VoiceManager::takeFreeVoice()
+{
+    if (!freeSources.empty())
+    {
+        const unsigned int source = freeSources.back();
+        freeSources.pop_back();
+        return source;
+    }
+
+    if (sourceCount < maxVoices)
+    {
+        unsigned int source = 0;
+        alGenSources(1, &source);
+        if ((alGetError() == AL_NO_ERROR) && source)
+        {
+            ++sourceCount;
+            return source;
+        }
+
+        // The implementation doesn't support more sources, don't try again
+        err() << "Failed to create more than " << sourceCount << " voices, the maximum is lowered accordingly"
+              << std::endl;
+        maxVoices = sourceCount;
+    }
+
+    // Reuse the voice of a sound that has reached its end
+    const auto finished = std::find_if(activeSounds.begin(),
+                                       activeSounds.end(),
+                                       [](const Sound* sound) { return sound->getStatus() == Sound::Stopped; });
+    if (finished != activeSounds.end())
+        return takeVoice(**finished);
+
+    return 0;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int VoiceManager::takeVoice(Sound& sound)
+{
+    eraseSound(activeSounds, sound);
+    const unsigned int source = sound.stopVoice();
+
+    if (sound.m_status == Sound::Playing)
+        virtualSounds.push_back(&sound);
+
+    return source;
+}
+
+
+////////////////////////////////////////////////////////////
+void VoiceManager::fillVoices()
+{
+    // Forget the virtual sounds that have reached their end
+    const auto finished = std::remove_if(virtualSounds.begin(),
+                                         virtualSounds.end(),
+                                         [](Sound* sound)
+                                         {
+                                             if (sound->getStatus() != Sound::Stopped)
+                                                 return false;
+
+                                             sound->m_status = Sound::Stopped;
+                                             return true;
+                                         });
+    virtualSounds.erase(finished, virtualSounds.end());
+
+    // Rank the virtual sounds from the most to the least audible
+    std::vector<Candidate> candidates;
+    candidates.reserve(virtualSounds.size());
+    for (Sound* sound : virtualSounds)
+        candidates.push_back(makeCandidate(*sound));
+
+    std::stable_sort(candidates.begin(),
+                     candidates.end(),
+                     [](const Candidate& left, const Candidate& right) { return isQuieter(right.rank, left.rank); });
+
+    // Give the free voices to the best ones; culled sounds stay virtual
+    std::size_t promoted = 0;
+    for (const Candidate& candidate : candidates)
+    {
+        if (candidate.rank.audibility < 0.f)
+            break;
+
+        const unsigned int source = takeFreeVoice();
+        if (!source)
+            break;
+
+        candidate.sound->startVoice(source);
+        activeSounds.push_back(candidate.sound);
+        ++promoted;
+    }
+
+    virtualSounds.clear();
+    for (std::size_t i = promoted; i < candidates.size(); ++i)
+        virtualSounds.push_back(candidates[i].sound);
+}
+
+} // namespace sf::priv
@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/VoicePool.hpp>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class Sound;
+
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Distribute a limited set of OpenAL sources among the sounds
+///
+////////////////////////////////////////////////////////////
+class VoiceManager
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Register a new sound
+    ///
+    /// The OpenAL sources of the pool are deleted when the
+    /// last registered sound is destroyed, so that they don't
+    /// outlive the audio device.
+    ///
+    ////////////////////////////////////////////////////////////
+    static void addSound();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Unregister a sound, which must already be stopped
+    ///
+    ////////////////////////////////////////////////////////////
+    static void removeSound();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Give a voice to a sound that starts playing
+    ///
+    /// If no voice can be given to the sound, it becomes virtual.
+    ///
+    /// \param sound Sound that starts playing
+    ///
+    ////////////////////////////////////////////////////////////
+    static void play(Sound& sound);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Take back the voice of a sound that is paused or stopped
+    ///
+    /// \param sound Sound that stops playing
+    ///
+    ////////////////////////////////////////////////////////////
+    static void release(Sound& sound);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Redistribute the voices among the playing sounds
+    ///
+    ////////////////////////////////////////////////////////////
+    static void update();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the maximum number of voices
+    ///
+    /// \param count New maximum number of voices
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setMaxVoices(std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum number of voices
+    ///
+    /// \return Maximum number of voices
+    ///
+    ////////////////////////////////////////////////////////////
+    static std::size_t getMaxVoices();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current counters of the pool
+    ///
+    /// \return Statistics of the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    static VoicePool::Statistics getStatistics();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a voice that isn't used by any playing sound
+    ///
+    /// \return OpenAL source of the voice, 0 if none is available
+    ///
+    ////////////////////////////////////////////////////////////
+    static unsigned int takeFreeVoice();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Take the voice of a sound, which becomes virtual if it is still playing
+    ///
+    /// \param sound Sound to take the voice from
+    ///
+    /// \return OpenAL source of the voice
+    ///
+    ////////////////////////////////////////////////////////////
+    static unsigned int takeVoice(Sound& sound);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Give the free voices to the most audible virtual sounds
+    ///
+    ////////////////////////////////////////////////////////////
+    static void fillVoices();
+};
+
+} // namespace priv
+
+} // namespace sf
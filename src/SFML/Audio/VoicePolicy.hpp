@@ -0,0 +1,163 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector3.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Rank of a sound competing for a voice
+///
+////////////////////////////////////////////////////////////
+struct VoiceRank
+{
+    int   priority{};   //!< Priority of the sound
+    float audibility{}; //!< Estimated loudness of the sound, negative if it is culled
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Pair of sounds whose voice changes hands
+///
+////////////////////////////////////////////////////////////
+struct VoiceSwap
+{
+    std::size_t waiting{}; //!< Index of the virtual sound that gets the voice
+    std::size_t active{};  //!< Index of the voice, in the list of active sounds
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Estimate how loud a sound is heard by the listener
+///
+/// The attenuation follows the "inverse distance clamped"
+/// model used by OpenAL.
+///
+/// \param offset       Position of the sound relative to the listener
+/// \param volume       Volume of the sound
+/// \param minDistance  Minimum distance of the sound
+/// \param attenuation  Attenuation factor of the sound
+/// \param cullDistance Distance beyond which the sound is culled
+///
+/// \return Audibility of the sound, or a negative value if it is culled
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] inline float computeAudibility(const Vector3f& offset,
+                                             float           volume,
+                                             float           minDistance,
+                                             float           attenuation,
+                                             float           cullDistance)
+{
+    const float distance = offset.length();
+    if (distance > cullDistance)
+        return -1.f;
+
+    const float denominator = minDistance + attenuation * (std::max(distance, minDistance) - minDistance);
+    const float gain        = (denominator > 0.f) ? minDistance / denominator : 1.f;
+
+    return volume * gain;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Tell whether a sound deserves a voice less than another
+///
+/// Culled sounds come first whatever their priority, then
+/// sounds are ordered by priority and finally by audibility.
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] inline bool isQuieter(const VoiceRank& left, const VoiceRank& right)
+{
+    if ((left.audibility < 0.f) != (right.audibility < 0.f))
+        return left.audibility < 0.f;
+
+    if (left.priority != right.priority)
+        return left.priority < right.priority;
+
+    return left.audibility < right.audibility;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Decide which virtual sounds steal the voice of an active sound
+///
+/// Each waiting sound, from the first to the last, takes the
+/// voice of the least audible active sound if it is more
+/// audible; the search stops at the first one that doesn't.
+///
+/// \param active  Ranks of the sounds that hold a voice
+/// \param waiting Ranks of the virtual sounds, from the most to the least audible
+///
+/// \return Voices to swap, in the order in which they must be swapped
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] inline std::vector<VoiceSwap> planVoiceSwaps(std::vector<VoiceRank>        active,
+                                                           const std::vector<VoiceRank>& waiting)
+{
+    std::vector<VoiceSwap> swaps;
+
+    for (std::size_t i = 0; i < waiting.size(); ++i)
+    {
+        const auto quietest = std::min_element(active.begin(), active.end(), isQuieter);
+        if ((waiting[i].audibility < 0.f) || (quietest == active.end()) || !isQuieter(*quietest, waiting[i]))
+            break;
+
+        *quietest = waiting[i];
+        swaps.push_back({i, static_cast<std::size_t>(quietest - active.begin())});
+    }
+
+    return swaps;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Compute the playing position of a sound that has no voice
+///
+/// \param offset   Playing position when the sound lost its voice
+/// \param elapsed  Time elapsed since the sound lost its voice, zero if it is not playing
+/// \param pitch    Pitch of the sound
+/// \param duration Duration of the sound
+/// \param loop     Whether the sound is looping
+///
+/// \return Playing position, which wraps around if the sound is looping
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] inline Time computeVirtualOffset(Time offset, Time elapsed, float pitch, Time duration, bool loop)
+{
+    offset += elapsed * pitch;
+
+    if (loop && (duration > Time::Zero))
+        offset %= duration;
+
+    return offset;
+}
+
+} // namespace sf::priv
@@ -27,12 +27,17 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #ifdef SFML_SYSTEM_ANDROID
 #include <SFML/System/Android/ResourceStream.hpp>
 #endif
 #include <SFML/System/Err.hpp>
+#include <SFML/System/FileInputStream.hpp>
 #include <SFML/System/InputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
+#include <SFML/System/MemoryInputStream.hpp>
+#include <SFML/System/String.hpp>
 #include <SFML/System/Utils.hpp>
 
 #include <ft2build.h>
@@ -42,7 +47,13 @@
 #include FT_BITMAP_H
 #include FT_STROKER_H
 
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <limits>
 #include <ostream>
+#include <thread>
+#include <unordered_set>
 #include <utility>
 
 #include <cmath>
@@ -86,6 +97,579 @@ std::uint64_t combine(float outlineThickness, bool bold, std::uint32_t index)
     return (static_cast<std::uint64_t>(reinterpret<std::uint32_t>(outlineThickness)) << 32) |
            (static_cast<std::uint64_t>(bold) << 31) | index;
 }
+
+// Extract the font glyph index from a key built by combine()
+std::uint32_t indexFromKey(std::uint64_t key)
+{
+    return static_cast<std::uint32_t>(key & 0x7FFFFFFF);
+}
+
+// Combine two glyph indices into a single 64-bit key
+std::uint64_t combine(std::uint32_t first, std::uint32_t second)
+{
+    return (static_cast<std::uint64_t>(first) << 32) | second;
+}
+
+// Largest code point and character size that fit in a kerning key
+constexpr std::uint32_t kerningKeyMask = 0x1FFFFF;
+
+// Combine a pair of code points, a character size and boldness into a single 64-bit key
+std::uint64_t kerningKey(std::uint32_t first, std::uint32_t second, unsigned int characterSize, bool bold)
+{
+    return (static_cast<std::uint64_t>(first) << 43) | (static_cast<std::uint64_t>(second) << 22) |
+           (static_cast<std::uint64_t>(characterSize) << 1) | static_cast<std::uint64_t>(bold);
+}
+
+// Turn a kerning value and the autohinter compensation deltas into a kerning offset in pixels
+float computeKerning(bool scalable, long kerning, float firstRsbDelta, float secondLsbDelta)
+{
+    // X advance is already in pixels for bitmap fonts
+    if (!scalable)
+        return static_cast<float>(kerning);
+
+    // Combine kerning with compensation deltas and return the X advance
+    // Flooring is required as we use FT_KERNING_UNFITTED flag which is not quantized in 64 based grid
+    return std::floor((secondLsbDelta - firstRsbDelta + static_cast<float>(kerning) + 32) / static_cast<float>(1 << 6));
+}
+
+// Character size at which distance field glyphs are rasterized
+constexpr unsigned int distanceFieldSize = 48;
+
+// Distance covered by a distance field around a glyph's edges, in pixels at the reference size
+constexpr unsigned int distanceFieldSpread = 12;
+
+// Fragment shader turning the distance stored in the alpha channel into antialiased coverage
+constexpr const char* distanceFieldShaderSource = R"(
+uniform sampler2D texture;
+uniform float threshold;
+
+void main()
+{
+    float distance = texture2D(texture, gl_TexCoord[0].xy).a;
+    float smoothing = max(fwidth(distance) * 0.7, 0.0001);
+    float alpha = smoothstep(threshold - smoothing, threshold + smoothing, distance);
+    gl_FragColor = vec4(gl_Color.rgb, gl_Color.a * alpha);
+}
+)";
+
+// Compute the squared euclidean distance transform of a single row or column of a grid,
+// using the algorithm of Felzenszwalb and Huttenlocher
+void transformLine(std::vector<float>&       grid,
+                   std::size_t               offset,
+                   std::size_t               stride,
+                   std::size_t               length,
+                   std::vector<float>&       values,
+                   std::vector<std::size_t>& parabolas,
+                   std::vector<float>&       boundaries)
+{
+    const auto square = [](float value) { return value * value; };
+
+    for (std::size_t q = 0; q < length; ++q)
+        values[q] = grid[offset + q * stride];
+
+    // Build the lower envelope of the parabolas rooted at each sample
+    std::size_t k = 0;
+    parabolas[0]  = 0;
+    boundaries[0] = -std::numeric_limits<float>::infinity();
+    boundaries[1] = std::numeric_limits<float>::infinity();
+    for (std::size_t q = 1; q < length; ++q)
+    {
+        const auto intersection = [&]
+        {
+            const auto r = static_cast<float>(parabolas[k]);
+            const auto p = static_cast<float>(q);
+            return ((values[q] + square(p)) - (values[parabolas[k]] + square(r))) / (2 * p - 2 * r);
+        };
+
+        float s = intersection();
+        while (s <= boundaries[k])
+        {
+            --k;
+            s = intersection();
+        }
+
+        ++k;
+        parabolas[k]      = q;
+        boundaries[k]     = s;
+        boundaries[k + 1] = std::numeric_limits<float>::infinity();
+    }
+
+    // Sample the lower envelope
+    k = 0;
+    for (std::size_t q = 0; q < length; ++q)
+    {
+        while (boundaries[k + 1] < static_cast<float>(q))
+            ++k;
+
+        grid[offset + q * stride] = square(static_cast<float>(q) - static_cast<float>(parabolas[k])) +
+                                    values[parabolas[k]];
+    }
+}
+
+// Compute the squared euclidean distance transform of a grid
+void transformGrid(std::vector<float>& grid, const sf::Vector2u& size)
+{
+    const std::size_t        length = std::max(size.x, size.y);
+    std::vector<float>       values(length);
+    std::vector<std::size_t> parabolas(length);
+    std::vector<float>       boundaries(length + 1);
+
+    for (std::size_t x = 0; x < size.x; ++x)
+        transformLine(grid, x, size.x, size.y, values, parabolas, boundaries);
+
+    for (std::size_t y = 0; y < size.y; ++y)
+        transformLine(grid, y * size.x, 1, size.x, values, parabolas, boundaries);
+}
+
+// Turn the antialiased coverage of a glyph into a signed distance field stored in 8-bit values,
+// where 0.5 (128) is the edge of the glyph and 0 and 1 (0 and 255) are distanceFieldSpread pixels away from it
+void computeDistanceField(const std::vector<float>&  coverage,
+                          const sf::Vector2u&        size,
+                          std::vector<std::uint8_t>& field)
+{
+    // Value large enough to act as infinity while keeping the computations finite
+    constexpr float far = 1e20f;
+
+    // Partially covered pixels give an estimate of the sub-pixel distance to the edge
+    std::vector<float> outside(coverage.size());
+    std::vector<float> inside(coverage.size());
+    for (std::size_t i = 0; i < coverage.size(); ++i)
+    {
+        const float value = coverage[i];
+        if (value >= 1.f)
+        {
+            outside[i] = 0.f;
+            inside[i]  = far;
+        }
+        else if (value <= 0.f)
+        {
+            outside[i] = far;
+            inside[i]  = 0.f;
+        }
+        else
+        {
+            outside[i] = std::max(0.f, 0.5f - value) * std::max(0.f, 0.5f - value);
+            inside[i]  = std::max(0.f, value - 0.5f) * std::max(0.f, value - 0.5f);
+        }
+    }
+
+    transformGrid(outside, size);
+    transformGrid(inside, size);
+
+    field.resize(coverage.size());
+    for (std::size_t i = 0; i < coverage.size(); ++i)
+    {
+        const float distance = std::sqrt(outside[i]) - std::sqrt(inside[i]);
+        const float value    = 0.5f - distance / (2.f * static_cast<float>(distanceFieldSpread));
+        field[i]             = static_cast<std::uint8_t>(std::clamp(value, 0.f, 1.f) * 255.f + 0.5f);
+    }
+}
+
+// Scale the metrics of a distance field glyph from the reference size to the given character size
+sf::Glyph scaleGlyph(const sf::Glyph& glyph, unsigned int characterSize, bool bold)
+{
+    const float scale = static_cast<float>(characterSize) / static_cast<float>(distanceFieldSize);
+
+    sf::Glyph scaled = glyph;
+    scaled.advance   = glyph.advance * scale + (bold ? 1.f : 0.f);
+    scaled.lsbDelta  = static_cast<int>(std::lround(static_cast<float>(glyph.lsbDelta) * scale));
+    scaled.rsbDelta  = static_cast<int>(std::lround(static_cast<float>(glyph.rsbDelta) * scale));
+    scaled.bounds    = sf::FloatRect(glyph.bounds.getPosition() * scale, glyph.bounds.getSize() * scale);
+    return scaled;
+}
+
+// Padding left around glyphs in the page textures, so that filtering doesn't pollute them with pixels from neighbors
+constexpr unsigned int glyphPadding = 2;
+
+// Glyph rasterized by FreeType, ready to be stored in a page texture
+struct GlyphBitmap
+{
+    sf::Glyph                 glyph;           // Metrics of the glyph, without texture coordinates
+    sf::Vector2u              size;            // Size of the bitmap, including its padding (0 if the glyph is empty)
+    unsigned int              padding{};       // Distance between the bitmap edges and the glyph's texture rectangle
+    std::vector<std::uint8_t> pixels;          // RGBA pixels of the bitmap
+    bool                      outlineFailed{}; // Whether an outline was requested on a glyph that can't be outlined
+};
+
+// Make the face use the given character size (expensive, so only call FT_Set_Pixel_Sizes if needed)
+FT_Error setFaceSize(FT_Face face, unsigned int characterSize)
+{
+    if (face->size->metrics.x_ppem != characterSize)
+        return FT_Set_Pixel_Sizes(face, 0, characterSize);
+
+    return FT_Err_Ok;
+}
+
+// Rasterize a glyph with the current size of the face
+bool rasterizeGlyph(FT_Library    library,
+                    FT_Face       face,
+                    FT_Stroker    stroker,
+                    std::uint32_t codePoint,
+                    bool          bold,
+                    float         outlineThickness,
+                    GlyphBitmap&  result)
+{
+    result.glyph   = sf::Glyph();
+    result.size    = sf::Vector2u();
+    result.padding = glyphPadding;
+
+    // Load the glyph corresponding to the code point
+    FT_Int32 flags = FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT;
+    if (outlineThickness != 0)
+        flags |= FT_LOAD_NO_BITMAP;
+    if (FT_Load_Char(face, codePoint, flags) != 0)
+        return false;
+
+    // Retrieve the glyph
+    FT_Glyph glyphDesc;
+    if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
+        return false;
+
+    // Apply bold and outline (there is no fallback for outline) if necessary -- first technique using outline (highest quality)
+    const FT_Pos weight  = 1 << 6;
+    const bool   outline = (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE);
+    if (outline)
+    {
+        if (bold)
+        {
+            auto* outlineGlyph = reinterpret_cast<FT_OutlineGlyph>(glyphDesc);
+            FT_Outline_Embolden(&outlineGlyph->outline, weight);
+        }
+
+        if (outlineThickness != 0)
+        {
+            FT_Stroker_Set(stroker,
+                           static_cast<FT_Fixed>(outlineThickness * static_cast<float>(1 << 6)),
+                           FT_STROKER_LINECAP_ROUND,
+                           FT_STROKER_LINEJOIN_ROUND,
+                           0);
+            FT_Glyph_Stroke(&glyphDesc, stroker, true);
+        }
+    }
+
+    // Convert the glyph to a bitmap (i.e. rasterize it)
+    // Warning! After this line, do not read any data from glyphDesc directly, use
+    // bitmapGlyph.root to access the FT_Glyph data.
+    FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, nullptr, 1);
+    auto*      bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
+    FT_Bitmap& bitmap      = bitmapGlyph->bitmap;
+
+    // Apply bold if necessary -- fallback technique using bitmap (lower quality)
+    if (!outline)
+    {
+        if (bold)
+            FT_Bitmap_Embolden(library, &bitmap, weight, weight);
+
+        if (outlineThickness != 0)
+            result.outlineFailed = true;
+    }
+
+    // Compute the glyph's advance offset
+    sf::Glyph& glyph = result.glyph;
+    glyph.advance    = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
+    if (bold)
+        glyph.advance += static_cast<float>(weight) / static_cast<float>(1 << 6);
+
+    glyph.lsbDelta = static_cast<int>(face->glyph->lsb_delta);
+    glyph.rsbDelta = static_cast<int>(face->glyph->rsb_delta);
+
+    unsigned int width  = bitmap.width;
+    unsigned int height = bitmap.rows;
+
+    if ((width > 0) && (height > 0))
+    {
+        const unsigned int padding = glyphPadding;
+
+        width += 2 * padding;
+        height += 2 * padding;
+        result.size = {width, height};
+
+        // Compute the glyph's bounding box
+        glyph.bounds.left   = static_cast<float>(bitmapGlyph->left);
+        glyph.bounds.top    = static_cast<float>(-bitmapGlyph->top);
+        glyph.bounds.width  = static_cast<float>(bitmap.width);
+        glyph.bounds.height = static_cast<float>(bitmap.rows);
+
+        // Resize the pixel buffer to the new size and fill it with transparent white pixels
+        result.pixels.resize(static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * 4);
+
+        std::uint8_t* current = result.pixels.data();
+        std::uint8_t* end     = current + width * height * 4;
+
+        while (current != end)
+        {
+            (*current++) = 255;
+            (*current++) = 255;
+            (*current++) = 255;
+            (*current++) = 0;
+        }
+
+        // Extract the glyph's pixels from the bitmap
+        const std::uint8_t* pixels = bitmap.buffer;
+        if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+        {
+            // Pixels are 1 bit monochrome values
+            for (unsigned int y = padding; y < height - padding; ++y)
+            {
+                for (unsigned int x = padding; x < width - padding; ++x)
+                {
+                    // The color channels remain white, just fill the alpha channel
+                    const std::size_t index = x + y * width;
+                    result.pixels[index * 4 + 3] = ((pixels[(x - padding) / 8]) & (1 << (7 - ((x - padding) % 8)))) ? 255 : 0;
+                }
+                pixels += bitmap.pitch;
+            }
+        }
+        else
+        {
+            // Pixels are 8 bits gray levels
+            for (unsigned int y = padding; y < height - padding; ++y)
+            {
+                for (unsigned int x = padding; x < width - padding; ++x)
+                {
+                    // The color channels remain white, just fill the alpha channel
+                    const std::size_t index      = x + y * width;
+                    result.pixels[index * 4 + 3] = pixels[x - padding];
+                }
+                pixels += bitmap.pitch;
+            }
+        }
+    }
+
+    // Delete the FT glyph
+    FT_Done_Glyph(glyphDesc);
+
+    return true;
+}
+
+// Rasterize a glyph into a distance field, the face must use the distance field reference size
+bool rasterizeDistanceFieldGlyph(FT_Face face, std::uint32_t codePoint, GlyphBitmap& result)
+{
+    result.glyph   = sf::Glyph();
+    result.size    = sf::Vector2u();
+    result.padding = glyphPadding + distanceFieldSpread;
+
+    // Load the outline of the glyph corresponding to the code point
+    if (FT_Load_Char(face, codePoint, FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT | FT_LOAD_NO_BITMAP) != 0)
+        return false;
+
+    // Retrieve the glyph
+    FT_Glyph glyphDesc;
+    if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
+        return false;
+
+    // Convert the glyph to a bitmap (i.e. rasterize it)
+    FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, nullptr, 1);
+    auto*            bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
+    const FT_Bitmap& bitmap      = bitmapGlyph->bitmap;
+
+    // Keep the unrounded advance, as it will be scaled to other sizes
+    sf::Glyph& glyph = result.glyph;
+    glyph.advance    = static_cast<float>(bitmapGlyph->root.advance.x) / static_cast<float>(1 << 16);
+    glyph.lsbDelta   = static_cast<int>(face->glyph->lsb_delta);
+    glyph.rsbDelta   = static_cast<int>(face->glyph->rsb_delta);
+
+    if ((bitmap.width > 0) && (bitmap.rows > 0))
+    {
+        // The distance field extends beyond the glyph's edges so that it can be outlined and emboldened
+        const unsigned int spread = distanceFieldSpread;
+        const sf::Vector2u fieldSize(bitmap.width + 2 * spread, bitmap.rows + 2 * spread);
+        const unsigned int width  = fieldSize.x + 2 * glyphPadding;
+        const unsigned int height = fieldSize.y + 2 * glyphPadding;
+
+        result.size = {width, height};
+
+        // Compute the glyph's bounding box
+        glyph.bounds.left   = static_cast<float>(bitmapGlyph->left);
+        glyph.bounds.top    = static_cast<float>(-bitmapGlyph->top);
+        glyph.bounds.width  = static_cast<float>(bitmap.width);
+        glyph.bounds.height = static_cast<float>(bitmap.rows);
+
+        // Extract the glyph's coverage from the bitmap
+        std::vector<float>  coverage(static_cast<std::size_t>(fieldSize.x) * fieldSize.y);
+        const std::uint8_t* pixels = bitmap.buffer;
+        for (unsigned int y = 0; y < bitmap.rows; ++y)
+        {
+            for (unsigned int x = 0; x < bitmap.width; ++x)
+            {
+                const std::size_t index = (x + spread) + (y + spread) * fieldSize.x;
+                if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+                    coverage[index] = (pixels[x / 8] & (1 << (7 - (x % 8)))) ? 1.f : 0.f;
+                else
+                    coverage[index] = static_cast<float>(pixels[x]) / 255.f;
+            }
+            pixels += bitmap.pitch;
+        }
+
+        std::vector<std::uint8_t> field;
+        computeDistanceField(coverage, fieldSize, field);
+
+        // Store the distances in the alpha channel of white pixels, the padding remains transparent
+        result.pixels.assign(static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * 4, 255);
+        for (std::size_t i = 3; i < result.pixels.size(); i += 4)
+            result.pixels[i] = 0;
+
+        for (unsigned int y = 0; y < fieldSize.y; ++y)
+        {
+            for (unsigned int x = 0; x < fieldSize.x; ++x)
+            {
+                const std::size_t index      = (x + glyphPadding) + (y + glyphPadding) * width;
+                result.pixels[index * 4 + 3] = field[x + y * fieldSize.x];
+            }
+        }
+    }
+
+    // Delete the FT glyph
+    FT_Done_Glyph(glyphDesc);
+
+    return true;
+}
+
+// Compute the texture rectangle of a glyph from the rectangle allocated to its padded bitmap
+sf::IntRect removePadding(sf::IntRect rect, unsigned int padding)
+{
+    rect.left += static_cast<int>(padding);
+    rect.top += static_cast<int>(padding);
+    rect.width -= static_cast<int>(2 * padding);
+    rect.height -= static_cast<int>(2 * padding);
+    return rect;
+}
+
+// Glyph to rasterize ahead of time
+struct PreloadJob
+{
+    std::uint32_t codePoint{};     // Code point of the glyph
+    unsigned int  characterSize{}; // Character size to rasterize the glyph at
+    std::uint64_t key{};           // Key of the glyph in its page
+    GlyphBitmap   bitmap;          // Result of the rasterization
+    bool          done{};          // Whether the glyph was rasterized
+};
+
+// Font atlas file layout: every value is stored in little endian byte order
+constexpr char          atlasMagic[8] = {'S', 'F', 'M', 'L', 'F', 'A', 'T', 'L'};
+constexpr std::uint32_t atlasVersion  = 1;
+
+// Helper to append values to a font atlas
+class AtlasWriter
+{
+public:
+    void write(std::uint8_t value)
+    {
+        m_buffer.push_back(value);
+    }
+
+    void write(std::uint32_t value)
+    {
+        for (int i = 0; i < 4; ++i)
+            m_buffer.push_back(static_cast<std::uint8_t>(value >> (i * 8)));
+    }
+
+    void write(std::uint64_t value)
+    {
+        write(static_cast<std::uint32_t>(value));
+        write(static_cast<std::uint32_t>(value >> 32));
+    }
+
+    void write(std::int32_t value)
+    {
+        write(static_cast<std::uint32_t>(value));
+    }
+
+    void write(float value)
+    {
+        write(reinterpret<std::uint32_t>(value));
+    }
+
+    void write(const void* data, std::size_t size)
+    {
+        const auto* bytes = static_cast<const std::uint8_t*>(data);
+        m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+    }
+
+    std::vector<std::uint8_t>& getBuffer()
+    {
+        return m_buffer;
+    }
+
+private:
+    std::vector<std::uint8_t> m_buffer;
+};
+
+// Helper to extract values from a font atlas stored in a sf::InputStream
+class AtlasReader
+{
+public:
+    explicit AtlasReader(sf::InputStream& stream) : m_stream(stream)
+    {
+    }
+
+    [[nodiscard]] bool read(std::uint8_t& value)
+    {
+        return read(&value, 1);
+    }
+
+    [[nodiscard]] bool read(std::uint32_t& value)
+    {
+        std::uint8_t bytes[4];
+        if (!read(bytes, sizeof(bytes)))
+            return false;
+
+        value = 0;
+        for (int i = 0; i < 4; ++i)
+            value |= static_cast<std::uint32_t>(bytes[i]) << (i * 8);
+        return true;
+    }
+
+    [[nodiscard]] bool read(std::uint64_t& value)
+    {
+        std::uint32_t low  = 0;
+        std::uint32_t high = 0;
+        if (!read(low) || !read(high))
+            return false;
+
+        value = (static_cast<std::uint64_t>(high) << 32) | low;
+        return true;
+    }
+
+    [[nodiscard]] bool read(std::int32_t& value)
+    {
+        std::uint32_t bits = 0;
+        if (!read(bits))
+            return false;
+
+        value = static_cast<std::int32_t>(bits);
+        return true;
+    }
+
+    [[nodiscard]] bool read(float& value)
+    {
+        std::uint32_t bits = 0;
+        if (!read(bits))
+            return false;
+
+        value = reinterpret<float>(bits);
+        return true;
+    }
+
+    [[nodiscard]] bool read(void* data, std::size_t size)
+    {
+        return m_stream.read(data, static_cast<std::int64_t>(size)) == static_cast<std::int64_t>(size);
+    }
+
+    // Make sure that a count of elements read from the stream can actually be backed by its remaining data
+    [[nodiscard]] bool canRead(std::uint64_t count, std::uint64_t elementSize)
+    {
+        const std::int64_t size     = m_stream.getSize();
+        const std::int64_t position = m_stream.tell();
+        if ((size < 0) || (position < 0) || (position > size))
+            return false;
+
+        return (elementSize == 0) || (count <= static_cast<std::uint64_t>(size - position) / elementSize);
+    }
+
+private:
+    sf::InputStream& m_stream;
+};
 } // namespace
 
 
@@ -116,10 +700,30 @@ struct Font::FontHandles
     FontHandles& operator=(FontHandles&&) = delete;
     // clang-format on
 
-    FT_Library   library{};   //< Pointer to the internal library interface
-    FT_StreamRec streamRec{}; //< Stream rec object describing an input stream
-    FT_Face      face{};      //< Pointer to the internal font face
-    FT_Stroker   stroker{};   //< Pointer to the stroker
+    FT_Library            library{};   //< Pointer to the internal library interface
+    FT_StreamRec          streamRec{}; //< Stream rec object describing an input stream
+    FT_Face               face{};      //< Pointer to the internal font face
+    FT_Stroker            stroker{};   //< Pointer to the stroker
+    std::filesystem::path filename;    //< Source file of the face, if loaded from a file
+    const void*           data{};      //< Source data of the face, if loaded from memory
+    std::size_t           dataSize{};  //< Size of the source data, in bytes
+};
+
+
+////////////////////////////////////////////////////////////
+struct Font::Atlas
+{
+    struct Size
+    {
+        float                                   lineSpacing{};        //< Line spacing, in pixels
+        float                                   underlinePosition{};  //< Underline position, in pixels
+        float                                   underlineThickness{}; //< Underline thickness, in pixels
+        std::unordered_map<std::uint64_t, long> kerning;              //< Non-zero kerning by pair of glyph indices
+    };
+
+    bool                                             isScalable{true}; //< Whether the source font was scalable
+    std::unordered_map<std::uint32_t, std::uint32_t> charIndices;      //< Glyph indices of the saved code points
+    std::unordered_map<unsigned int, Size>           sizes;            //< Metrics of the saved character sizes
 };
 
 
@@ -142,8 +746,9 @@ bool Font::loadFromFile(const std::filesystem::path& filename)
         return false;
     }
 
-    // Load the new font face from the specified file
-    FT_Face face;
+    // Load the new font face from the specified file; the face reads the file for as long as the font lives,
+    // so it isn't mapped in memory: a truncated file must not crash the program
+    FT_Face face = nullptr;
     if (FT_New_Face(fontHandles->library, filename.string().c_str(), 0, &face) != 0)
     {
         err() << "Failed to load font (failed to create the font face)\n" << formatDebugPathInfo(filename) << std::endl;
@@ -167,6 +772,7 @@ bool Font::loadFromFile(const std::filesystem::path& filename)
     }
 
     // Store the loaded font handles
+    fontHandles->filename = filename;
     m_fontHandles = std::move(fontHandles);
 
     // Store the font information
@@ -228,6 +834,8 @@ bool Font::loadFromMemory(const void* data, std::size_t sizeInBytes)
     }
 
     // Store the loaded font handles
+    fontHandles->data     = data;
+    fontHandles->dataSize = sizeInBytes;
     m_fontHandles = std::move(fontHandles);
 
     // Store the font information
@@ -269,82 +877,673 @@ bool Font::loadFromStream(InputStream& stream)
     fontHandles->streamRec.read               = &read;
     fontHandles->streamRec.close              = &close;
 
-    // Setup the FreeType callbacks that will read our stream
-    FT_Open_Args args;
-    args.flags  = FT_OPEN_STREAM;
-    args.stream = &fontHandles->streamRec;
-    args.driver = nullptr;
+    // Setup the FreeType callbacks that will read our stream
+    FT_Open_Args args;
+    args.flags  = FT_OPEN_STREAM;
+    args.stream = &fontHandles->streamRec;
+    args.driver = nullptr;
+
+    // Load the new font face from the specified stream
+    FT_Face face;
+    if (FT_Open_Face(fontHandles->library, &args, 0, &face) != 0)
+    {
+        err() << "Failed to load font from stream (failed to create the font face)" << std::endl;
+        return false;
+    }
+    fontHandles->face = face;
+
+    // Load the stroker that will be used to outline the font
+    if (FT_Stroker_New(fontHandles->library, &fontHandles->stroker) != 0)
+    {
+        err() << "Failed to load font from stream (failed to create the stroker)" << std::endl;
+        return false;
+    }
+
+    // Select the Unicode character map
+    if (FT_Select_Charmap(face, FT_ENCODING_UNICODE) != 0)
+    {
+        err() << "Failed to load font from stream (failed to set the Unicode character set)" << std::endl;
+        return false;
+    }
+
+    // Store the loaded font handles
+    m_fontHandles = std::move(fontHandles);
+
+    // Store the font information
+    m_info.family = face->family_name ? face->family_name : std::string();
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::loadAtlasFromFile(const std::filesystem::path& filename)
+{
+    FileInputStream stream;
+    if (!stream.open(filename))
+    {
+        err() << "Failed to load font atlas (failed to open the file)\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    return loadAtlasFromStream(stream);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::loadAtlasFromMemory(const void* data, std::size_t sizeInBytes)
+{
+    if (!data || (sizeInBytes == 0))
+    {
+        err() << "Failed to load font atlas from memory, no data provided" << std::endl;
+        return false;
+    }
+
+    MemoryInputStream stream;
+    stream.open(data, sizeInBytes);
+    return loadAtlasFromStream(stream);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::loadAtlasFromStream(InputStream& stream)
+{
+    // Cleanup the previous resources
+    cleanup();
+
+    // Make sure that the stream's reading position is at the beginning
+    if (stream.seek(0) == -1)
+    {
+        err() << "Failed to seek font atlas stream" << std::endl;
+        return false;
+    }
+
+    AtlasReader reader(stream);
+    const auto  fail = [](const char* reason)
+    {
+        err() << "Failed to load font atlas from stream (" << reason << ")" << std::endl;
+        return false;
+    };
+
+    // Check the header
+    char          magic[sizeof(atlasMagic)];
+    std::uint32_t version = 0;
+    if (!reader.read(magic, sizeof(magic)) || (std::memcmp(magic, atlasMagic, sizeof(magic)) != 0))
+        return fail("not a font atlas");
+    if (!reader.read(version) || (version != atlasVersion))
+        return fail("unsupported version");
+
+    auto atlas = std::make_shared<Atlas>();
+    Info info;
+
+    // Read the font information
+    std::uint32_t familyLength = 0;
+    std::uint8_t  flags        = 0;
+    if (!reader.read(familyLength) || !reader.canRead(familyLength, 1))
+        return fail("invalid font information");
+    info.family.resize(familyLength);
+    if (!reader.read(info.family.data(), familyLength) || !reader.read(flags))
+        return fail("invalid font information");
+    atlas->isScalable = (flags & 1) != 0;
+    const bool isDistanceField = (flags & 2) != 0;
+
+    // Read the character map
+    std::uint32_t charCount = 0;
+    if (!reader.read(charCount) || !reader.canRead(charCount, 8))
+        return fail("invalid character map");
+    atlas->charIndices.reserve(charCount);
+    for (std::uint32_t i = 0; i < charCount; ++i)
+    {
+        std::uint32_t codePoint = 0;
+        std::uint32_t index     = 0;
+        if (!reader.read(codePoint) || !reader.read(index))
+            return fail("invalid character map");
+        atlas->charIndices.emplace(codePoint, index);
+    }
+
+    // Read the pages
+    PageTable     pages;
+    std::uint32_t pageCount = 0;
+    if (!reader.read(pageCount))
+        return fail("invalid page count");
+    for (std::uint32_t p = 0; p < pageCount; ++p)
+    {
+        std::uint32_t characterSize = 0;
+        Atlas::Size   size;
+        if (!reader.read(characterSize) || !reader.read(size.lineSpacing) || !reader.read(size.underlinePosition) ||
+            !reader.read(size.underlineThickness))
+            return fail("invalid page metrics");
+
+        // Rebuild the texture from its alpha channel, glyph pixels are always white
+        Vector2u textureSize;
+        if (!reader.read(textureSize.x) || !reader.read(textureSize.y) ||
+            (textureSize.x > Texture::getMaximumSize()) || (textureSize.y > Texture::getMaximumSize()) ||
+            !reader.canRead(std::uint64_t{textureSize.x} * textureSize.y, 1))
+            return fail("invalid page texture size");
+
+        std::vector<std::uint8_t> alpha(static_cast<std::size_t>(textureSize.x) * textureSize.y);
+        if (!reader.read(alpha.data(), alpha.size()))
+            return fail("invalid page texture");
+
+        std::vector<std::uint8_t> pixels(alpha.size() * 4, 255);
+        for (std::size_t i = 0; i < alpha.size(); ++i)
+            pixels[i * 4 + 3] = alpha[i];
+
+        Image image;
+        image.create(textureSize, pixels.data());
+
+        Page& page = pages.try_emplace(characterSize, m_isSmooth || isDistanceField).first->second;
+        if (!page.texture.loadFromImage(image))
+            return fail("failed to create the page texture");
+        page.texture.setSmooth(m_isSmooth || isDistanceField);
+
+        // Restore the packing state so that the page layout is preserved
+        std::uint32_t rowCount = 0;
+        if (!reader.read(page.nextRow) || !reader.read(rowCount) || !reader.canRead(rowCount, 12))
+            return fail("invalid page rows");
+        page.rows.reserve(rowCount);
+        for (std::uint32_t i = 0; i < rowCount; ++i)
+        {
+            Row row(0, 0);
+            if (!reader.read(row.width) || !reader.read(row.top) || !reader.read(row.height))
+                return fail("invalid page rows");
+            page.rows.push_back(row);
+        }
+
+        // Read the glyphs
+        std::uint32_t glyphCount = 0;
+        if (!reader.read(glyphCount) || !reader.canRead(glyphCount, 52))
+            return fail("invalid glyphs");
+        page.glyphs.reserve(glyphCount);
+        for (std::uint32_t i = 0; i < glyphCount; ++i)
+        {
+            std::uint64_t key = 0;
+            Glyph         glyph;
+            if (!reader.read(key) || !reader.read(glyph.advance) || !reader.read(glyph.lsbDelta) ||
+                !reader.read(glyph.rsbDelta) || !reader.read(glyph.bounds.left) || !reader.read(glyph.bounds.top) ||
+                !reader.read(glyph.bounds.width) || !reader.read(glyph.bounds.height) ||
+                !reader.read(glyph.textureRect.left) || !reader.read(glyph.textureRect.top) ||
+                !reader.read(glyph.textureRect.width) || !reader.read(glyph.textureRect.height))
+                return fail("invalid glyphs");
+            page.glyphs.emplace(key, glyph);
+        }
+
+        // Read the kerning pairs
+        std::uint32_t kerningCount = 0;
+        if (!reader.read(kerningCount) || !reader.canRead(kerningCount, 12))
+            return fail("invalid kerning pairs");
+        size.kerning.reserve(kerningCount);
+        for (std::uint32_t i = 0; i < kerningCount; ++i)
+        {
+            std::uint32_t first   = 0;
+            std::uint32_t second  = 0;
+            std::int32_t  kerning = 0;
+            if (!reader.read(first) || !reader.read(second) || !reader.read(kerning))
+                return fail("invalid kerning pairs");
+            size.kerning.emplace(combine(first, second), kerning);
+        }
+
+        atlas->sizes.emplace(characterSize, std::move(size));
+    }
+
+    // Store the loaded atlas
+    m_atlas = std::move(atlas);
+    m_pages           = std::move(pages);
+    m_info            = std::move(info);
+    m_isDistanceField = isDistanceField;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::saveAtlasToFile(const std::filesystem::path& filename) const
+{
+    const std::optional<std::vector<std::uint8_t>> buffer = saveAtlasToMemory();
+    if (!buffer)
+        return false;
+
+    std::ofstream file(filename, std::ios_base::binary | std::ios_base::trunc);
+    if (!file.write(reinterpret_cast<const char*>(buffer->data()), static_cast<std::streamsize>(buffer->size())))
+    {
+        err() << "Failed to save font atlas\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::vector<std::uint8_t>> Font::saveAtlasToMemory() const
+{
+    FT_Face face = m_fontHandles ? m_fontHandles->face : nullptr;
+    if (!face && !m_atlas)
+    {
+        err() << "Failed to save font atlas (no font loaded)" << std::endl;
+        return std::nullopt;
+    }
+
+    // Collect the glyph indices that have been cached in each page
+    std::unordered_map<unsigned int, std::vector<std::uint32_t>> pageIndices;
+    std::unordered_set<std::uint32_t>                            allIndices;
+    for (const auto& [characterSize, page] : m_pages)
+    {
+        std::unordered_set<std::uint32_t> indices;
+        for (const auto& [key, glyph] : page.glyphs)
+            indices.insert(indexFromKey(key));
+
+        allIndices.insert(indices.begin(), indices.end());
+        pageIndices[characterSize].assign(indices.begin(), indices.end());
+    }
+
+    AtlasWriter writer;
+
+    // Write the header and the font information
+    writer.write(atlasMagic, sizeof(atlasMagic));
+    writer.write(atlasVersion);
+    writer.write(static_cast<std::uint32_t>(m_info.family.size()));
+    writer.write(m_info.family.data(), m_info.family.size());
+    const bool isScalable = face ? FT_IS_SCALABLE(face) != 0 : m_atlas->isScalable;
+    writer.write(static_cast<std::uint8_t>((isScalable ? 1 : 0) | (m_isDistanceField ? 2 : 0)));
+
+    // Write the code points that map to the cached glyphs
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> charIndices;
+    if (face)
+    {
+        FT_UInt  index     = 0;
+        FT_ULong codePoint = FT_Get_First_Char(face, &index);
+        while (index != 0)
+        {
+            if (allIndices.count(index) != 0)
+                charIndices.emplace_back(static_cast<std::uint32_t>(codePoint), index);
+            codePoint = FT_Get_Next_Char(face, codePoint, &index);
+        }
+    }
+    else
+    {
+        charIndices.assign(m_atlas->charIndices.begin(), m_atlas->charIndices.end());
+    }
+
+    writer.write(static_cast<std::uint32_t>(charIndices.size()));
+    for (const auto& [codePoint, index] : charIndices)
+    {
+        writer.write(codePoint);
+        writer.write(index);
+    }
+
+    // Write the pages
+    writer.write(static_cast<std::uint32_t>(m_pages.size()));
+    for (const auto& [characterSize, page] : m_pages)
+    {
+        writer.write(static_cast<std::uint32_t>(characterSize));
+        writer.write(getLineSpacing(characterSize));
+        writer.write(getUnderlinePosition(characterSize));
+        writer.write(getUnderlineThickness(characterSize));
+
+        // Only the alpha channel is stored, glyph pixels are always white
+        const Image    image       = page.texture.copyToImage();
+        const Vector2u textureSize = image.getSize();
+        writer.write(textureSize.x);
+        writer.write(textureSize.y);
+
+        const std::uint8_t* pixels     = image.getPixelsPtr();
+        const std::size_t   pixelCount = static_cast<std::size_t>(textureSize.x) * textureSize.y;
+        for (std::size_t i = 0; i < pixelCount; ++i)
+            writer.write(pixels[i * 4 + 3]);
+
+        writer.write(static_cast<std::uint32_t>(page.nextRow));
+        writer.write(static_cast<std::uint32_t>(page.rows.size()));
+        for (const Row& row : page.rows)
+        {
+            writer.write(static_cast<std::uint32_t>(row.width));
+            writer.write(static_cast<std::uint32_t>(row.top));
+            writer.write(static_cast<std::uint32_t>(row.height));
+        }
+
+        writer.write(static_cast<std::uint32_t>(page.glyphs.size()));
+        for (const auto& [key, glyph] : page.glyphs)
+        {
+            writer.write(key);
+            writer.write(glyph.advance);
+            writer.write(static_cast<std::int32_t>(glyph.lsbDelta));
+            writer.write(static_cast<std::int32_t>(glyph.rsbDelta));
+            writer.write(glyph.bounds.left);
+            writer.write(glyph.bounds.top);
+            writer.write(glyph.bounds.width);
+            writer.write(glyph.bounds.height);
+            writer.write(static_cast<std::int32_t>(glyph.textureRect.left));
+            writer.write(static_cast<std::int32_t>(glyph.textureRect.top));
+            writer.write(static_cast<std::int32_t>(glyph.textureRect.width));
+            writer.write(static_cast<std::int32_t>(glyph.textureRect.height));
+        }
+
+        // Store the non-zero kerning values between all the cached glyphs of this size
+        std::vector<std::pair<std::uint64_t, long>> kerningPairs;
+        if (face)
+        {
+            if (FT_HAS_KERNING(face) && setCurrentSize(characterSize))
+            {
+                const std::vector<std::uint32_t>& indices = pageIndices[characterSize];
+                for (const std::uint32_t first : indices)
+                {
+                    for (const std::uint32_t second : indices)
+                    {
+                        FT_Vector kerning{0, 0};
+                        if ((FT_Get_Kerning(face, first, second, FT_KERNING_UNFITTED, &kerning) == 0) &&
+                            (kerning.x != 0))
+                            kerningPairs.emplace_back(combine(first, second), kerning.x);
+                    }
+                }
+            }
+        }
+        else if (const auto it = m_atlas->sizes.find(characterSize); it != m_atlas->sizes.end())
+        {
+            kerningPairs.assign(it->second.kerning.begin(), it->second.kerning.end());
+        }
+
+        writer.write(static_cast<std::uint32_t>(kerningPairs.size()));
+        for (const auto& [pair, kerning] : kerningPairs)
+        {
+            writer.write(static_cast<std::uint32_t>(pair >> 32));
+            writer.write(static_cast<std::uint32_t>(pair));
+            writer.write(static_cast<std::int32_t>(kerning));
+        }
+    }
+
+    return std::move(writer.getBuffer());
+}
+
+
+////////////////////////////////////////////////////////////
+const Font::Info& Font::getInfo() const
+{
+    return m_info;
+}
+
+
+////////////////////////////////////////////////////////////
+const Glyph& Font::getGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
+{
+    // Distance field glyphs are shared by all sizes and styles, their metrics just have to be scaled
+    if (m_isDistanceField)
+    {
+        ScaledGlyphs& scaledGlyphs = m_scaledGlyphs[characterSize];
+
+        // Latin characters are directly accessible
+        const Glyph** slot = scaledGlyphs.lookup.findSlot(codePoint, bold, 0.f);
+        if (slot && *slot)
+            return **slot;
+
+        const std::uint32_t index = getCharIndex(codePoint);
+
+        auto scaledIt = scaledGlyphs.glyphs.find(combine(0.f, bold, index));
+        if (scaledIt == scaledGlyphs.glyphs.end())
+        {
+            GlyphTable&         glyphs = loadPage(characterSize).glyphs;
+            const std::uint64_t key    = combine(0.f, false, index);
+
+            auto it = glyphs.find(key);
+            if (it == glyphs.end())
+                it = glyphs.emplace(key, loadDistanceFieldGlyph(codePoint)).first;
+
+            const Glyph glyph = scaleGlyph(it->second, characterSize, bold);
+            scaledIt          = scaledGlyphs.glyphs.emplace(combine(0.f, bold, index), glyph).first;
+        }
+
+        if (slot)
+            *slot = &scaledIt->second;
+
+        return scaledIt->second;
+    }
+
+    // Get the page corresponding to the character size
+    Page& page = loadPage(characterSize);
+
+    // Latin characters are directly accessible
+    const Glyph** slot = page.lookup.findSlot(codePoint, bold, outlineThickness);
+    if (slot && *slot)
+        return **slot;
+
+    // Build the key by combining the glyph index (based on code point), bold flag, and outline thickness
+    const std::uint64_t key = combine(outlineThickness, bold, getCharIndex(codePoint));
+
+    // Search the glyph into the cache, and load it if it's not found
+    auto it = page.glyphs.find(key);
+    if (it == page.glyphs.end())
+        it = page.glyphs.emplace(key, loadGlyph(codePoint, characterSize, bold, outlineThickness)).first;
+
+    if (slot)
+        *slot = &it->second;
+
+    return it->second;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::hasGlyph(std::uint32_t codePoint) const
+{
+    return getCharIndex(codePoint) != 0;
+}
+
 
-    // Load the new font face from the specified stream
-    FT_Face face;
-    if (FT_Open_Face(fontHandles->library, &args, 0, &face) != 0)
+////////////////////////////////////////////////////////////
+bool Font::preload(const String&                    characters,
+                   const std::vector<unsigned int>& characterSizes,
+                   bool                             bold,
+                   float                            outlineThickness,
+                   unsigned int                     threadCount) const
+{
+    // Stop if no font face is loaded (atlases are already rasterized)
+    if (!m_fontHandles || !m_fontHandles->face)
     {
-        err() << "Failed to load font from stream (failed to create the font face)" << std::endl;
+        err() << "Failed to preload glyphs (no font face loaded)" << std::endl;
         return false;
     }
-    fontHandles->face = face;
 
-    // Load the stroker that will be used to outline the font
-    if (FT_Stroker_New(fontHandles->library, &fontHandles->stroker) != 0)
+    // Distance field glyphs are shared by all sizes and styles
+    std::vector<unsigned int> sizes = characterSizes;
+    if (m_isDistanceField)
     {
-        err() << "Failed to load font from stream (failed to create the stroker)" << std::endl;
-        return false;
+        sizes            = {distanceFieldSize};
+        bold             = false;
+        outlineThickness = 0;
     }
+    std::sort(sizes.begin(), sizes.end());
+    sizes.erase(std::unique(sizes.begin(), sizes.end()), sizes.end());
 
-    // Select the Unicode character map
-    if (FT_Select_Charmap(face, FT_ENCODING_UNICODE) != 0)
+    // List the glyphs that are not cached yet, once each
+    std::vector<PreloadJob> jobs;
+    for (const unsigned int characterSize : sizes)
     {
-        err() << "Failed to load font from stream (failed to set the Unicode character set)" << std::endl;
-        return false;
+        const GlyphTable&                 glyphs = loadPage(characterSize).glyphs;
+        std::unordered_set<std::uint64_t> keys;
+        for (const std::uint32_t codePoint : characters)
+        {
+            const std::uint64_t key = combine(outlineThickness, bold, getCharIndex(codePoint));
+            if ((glyphs.count(key) == 0) && keys.insert(key).second)
+            {
+                PreloadJob& job   = jobs.emplace_back();
+                job.codePoint     = codePoint;
+                job.characterSize = characterSize;
+                job.key           = key;
+            }
+        }
     }
 
-    // Store the loaded font handles
-    m_fontHandles = std::move(fontHandles);
+    if (jobs.empty())
+        return true;
+
+    // FreeType faces can't be shared between threads, so each worker opens its own face from
+    // the font source; streams can't be read concurrently either, so they are read in memory first.
+    // Files are mapped in memory for the time of the preloading only, the workers then share the mapping
+    const std::filesystem::path& filename = m_fontHandles->filename;
+    const void*                  data     = m_fontHandles->data;
+    std::size_t                  dataSize = m_fontHandles->dataSize;
+    std::vector<std::byte>       streamData;
+    MappedFileInputStream        file;
+    if (!filename.empty())
+    {
+        if (file.open(filename, MappedFileInputStream::AccessPattern::Random) && file.getData())
+        {
+            data     = file.getData();
+            dataSize = static_cast<std::size_t>(file.getSize());
+        }
+    }
+    else if (!data)
+    {
+        auto* const        stream = static_cast<InputStream*>(m_fontHandles->streamRec.descriptor.pointer);
+        const std::int64_t size   = stream ? stream->getSize() : -1;
+        if ((size > 0) && (stream->seek(0) == 0))
+        {
+            streamData.resize(static_cast<std::size_t>(size));
+            if (stream->read(streamData.data(), size) == size)
+            {
+                data     = streamData.data();
+                dataSize = streamData.size();
+            }
+        }
+    }
 
-    // Store the font information
-    m_info.family = face->family_name ? face->family_name : std::string();
+    // Rasterize the glyphs on the worker threads, which pick the next pending job until there's none left
+    std::atomic<std::size_t> nextJob(0);
+    const bool               isDistanceField = m_isDistanceField;
+    const auto               rasterize       = [&]()
+    {
+        FontHandles handles;
+        FT_Face     face = nullptr;
+        if (FT_Init_FreeType(&handles.library) != 0)
+            return;
+
+        const FT_Error error = data ? FT_New_Memory_Face(handles.library,
+                                                         static_cast<const FT_Byte*>(data),
+                                                         static_cast<FT_Long>(dataSize),
+                                                         0,
+                                                         &face)
+                                    : FT_New_Face(handles.library, filename.string().c_str(), 0, &face);
+        if (error != 0)
+            return;
+        handles.face = face;
+
+        if (FT_Stroker_New(handles.library, &handles.stroker) != 0)
+            return;
+
+        if (FT_Select_Charmap(face, FT_ENCODING_UNICODE) != 0)
+            return;
+
+        // Errors are not reported from here, failed glyphs are retried on the calling thread
+        for (std::size_t i = nextJob++; i < jobs.size(); i = nextJob++)
+        {
+            PreloadJob& job = jobs[i];
+            if (setFaceSize(face, job.characterSize) != 0)
+                continue;
 
-    return true;
-}
+            if (isDistanceField)
+                job.done = rasterizeDistanceFieldGlyph(face, job.codePoint, job.bitmap);
+            else
+                job.done = rasterizeGlyph(handles.library,
+                                          face,
+                                          handles.stroker,
+                                          job.codePoint,
+                                          bold,
+                                          outlineThickness,
+                                          job.bitmap);
+        }
+    };
 
+    if (!filename.empty() || data)
+    {
+        if (threadCount == 0)
+            threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+        threadCount = static_cast<unsigned int>(std::min<std::size_t>(threadCount, jobs.size()));
+
+        std::vector<std::thread> workers;
+        workers.reserve(threadCount);
+        for (unsigned int i = 0; i < threadCount; ++i)
+            workers.emplace_back(rasterize);
+        for (std::thread& worker : workers)
+            worker.join();
+    }
 
-////////////////////////////////////////////////////////////
-const Font::Info& Font::getInfo() const
-{
-    return m_info;
-}
+    // Rasterize whatever the workers couldn't with our own face
+    for (PreloadJob& job : jobs)
+    {
+        if (job.done || !setCurrentSize(job.characterSize))
+            continue;
 
+        job.done = m_isDistanceField ? rasterizeDistanceFieldGlyph(m_fontHandles->face, job.codePoint, job.bitmap)
+                                     : rasterizeGlyph(m_fontHandles->library,
+                                                      m_fontHandles->face,
+                                                      m_fontHandles->stroker,
+                                                      job.codePoint,
+                                                      bold,
+                                                      outlineThickness,
+                                                      job.bitmap);
+    }
 
-////////////////////////////////////////////////////////////
-const Glyph& Font::getGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
-{
-    // Get the page corresponding to the character size
-    GlyphTable& glyphs = loadPage(characterSize).glyphs;
+    // Pack the glyphs into their pages, remembering where their pixels go
+    std::unordered_map<Page*, std::vector<std::pair<const GlyphBitmap*, IntRect>>> blits;
+    bool                                                                            outlineFailed = false;
+    for (PreloadJob& job : jobs)
+    {
+        if (!job.done)
+            continue;
 
-    // Build the key by combining the glyph index (based on code point), bold flag, and outline thickness
-    const std::uint64_t key = combine(outlineThickness,
-                                      bold,
-                                      FT_Get_Char_Index(m_fontHandles ? m_fontHandles->face : nullptr, codePoint));
+        Page& page = loadPage(job.characterSize);
+        if ((job.bitmap.size.x > 0) && (job.bitmap.size.y > 0))
+        {
+            const IntRect rect           = findGlyphRect(page, job.bitmap.size);
+            job.bitmap.glyph.textureRect = removePadding(rect, job.bitmap.padding);
+            blits[&page].emplace_back(&job.bitmap, rect);
+        }
 
-    // Search the glyph into the cache
-    if (const auto it = glyphs.find(key); it != glyphs.end())
-    {
-        // Found: just return it
-        return it->second;
+        outlineFailed = outlineFailed || job.bitmap.outlineFailed;
+        page.glyphs.emplace(job.key, job.bitmap.glyph);
     }
-    else
+
+    if (outlineFailed)
+        err() << "Failed to outline glyph (no fallback available)" << std::endl;
+
+    // Upload each modified page only once
+    for (const auto& [page, pageBlits] : blits)
     {
-        // Not found: we have to load it
-        const Glyph glyph = loadGlyph(codePoint, characterSize, bold, outlineThickness);
-        return glyphs.emplace(key, glyph).first->second;
+        const Image    image = page->texture.copyToImage();
+        const Vector2u size  = image.getSize();
+        const auto*    begin = image.getPixelsPtr();
+
+        std::vector<std::uint8_t> pixels(begin, begin + static_cast<std::size_t>(size.x) * size.y * 4);
+        for (const auto& [bitmap, rect] : pageBlits)
+        {
+            const Vector2u position(rect.getPosition());
+            const Vector2u area(std::min(bitmap->size.x, static_cast<unsigned int>(rect.width)),
+                                std::min(bitmap->size.y, static_cast<unsigned int>(rect.height)));
+
+            for (unsigned int y = 0; y < area.y; ++y)
+                std::memcpy(&pixels[((position.y + y) * size.x + position.x) * 4],
+                            &bitmap->pixels[y * bitmap->size.x * 4],
+                            area.x * 4);
+        }
+
+        page->texture.update(pixels.data());
     }
+
+    return true;
 }
 
 
 ////////////////////////////////////////////////////////////
-bool Font::hasGlyph(std::uint32_t codePoint) const
+bool Font::preload(std::uint32_t                    first,
+                   std::uint32_t                    last,
+                   const std::vector<unsigned int>& characterSizes,
+                   bool                             bold,
+                   float                            outlineThickness,
+                   unsigned int                     threadCount) const
 {
-    return FT_Get_Char_Index(m_fontHandles ? m_fontHandles->face : nullptr, codePoint) != 0;
+    std::u32string characters;
+    for (std::uint64_t codePoint = first; codePoint <= last; ++codePoint)
+        characters.push_back(static_cast<char32_t>(codePoint));
+
+    return preload(String(characters), characterSizes, bold, outlineThickness, threadCount);
 }
 
 
@@ -355,6 +1554,22 @@ float Font::getKerning(std::uint32_t first, std::uint32_t second, unsigned int c
     if (first == 0 || second == 0)
         return 0.f;
 
+    // Computing the kerning of a pair is expensive, so the result is cached
+    // (the key can only hold valid code points and reasonable character sizes)
+    if ((first | second | characterSize) > kerningKeyMask)
+        return loadKerning(first, second, characterSize, bold);
+
+    const std::uint64_t key = kerningKey(first, second, characterSize, bold);
+    if (const auto it = m_kerning.find(key); it != m_kerning.end())
+        return it->second;
+
+    return m_kerning.emplace(key, loadKerning(first, second, characterSize, bold)).first->second;
+}
+
+
+////////////////////////////////////////////////////////////
+float Font::loadKerning(std::uint32_t first, std::uint32_t second, unsigned int characterSize, bool bold) const
+{
     FT_Face face = m_fontHandles ? m_fontHandles->face : nullptr;
 
     if (face && setCurrentSize(characterSize))
@@ -367,19 +1582,35 @@ float Font::getKerning(std::uint32_t first, std::uint32_t second, unsigned int c
         const auto firstRsbDelta  = static_cast<float>(getGlyph(first, characterSize, bold).rsbDelta);
         const auto secondLsbDelta = static_cast<float>(getGlyph(second, characterSize, bold).lsbDelta);
 
-        // Get the kerning vector if present
+        // Get the kerning vector if present; loading a distance field glyph above
+        // may have left the face at the reference size, so set the size again
         FT_Vector kerning{0, 0};
-        if (FT_HAS_KERNING(face))
+        if (FT_HAS_KERNING(face) && setCurrentSize(characterSize))
             FT_Get_Kerning(face, index1, index2, FT_KERNING_UNFITTED, &kerning);
 
-        // X advance is already in pixels for bitmap fonts
-        if (!FT_IS_SCALABLE(face))
-            return static_cast<float>(kerning.x);
+        return computeKerning(FT_IS_SCALABLE(face), kerning.x, firstRsbDelta, secondLsbDelta);
+    }
+    else if (m_atlas)
+    {
+        // Use the kerning pairs saved in the atlas, distance field atlases only hold the reference size
+        const unsigned int atlasSize = m_isDistanceField ? distanceFieldSize : characterSize;
+        const float        scale     = static_cast<float>(characterSize) / static_cast<float>(atlasSize);
+
+        const auto sizeIt = m_atlas->sizes.find(atlasSize);
+        if (sizeIt == m_atlas->sizes.end())
+            return 0.f;
+
+        const auto firstRsbDelta  = static_cast<float>(getGlyph(first, characterSize, bold).rsbDelta);
+        const auto secondLsbDelta = static_cast<float>(getGlyph(second, characterSize, bold).lsbDelta);
+
+        const auto& kerningPairs = sizeIt->second.kerning;
+        const auto  kerningIt    = kerningPairs.find(combine(getCharIndex(first), getCharIndex(second)));
+        const long  kerning      = kerningIt != kerningPairs.end() ? kerningIt->second : 0;
 
-        // Combine kerning with compensation deltas and return the X advance
-        // Flooring is required as we use FT_KERNING_UNFITTED flag which is not quantized in 64 based grid
-        return std::floor(
-            (secondLsbDelta - firstRsbDelta + static_cast<float>(kerning.x) + 32) / static_cast<float>(1 << 6));
+        return computeKerning(m_atlas->isScalable,
+                              std::lround(static_cast<float>(kerning) * scale),
+                              firstRsbDelta,
+                              secondLsbDelta);
     }
     else
     {
@@ -398,6 +1629,15 @@ float Font::getLineSpacing(unsigned int characterSize) const
     {
         return static_cast<float>(face->size->metrics.height) / static_cast<float>(1 << 6);
     }
+    else if (m_atlas)
+    {
+        // Distance field atlases only hold the metrics of the reference size
+        const unsigned int atlasSize = m_isDistanceField ? distanceFieldSize : characterSize;
+        const float        scale     = static_cast<float>(characterSize) / static_cast<float>(atlasSize);
+
+        const auto it = m_atlas->sizes.find(atlasSize);
+        return it != m_atlas->sizes.end() ? it->second.lineSpacing * scale : 0.f;
+    }
     else
     {
         return 0.f;
@@ -419,6 +1659,15 @@ float Font::getUnderlinePosition(unsigned int characterSize) const
         return -static_cast<float>(FT_MulFix(face->underline_position, face->size->metrics.y_scale)) /
                static_cast<float>(1 << 6);
     }
+    else if (m_atlas)
+    {
+        // Distance field atlases only hold the metrics of the reference size
+        const unsigned int atlasSize = m_isDistanceField ? distanceFieldSize : characterSize;
+        const float        scale     = static_cast<float>(characterSize) / static_cast<float>(atlasSize);
+
+        const auto it = m_atlas->sizes.find(atlasSize);
+        return it != m_atlas->sizes.end() ? it->second.underlinePosition * scale : 0.f;
+    }
     else
     {
         return 0.f;
@@ -440,6 +1689,15 @@ float Font::getUnderlineThickness(unsigned int characterSize) const
         return static_cast<float>(FT_MulFix(face->underline_thickness, face->size->metrics.y_scale)) /
                static_cast<float>(1 << 6);
     }
+    else if (m_atlas)
+    {
+        // Distance field atlases only hold the metrics of the reference size
+        const unsigned int atlasSize = m_isDistanceField ? distanceFieldSize : characterSize;
+        const float        scale     = static_cast<float>(characterSize) / static_cast<float>(atlasSize);
+
+        const auto it = m_atlas->sizes.find(atlasSize);
+        return it != m_atlas->sizes.end() ? it->second.underlineThickness * scale : 0.f;
+    }
     else
     {
         return 0.f;
@@ -460,9 +1718,10 @@ void Font::setSmooth(bool smooth)
     {
         m_isSmooth = smooth;
 
+        // Distance fields can't be rendered without filtering
         for (auto& [key, page] : m_pages)
         {
-            page.texture.setSmooth(m_isSmooth);
+            page.texture.setSmooth(m_isSmooth || m_isDistanceField);
         }
     }
 }
@@ -474,14 +1733,39 @@ bool Font::isSmooth() const
 }
 
 
+////////////////////////////////////////////////////////////
+void Font::setDistanceFieldEnabled(bool enabled)
+{
+    if (enabled != m_isDistanceField)
+    {
+        m_isDistanceField = enabled;
+
+        // The glyphs cached so far were rendered for the other mode
+        m_pages.clear();
+        m_scaledGlyphs.clear();
+        m_kerning.clear();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::isDistanceFieldEnabled() const
+{
+    return m_isDistanceField;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Font::cleanup()
 {
     // Drop ownership of shared FreeType pointers
     m_fontHandles.reset();
+    m_atlas.reset();
 
     // Reset members
     m_pages.clear();
+    m_scaledGlyphs.clear();
+    m_kerning.clear();
     std::vector<std::uint8_t>().swap(m_pixelBuffer);
 }
 
@@ -489,6 +1773,10 @@ void Font::cleanup()
 ////////////////////////////////////////////////////////////
 Font::Page& Font::loadPage(unsigned int characterSize) const
 {
+    // All the character sizes share the same page in distance field mode
+    if (m_isDistanceField)
+        return m_pages.try_emplace(distanceFieldSize, true).first->second;
+
     return m_pages.try_emplace(characterSize, m_isSmooth).first->second;
 }
 
@@ -496,172 +1784,131 @@ Font::Page& Font::loadPage(unsigned int characterSize) const
 ////////////////////////////////////////////////////////////
 Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
 {
-    // The glyph to return
-    Glyph glyph;
-
     // Stop if no font is loaded
     if (!m_fontHandles)
-        return glyph;
+        return {};
 
     // Get our FT_Face
     FT_Face face = m_fontHandles->face;
     if (!face)
-        return glyph;
+        return {};
 
     // Set the character size
     if (!setCurrentSize(characterSize))
-        return glyph;
-
-    // Load the glyph corresponding to the code point
-    FT_Int32 flags = FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT;
-    if (outlineThickness != 0)
-        flags |= FT_LOAD_NO_BITMAP;
-    if (FT_Load_Char(face, codePoint, flags) != 0)
-        return glyph;
-
-    // Retrieve the glyph
-    FT_Glyph glyphDesc;
-    if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
-        return glyph;
-
-    // Apply bold and outline (there is no fallback for outline) if necessary -- first technique using outline (highest quality)
-    const FT_Pos weight  = 1 << 6;
-    const bool   outline = (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE);
-    if (outline)
+        return {};
+
+    // Rasterize the glyph, reusing our pixel buffer
+    GlyphBitmap bitmap;
+    bitmap.pixels.swap(m_pixelBuffer);
+    const bool loaded = rasterizeGlyph(m_fontHandles->library,
+                                       face,
+                                       m_fontHandles->stroker,
+                                       codePoint,
+                                       bold,
+                                       outlineThickness,
+                                       bitmap);
+    bitmap.pixels.swap(m_pixelBuffer);
+
+    if (!loaded)
+        return {};
+
+    if (bitmap.outlineFailed)
+        err() << "Failed to outline glyph (no fallback available)" << std::endl;
+
+    if ((bitmap.size.x > 0) && (bitmap.size.y > 0))
     {
-        if (bold)
-        {
-            auto* outlineGlyph = reinterpret_cast<FT_OutlineGlyph>(glyphDesc);
-            FT_Outline_Embolden(&outlineGlyph->outline, weight);
-        }
+        // Find a good position for the new glyph into the texture, and write its pixels there
+        Page&         page = loadPage(characterSize);
+        const IntRect rect = findGlyphRect(page, bitmap.size);
+        page.texture.update(m_pixelBuffer.data(), bitmap.size, Vector2u(rect.getPosition()));
 
-        if (outlineThickness != 0)
-        {
-            FT_Stroker stroker = m_fontHandles->stroker;
-
-            FT_Stroker_Set(stroker,
-                           static_cast<FT_Fixed>(outlineThickness * static_cast<float>(1 << 6)),
-                           FT_STROKER_LINECAP_ROUND,
-                           FT_STROKER_LINEJOIN_ROUND,
-                           0);
-            FT_Glyph_Stroke(&glyphDesc, stroker, true);
-        }
+        // Make sure the texture data is positioned in the center
+        // of the allocated texture rectangle
+        bitmap.glyph.textureRect = removePadding(rect, bitmap.padding);
     }
 
-    // Convert the glyph to a bitmap (i.e. rasterize it)
-    // Warning! After this line, do not read any data from glyphDesc directly, use
-    // bitmapGlyph.root to access the FT_Glyph data.
-    FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, nullptr, 1);
-    auto*      bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
-    FT_Bitmap& bitmap      = bitmapGlyph->bitmap;
-
-    // Apply bold if necessary -- fallback technique using bitmap (lower quality)
-    if (!outline)
-    {
-        if (bold)
-            FT_Bitmap_Embolden(m_fontHandles->library, &bitmap, weight, weight);
-
-        if (outlineThickness != 0)
-            err() << "Failed to outline glyph (no fallback available)" << std::endl;
-    }
+    return bitmap.glyph;
+}
 
-    // Compute the glyph's advance offset
-    glyph.advance = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
-    if (bold)
-        glyph.advance += static_cast<float>(weight) / static_cast<float>(1 << 6);
 
-    glyph.lsbDelta = static_cast<int>(face->glyph->lsb_delta);
-    glyph.rsbDelta = static_cast<int>(face->glyph->rsb_delta);
+////////////////////////////////////////////////////////////
+Glyph Font::loadDistanceFieldGlyph(std::uint32_t codePoint) const
+{
+    // Stop if no font is loaded
+    if (!m_fontHandles)
+        return {};
 
-    unsigned int width  = bitmap.width;
-    unsigned int height = bitmap.rows;
+    // Get our FT_Face
+    FT_Face face = m_fontHandles->face;
+    if (!face)
+        return {};
 
-    if ((width > 0) && (height > 0))
-    {
-        // Leave a small padding around characters, so that filtering doesn't
-        // pollute them with pixels from neighbors
-        const unsigned int padding = 2;
+    // Distance field glyphs are always rasterized at the reference size
+    if (!setCurrentSize(distanceFieldSize))
+        return {};
 
-        width += 2 * padding;
-        height += 2 * padding;
+    // Rasterize the glyph, reusing our pixel buffer
+    GlyphBitmap bitmap;
+    bitmap.pixels.swap(m_pixelBuffer);
+    const bool loaded = rasterizeDistanceFieldGlyph(face, codePoint, bitmap);
+    bitmap.pixels.swap(m_pixelBuffer);
 
-        // Get the glyphs page corresponding to the character size
-        Page& page = loadPage(characterSize);
+    if (!loaded)
+        return {};
 
-        // Find a good position for the new glyph into the texture
-        glyph.textureRect = findGlyphRect(page, {width, height});
+    if ((bitmap.size.x > 0) && (bitmap.size.y > 0))
+    {
+        // Find a good position for the new glyph into the texture, and write its pixels there
+        Page&         page = loadPage(distanceFieldSize);
+        const IntRect rect = findGlyphRect(page, bitmap.size);
+        page.texture.update(m_pixelBuffer.data(), bitmap.size, Vector2u(rect.getPosition()));
+
+        // Make sure the texture rectangle only covers the glyph itself,
+        // the spread of the distance field surrounds it
+        bitmap.glyph.textureRect = removePadding(rect, bitmap.padding);
+    }
 
-        // Make sure the texture data is positioned in the center
-        // of the allocated texture rectangle
-        glyph.textureRect.left += static_cast<int>(padding);
-        glyph.textureRect.top += static_cast<int>(padding);
-        glyph.textureRect.width -= static_cast<int>(2 * padding);
-        glyph.textureRect.height -= static_cast<int>(2 * padding);
+    return bitmap.glyph;
+}
 
-        // Compute the glyph's bounding box
-        glyph.bounds.left   = static_cast<float>(bitmapGlyph->left);
-        glyph.bounds.top    = static_cast<float>(-bitmapGlyph->top);
-        glyph.bounds.width  = static_cast<float>(bitmap.width);
-        glyph.bounds.height = static_cast<float>(bitmap.rows);
 
-        // Resize the pixel buffer to the new size and fill it with transparent white pixels
-        m_pixelBuffer.resize(static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * 4);
+////////////////////////////////////////////////////////////
+float Font::getDistanceFieldPadding(unsigned int characterSize) const
+{
+    return static_cast<float>(distanceFieldSpread * characterSize) / static_cast<float>(distanceFieldSize);
+}
 
-        std::uint8_t* current = m_pixelBuffer.data();
-        std::uint8_t* end     = current + width * height * 4;
 
-        while (current != end)
-        {
-            (*current++) = 255;
-            (*current++) = 255;
-            (*current++) = 255;
-            (*current++) = 0;
-        }
+////////////////////////////////////////////////////////////
+const Shader* Font::getDistanceFieldShader(unsigned int characterSize, bool bold, float outlineThickness) const
+{
+    if (!Shader::isAvailable() || (characterSize == 0))
+        return nullptr;
 
-        // Extract the glyph's pixels from the bitmap
-        const std::uint8_t* pixels = bitmap.buffer;
-        if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
-        {
-            // Pixels are 1 bit monochrome values
-            for (unsigned int y = padding; y < height - padding; ++y)
-            {
-                for (unsigned int x = padding; x < width - padding; ++x)
-                {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = x + y * width;
-                    m_pixelBuffer[index * 4 + 3] = ((pixels[(x - padding) / 8]) & (1 << (7 - ((x - padding) % 8)))) ? 255 : 0;
-                }
-                pixels += bitmap.pitch;
-            }
-        }
-        else
+    // Create the shader on first use, it is then shared by all the copies of this font
+    if (!m_distanceFieldShader)
+    {
+        auto shader = std::make_shared<Shader>();
+        if (!shader->loadFromMemory(distanceFieldShaderSource, Shader::Type::Fragment))
         {
-            // Pixels are 8 bits gray levels
-            for (unsigned int y = padding; y < height - padding; ++y)
-            {
-                for (unsigned int x = padding; x < width - padding; ++x)
-                {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index      = x + y * width;
-                    m_pixelBuffer[index * 4 + 3] = pixels[x - padding];
-                }
-                pixels += bitmap.pitch;
-            }
+            err() << "Failed to load the distance field shader" << std::endl;
+            return nullptr;
         }
 
-        // Write the pixels to the texture
-        const unsigned int x = static_cast<unsigned int>(glyph.textureRect.left) - padding;
-        const unsigned int y = static_cast<unsigned int>(glyph.textureRect.top) - padding;
-        const unsigned int w = static_cast<unsigned int>(glyph.textureRect.width) + 2 * padding;
-        const unsigned int h = static_cast<unsigned int>(glyph.textureRect.height) + 2 * padding;
-        page.texture.update(m_pixelBuffer.data(), {w, h}, {x, y});
+        shader->setUniform("texture", Shader::CurrentTexture);
+        m_distanceFieldShader = std::move(shader);
     }
 
-    // Delete the FT glyph
-    FT_Done_Glyph(glyphDesc);
+    // Move the edge outwards by half the bold weight and by the outline thickness,
+    // converted from pixels at the requested size to distance field units
+    const float pixelsToDistance = static_cast<float>(distanceFieldSize) /
+                                   (static_cast<float>(characterSize) * 2.f * static_cast<float>(distanceFieldSpread));
+    const float offset           = (bold ? 0.5f : 0.f) + outlineThickness;
+    const float threshold        = std::clamp(0.5f - offset * pixelsToDistance, 0.01f, 0.99f);
 
-    // Done :)
-    return glyph;
+    m_distanceFieldShader->setUniform("threshold", threshold);
+
+    return m_distanceFieldShader.get();
 }
 
 
@@ -710,7 +1957,7 @@ IntRect Font::findGlyphRect(Page& page, const Vector2u& size) const
                     return {{0, 0}, {2, 2}};
                 }
 
-                newTexture.setSmooth(m_isSmooth);
+                newTexture.setSmooth(page.texture.isSmooth());
                 newTexture.update(page.texture);
                 page.texture.swap(newTexture);
             }
@@ -780,6 +2027,37 @@ bool Font::setCurrentSize(unsigned int characterSize) const
 }
 
 
+////////////////////////////////////////////////////////////
+std::uint32_t Font::getCharIndex(std::uint32_t codePoint) const
+{
+    if (m_atlas)
+    {
+        const auto it = m_atlas->charIndices.find(codePoint);
+        return it != m_atlas->charIndices.end() ? it->second : 0;
+    }
+
+    return FT_Get_Char_Index(m_fontHandles ? m_fontHandles->face : nullptr, codePoint);
+}
+
+
+////////////////////////////////////////////////////////////
+const Glyph** Font::GlyphLookup::findSlot(std::uint32_t codePoint, bool bold, float thickness)
+{
+    if (codePoint >= size)
+        return nullptr;
+
+    // Only the outlined glyphs of a single thickness are referenced, forget the previous ones
+    if ((thickness != 0) && (thickness != outlineThickness))
+    {
+        std::fill(glyphs.begin() + size * 2, glyphs.end(), nullptr);
+        outlineThickness = thickness;
+    }
+
+    const std::uint32_t style = (thickness != 0 ? 2u : 0u) + (bold ? 1u : 0u);
+    return &glyphs[style * size + codePoint];
+}
+
+
 ////////////////////////////////////////////////////////////
 Font::Page::Page(bool smooth)
 {
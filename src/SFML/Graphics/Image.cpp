@@ -29,6 +29,7 @@
 
 #include <SFML/System/Err.hpp>
 #include <SFML/System/InputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
 #include <SFML/System/Utils.hpp>
 #ifdef SFML_SYSTEM_ANDROID
 #include <SFML/System/Android/ResourceStream.hpp>
@@ -41,6 +42,7 @@
 
 #include <algorithm>
 #include <iomanip>
+#include <limits>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -162,11 +164,28 @@ bool Image::loadFromFile(const std::filesystem::path& filename)
     // Clear the array (just in case)
     m_pixels.clear();
 
+    // Map the file in memory if possible, stb_image then decodes it in place
+    // instead of reading it in small chunks; other files are read with stdio
+    MappedFileInputStream file;
+    const bool            isMapped = file.open(filename, MappedFileInputStream::AccessPattern::Sequential) &&
+                          file.getData() && (file.getSize() <= std::numeric_limits<int>::max());
+
     // Load the image and get a pointer to the pixels in memory
-    int        width    = 0;
-    int        height   = 0;
-    int        channels = 0;
-    const auto ptr      = StbPtr(stbi_load(filename.string().c_str(), &width, &height, &channels, STBI_rgb_alpha));
+    int      width    = 0;
+    int      height   = 0;
+    int      channels = 0;
+    stbi_uc* pixels   = nullptr;
+    if (isMapped)
+    {
+        const auto* buffer = static_cast<const stbi_uc*>(file.getData());
+        const auto  size   = static_cast<int>(file.getSize());
+        pixels             = stbi_load_from_memory(buffer, size, &width, &height, &channels, STBI_rgb_alpha);
+    }
+    else
+    {
+        pixels = stbi_load(filename.string().c_str(), &width, &height, &channels, STBI_rgb_alpha);
+    }
+    const auto ptr = StbPtr(pixels);
 
     if (ptr)
     {
@@ -61,19 +61,27 @@ void addLine(sf::VertexArray& vertices,
 }
 
 // Add a glyph quad to the vertex array
-void addGlyphQuad(sf::VertexArray& vertices, sf::Vector2f position, const sf::Color& color, const sf::Glyph& glyph, float italicShear)
+void addGlyphQuad(sf::VertexArray& vertices,
+                  sf::Vector2f     position,
+                  const sf::Color& color,
+                  const sf::Glyph& glyph,
+                  float            italicShear,
+                  float            padding)
 {
-    const float padding = 1.0;
+    // Glyphs might be stored at a different scale than they are displayed (e.g. distance field glyphs)
+    float texturePadding = padding;
+    if (glyph.bounds.width > 0)
+        texturePadding *= static_cast<float>(glyph.textureRect.width) / glyph.bounds.width;
 
     const float left   = glyph.bounds.left - padding;
     const float top    = glyph.bounds.top - padding;
     const float right  = glyph.bounds.left + glyph.bounds.width + padding;
     const float bottom = glyph.bounds.top + glyph.bounds.height + padding;
 
-    const float u1 = static_cast<float>(glyph.textureRect.left) - padding;
-    const float v1 = static_cast<float>(glyph.textureRect.top) - padding;
-    const float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
-    const float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + padding;
+    const float u1 = static_cast<float>(glyph.textureRect.left) - texturePadding;
+    const float v1 = static_cast<float>(glyph.textureRect.top) - texturePadding;
+    const float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + texturePadding;
+    const float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + texturePadding;
 
     vertices.append({{position.x + left - italicShear * top, position.y + top}, color, {u1, v1}});
     vertices.append({{position.x + right - italicShear * top, position.y + top}, color, {u2, v1}});
@@ -349,9 +357,21 @@ void Text::draw(RenderTarget& target, const RenderStates& states) const
     statesCopy.texture        = &m_font->getTexture(m_characterSize);
     statesCopy.coordinateType = CoordinateType::Pixels;
 
+    // Distance field glyphs are rendered with the font's shader, unless a custom one is provided
+    const bool useDistanceField = m_font->isDistanceFieldEnabled() && !states.shader;
+    const bool isBold           = m_style & Bold;
+
     // Only draw the outline if there is something to draw
     if (m_outlineThickness != 0)
+    {
+        if (useDistanceField)
+            statesCopy.shader = m_font->getDistanceFieldShader(m_characterSize, isBold, m_outlineThickness);
+
         target.draw(m_outlineVertices, statesCopy);
+    }
+
+    if (useDistanceField)
+        statesCopy.shader = m_font->getDistanceFieldShader(m_characterSize, isBold, 0);
 
     target.draw(m_vertices, statesCopy);
 }
@@ -387,6 +407,9 @@ void Text::ensureGeometryUpdate() const
     const float underlineOffset    = m_font->getUnderlinePosition(m_characterSize);
     const float underlineThickness = m_font->getUnderlineThickness(m_characterSize);
 
+    // Leave room around glyph quads for filtering, or for the outline and boldness of distance field glyphs
+    const float padding = m_font->isDistanceFieldEnabled() ? m_font->getDistanceFieldPadding(m_characterSize) : 1.f;
+
     // Compute the location of the strike through dynamically
     // We use the center point of the lowercase 'x' glyph as the reference
     // We reuse the underline thickness as the thickness of the strike through as well
@@ -470,14 +493,14 @@ void Text::ensureGeometryUpdate() const
             const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold, m_outlineThickness);
 
             // Add the outline glyph to the vertices
-            addGlyphQuad(m_outlineVertices, Vector2f(x, y), m_outlineColor, glyph, italicShear);
+            addGlyphQuad(m_outlineVertices, Vector2f(x, y), m_outlineColor, glyph, italicShear, padding);
         }
 
         // Extract the current glyph's description
         const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold);
 
         // Add the glyph to the vertices
-        addGlyphQuad(m_vertices, Vector2f(x, y), m_fillColor, glyph, italicShear);
+        addGlyphQuad(m_vertices, Vector2f(x, y), m_fillColor, glyph, italicShear, padding);
 
         // Update the current bounds
         const float left   = glyph.bounds.left;
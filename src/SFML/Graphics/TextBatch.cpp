@@ -0,0 +1,379 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/TextBatch.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <cassert>
+
+
+namespace
+{
+// Copy the vertices of a text into the batch, at the text's position
+void copyVertices(const sf::VertexArray& source, sf::VertexArray& target, std::size_t offset, sf::Vector2f position)
+{
+    for (std::size_t i = 0; i < source.getVertexCount(); ++i)
+    {
+        target[offset + i] = source[i];
+        target[offset + i].position += position;
+    }
+}
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TextBatch::TextBatch(const Font& font, unsigned int characterSize) : m_font(&font), m_characterSize(characterSize)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextBatch::add(const String& string, const Vector2f& position, const Color& fillColor, std::uint32_t style)
+{
+    // Reuse the entry of a removed string if possible
+    std::size_t id = m_entries.size();
+    if (!m_freeEntries.empty())
+    {
+        id = m_freeEntries.back();
+        m_freeEntries.pop_back();
+        m_entries[id].used = true;
+        m_entries[id].text.setOutlineColor(Color::Black);
+    }
+    else
+    {
+        m_entries.push_back({Text(*m_font, "", m_characterSize)});
+        m_entries.back().text.setOutlineThickness(m_outlineThickness);
+    }
+
+    Entry& entry = getEntryForUpdate(id);
+    entry.text.setString(string);
+    entry.text.setPosition(position);
+    entry.text.setFillColor(fillColor);
+    entry.text.setStyle(style);
+
+    return id;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextBatch::remove(std::size_t id)
+{
+    assert(id < m_entries.size() && "Index is out of bounds");
+    if (!m_entries[id].used)
+        return;
+
+    // The entry is emptied and kept for a future string, so that other identifiers stay valid
+    Entry& entry = getEntryForUpdate(id);
+    entry.text.setString("");
+    entry.used = false;
+    m_freeEntries.push_back(id);
+}
+
+
+////////////////////////////////////////////////////////////
+void TextBatch::clear()
+{
+    m_entries.clear();
+    m_freeEntries.clear();
+    m_geometryNeedRebuild = true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextBatch::getStringCount() const
+{
+    return m_entries.size() - m_freeEntries.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void TextBatch::setString(std::size_t id, const String& string)
+{
+    getEntryForUpdate(id).text.setString(string);
+}
+
+
+////////////////////////////////////////////////////////////
+void TextBatch::setStringPosition(std::size_t id, const Vector2f& position)
+{
+    getEntryForUpdate(id).text.setPosition(position);
+}
+
+
+////////////////////////////////////////////////////////////
+void TextBatch::setStringFillColor(std::size_t id, const Color& color)
+{
+    getEntryForUpdate(id).text.setFillColor(color);
+}
+
+
+////////////////////////////////////////////////////////////
+void TextBatch::setStringOutlineColor(std::size_t id, const Color& color)
+{
+    getEntryForUpdate(id).text.setOutlineColor(color);
+}
+
+
+////////////////////////////////////////////////////////////
+void TextBatch::setStringStyle(std::size_t id, std::uint32_t style)
+{
+    getEntryForUpdate(id).text.setStyle(style);
+}
+
+
+////////////////////////////////////////////////////////////
+void TextBatch::setOutlineThickness(float thickness)
+{
+    if (thickness != m_outlineThickness)
+    {
+        m_outlineThickness = thickness;
+
+        for (Entry& entry : m_entries)
+            entry.text.setOutlineThickness(thickness);
+
+        m_geometryNeedUpdate = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+const String& TextBatch::getString(std::size_t id) const
+{
+    assert(id < m_entries.size() && "Index is out of bounds");
+    return m_entries[id].text.getString();
+}
+
+
+////////////////////////////////////////////////////////////
+const Vector2f& TextBatch::getStringPosition(std::size_t id) const
+{
+    assert(id < m_entries.size() && "Index is out of bounds");
+    return m_entries[id].text.getPosition();
+}
+
+
+////////////////////////////////////////////////////////////
+const Color& TextBatch::getStringFillColor(std::size_t id) const
+{
+    assert(id < m_entries.size() && "Index is out of bounds");
+    return m_entries[id].text.getFillColor();
+}
+
+
+////////////////////////////////////////////////////////////
+const Color& TextBatch::getStringOutlineColor(std::size_t id) const
+{
+    assert(id < m_entries.size() && "Index is out of bounds");
+    return m_entries[id].text.getOutlineColor();
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t TextBatch::getStringStyle(std::size_t id) const
+{
+    assert(id < m_entries.size() && "Index is out of bounds");
+    return m_entries[id].text.getStyle();
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TextBatch::getStringBounds(std::size_t id) const
+{
+    assert(id < m_entries.size() && "Index is out of bounds");
+    return m_entries[id].text.getGlobalBounds();
+}
+
+
+////////////////////////////////////////////////////////////
+const Font& TextBatch::getFont() const
+{
+    return *m_font;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int TextBatch::getCharacterSize() const
+{
+    return m_characterSize;
+}
+
+
+////////////////////////////////////////////////////////////
+float TextBatch::getOutlineThickness() const
+{
+    return m_outlineThickness;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextBatch::draw(RenderTarget& target, const RenderStates& states) const
+{
+    ensureGeometryUpdate();
+
+    RenderStates statesCopy(states);
+
+    statesCopy.transform *= getTransform();
+    statesCopy.texture        = &m_font->getTexture(m_characterSize);
+    statesCopy.coordinateType = CoordinateType::Pixels;
+
+    // Distance field glyphs are rendered with the font's shader, unless a custom one is provided;
+    // its settings depend on the boldness, so regular and bold strings are drawn separately
+    const bool useDistanceField = m_font->isDistanceFieldEnabled() && !states.shader;
+
+    const auto drawRange =
+        [&](const VertexArray& vertices, std::size_t begin, std::size_t end, bool bold, float thickness)
+    {
+        if (begin == end)
+            return;
+
+        if (useDistanceField)
+            statesCopy.shader = m_font->getDistanceFieldShader(m_characterSize, bold, thickness);
+
+        target.draw(&vertices[begin], end - begin, vertices.getPrimitiveType(), statesCopy);
+    };
+
+    // Only draw the outline if there is something to draw
+    if (m_outlineThickness != 0)
+    {
+        const std::size_t outlineCount = m_outlineVertices.getVertexCount();
+        if (useDistanceField)
+        {
+            drawRange(m_outlineVertices, 0, m_boldOutlineOffset, false, m_outlineThickness);
+            drawRange(m_outlineVertices, m_boldOutlineOffset, outlineCount, true, m_outlineThickness);
+        }
+        else
+        {
+            drawRange(m_outlineVertices, 0, outlineCount, false, m_outlineThickness);
+        }
+    }
+
+    const std::size_t vertexCount = m_vertices.getVertexCount();
+    if (useDistanceField)
+    {
+        drawRange(m_vertices, 0, m_boldVertexOffset, false, 0);
+        drawRange(m_vertices, m_boldVertexOffset, vertexCount, true, 0);
+    }
+    else
+    {
+        drawRange(m_vertices, 0, vertexCount, false, 0);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+TextBatch::Entry& TextBatch::getEntryForUpdate(std::size_t id)
+{
+    assert(id < m_entries.size() && "Index is out of bounds");
+
+    m_entries[id].needUpdate = true;
+    m_geometryNeedUpdate     = true;
+    return m_entries[id];
+}
+
+
+////////////////////////////////////////////////////////////
+void TextBatch::ensureGeometryUpdate() const
+{
+    // Growing the font texture moves the glyphs, all the strings must be laid out again
+    const std::uint64_t fontTextureId = m_font->getTexture(m_characterSize).m_cacheId;
+    const bool          textureChange = fontTextureId != m_fontTextureId;
+
+    // Do nothing, if no string has changed and the font texture has not changed
+    if (!m_geometryNeedUpdate && !m_geometryNeedRebuild && !textureChange)
+        return;
+
+    m_fontTextureId = fontTextureId;
+
+    // Lay out the changed strings again; if their number of vertices changed, the following strings have to move
+    for (Entry& entry : m_entries)
+    {
+        entry.needUpdate = entry.needUpdate || textureChange || entry.text.m_geometryNeedUpdate;
+        if (!entry.needUpdate)
+            continue;
+
+        entry.text.ensureGeometryUpdate();
+
+        const bool bold = entry.text.getStyle() & Text::Bold;
+        if ((entry.text.m_vertices.getVertexCount() != entry.vertexCount) ||
+            (entry.text.m_outlineVertices.getVertexCount() != entry.outlineCount) || (bold != entry.bold))
+            m_geometryNeedRebuild = true;
+    }
+
+    if (m_geometryNeedRebuild)
+    {
+        // Lay the entries out one after the other, the regular ones first and then the bold ones
+        std::size_t vertexCount  = 0;
+        std::size_t outlineCount = 0;
+        for (const bool bold : {false, true})
+        {
+            if (bold)
+            {
+                m_boldVertexOffset  = vertexCount;
+                m_boldOutlineOffset = outlineCount;
+            }
+
+            for (Entry& entry : m_entries)
+            {
+                if (static_cast<bool>(entry.text.getStyle() & Text::Bold) != bold)
+                    continue;
+
+                entry.bold          = bold;
+                entry.vertexOffset  = vertexCount;
+                entry.vertexCount   = entry.text.m_vertices.getVertexCount();
+                entry.outlineOffset = outlineCount;
+                entry.outlineCount  = entry.text.m_outlineVertices.getVertexCount();
+                entry.needUpdate    = true;
+
+                vertexCount += entry.vertexCount;
+                outlineCount += entry.outlineCount;
+            }
+        }
+
+        m_vertices.resize(vertexCount);
+        m_outlineVertices.resize(outlineCount);
+    }
+
+    // Copy the changed strings' vertices in place
+    for (Entry& entry : m_entries)
+    {
+        if (!entry.needUpdate)
+            continue;
+
+        copyVertices(entry.text.m_vertices, m_vertices, entry.vertexOffset, entry.text.getPosition());
+        copyVertices(entry.text.m_outlineVertices, m_outlineVertices, entry.outlineOffset, entry.text.getPosition());
+        entry.needUpdate = false;
+    }
+
+    m_geometryNeedUpdate  = false;
+    m_geometryNeedRebuild = false;
+}
+
+} // namespace sf
@@ -0,0 +1,357 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/CompressedPacket.hpp>
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <ostream>
+
+#include <cstring>
+
+
+namespace
+{
+// Header byte telling how the data was sent, followed by the decompressed size (4 bytes, big endian) if compressed
+enum class Encoding : std::uint8_t
+{
+    Raw,
+    Lz4
+};
+
+constexpr std::size_t headerSize     = 1;
+constexpr std::size_t sizeFieldSize  = 4;
+constexpr unsigned    hashLog        = 12;         // Size of the compressor's hash table (4096 entries)
+constexpr std::size_t minMatch       = 4;          // Shortest match encoded by LZ4
+constexpr std::size_t lastLiterals   = 5;          // The last bytes of a block are always literals
+constexpr std::size_t matchSafeLimit = 12;         // A match must start at least this far from the end of the block
+constexpr std::size_t maxOffset      = 65'535;     // Farthest match reachable by LZ4's 16 bits offsets
+constexpr std::size_t maxBlockSize   = 0x7E000000; // Largest input accepted by LZ4
+
+
+// Read 4 bytes without alignment requirements
+std::uint32_t read32(const std::byte* data)
+{
+    std::uint32_t value = 0;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+
+// Hash a 4-byte sequence into an index of the hash table
+std::uint32_t hash(std::uint32_t sequence)
+{
+    return (sequence * 2'654'435'761u) >> (32 - hashLog);
+}
+
+
+// Worst case size of LZ4 compressed data (incompressible input)
+std::size_t compressBound(std::size_t size)
+{
+    return size + size / 255 + 16;
+}
+
+
+// Write a length that doesn't fit in the 4 bits of the token, as a sequence of bytes summed up
+std::byte* writeLength(std::byte* output, std::size_t length)
+{
+    for (; length >= 255; length -= 255)
+        *output++ = std::byte{255};
+
+    *output++ = static_cast<std::byte>(length);
+    return output;
+}
+
+
+// Write a sequence: literals copied as is, followed by a match (unless it is the last sequence)
+std::byte* writeSequence(std::byte*       output,
+                         const std::byte* literals,
+                         std::size_t      literalLength,
+                         std::size_t      offset,
+                         std::size_t      matchLength)
+{
+    const std::size_t matchCode = matchLength >= minMatch ? matchLength - minMatch : 0;
+
+    const std::size_t literalCode = std::min<std::size_t>(literalLength, 15);
+    *output++                     = static_cast<std::byte>((literalCode << 4) | std::min<std::size_t>(matchCode, 15));
+
+    if (literalLength >= 15)
+        output = writeLength(output, literalLength - 15);
+
+    std::memcpy(output, literals, literalLength);
+    output += literalLength;
+
+    if (matchLength >= minMatch)
+    {
+        *output++ = static_cast<std::byte>(offset & 0xFF);
+        *output++ = static_cast<std::byte>(offset >> 8);
+
+        if (matchCode >= 15)
+            output = writeLength(output, matchCode - 15);
+    }
+
+    return output;
+}
+
+
+// Compress a block in the LZ4 block format, return the compressed size
+// The output must be at least compressBound(size) bytes long
+std::size_t compress(const std::byte* input, std::size_t size, std::byte* output, std::vector<std::uint32_t>& hashTable)
+{
+    hashTable.assign(std::size_t{1} << hashLog, 0);
+
+    std::byte*  out    = output;
+    std::size_t anchor = 0;
+
+    if (size > matchSafeLimit)
+    {
+        const std::size_t matchStartLimit = size - matchSafeLimit;
+        const std::size_t matchEndLimit   = size - lastLiterals;
+
+        std::size_t position = 0;
+        while (position < matchStartLimit)
+        {
+            const std::uint32_t sequence  = read32(input + position);
+            std::uint32_t&      entry     = hashTable[hash(sequence)];
+            const std::size_t   candidate = entry;
+            entry                         = static_cast<std::uint32_t>(position);
+
+            if ((candidate >= position) || (position - candidate > maxOffset) ||
+                (read32(input + candidate) != sequence))
+            {
+                // Skip faster and faster through data that doesn't compress
+                position += 1 + ((position - anchor) >> 6);
+                continue;
+            }
+
+            std::size_t length = minMatch;
+            while ((position + length < matchEndLimit) && (input[candidate + length] == input[position + length]))
+                ++length;
+
+            out = writeSequence(out, input + anchor, position - anchor, position - candidate, length);
+            position += length;
+            anchor = position;
+        }
+    }
+
+    out = writeSequence(out, input + anchor, size - anchor, 0, 0);
+    return static_cast<std::size_t>(out - output);
+}
+
+
+// Read a length that didn't fit in the 4 bits of the token
+bool readLength(const std::byte* input, std::size_t size, std::size_t& position, std::size_t& length)
+{
+    std::byte byte{};
+    do
+    {
+        if (position >= size)
+            return false;
+
+        byte = input[position++];
+        length += static_cast<std::size_t>(byte);
+    } while (byte == std::byte{255});
+
+    return true;
+}
+
+
+// Decompress a block in the LZ4 block format, checking that it doesn't read or write out of bounds
+bool decompress(const std::byte* input, std::size_t size, std::byte* output, std::size_t outputSize)
+{
+    std::size_t in  = 0;
+    std::size_t out = 0;
+
+    for (;;)
+    {
+        if (in >= size)
+            return false;
+
+        const auto token = static_cast<std::size_t>(input[in++]);
+
+        std::size_t literalLength = token >> 4;
+        if ((literalLength == 15) && !readLength(input, size, in, literalLength))
+            return false;
+
+        if ((literalLength > size - in) || (literalLength > outputSize - out))
+            return false;
+
+        std::memcpy(output + out, input + in, literalLength);
+        in += literalLength;
+        out += literalLength;
+
+        // The last sequence has no match
+        if (in == size)
+            return out == outputSize;
+
+        if (size - in < 2)
+            return false;
+
+        const std::size_t offset = static_cast<std::size_t>(input[in]) | (static_cast<std::size_t>(input[in + 1]) << 8);
+        in += 2;
+        if ((offset == 0) || (offset > out))
+            return false;
+
+        std::size_t matchLength = token & 15;
+        if ((matchLength == 15) && !readLength(input, size, in, matchLength))
+            return false;
+
+        matchLength += minMatch;
+        if (matchLength > outputSize - out)
+            return false;
+
+        // The match may overlap the bytes being written, so copy byte by byte
+        for (std::size_t i = 0; i < matchLength; ++i, ++out)
+            output[out] = output[out - offset];
+    }
+}
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+double CompressedPacket::Statistics::getCompressionRatio() const
+{
+    return sentBytes > 0 ? static_cast<double>(dataBytes) / static_cast<double>(sentBytes) : 1.0;
+}
+
+
+////////////////////////////////////////////////////////////
+void CompressedPacket::setCompressionThreshold(std::size_t size)
+{
+    m_compressionThreshold = size;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t CompressedPacket::getCompressionThreshold() const
+{
+    return m_compressionThreshold;
+}
+
+
+////////////////////////////////////////////////////////////
+const CompressedPacket::Statistics& CompressedPacket::getStatistics() const
+{
+    return m_statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void CompressedPacket::resetStatistics()
+{
+    m_statistics = Statistics();
+}
+
+
+////////////////////////////////////////////////////////////
+const void* CompressedPacket::onSend(std::size_t& size)
+{
+    const auto*       data     = static_cast<const std::byte*>(getData());
+    const std::size_t dataSize = getDataSize();
+
+    ++m_statistics.sentPackets;
+    m_statistics.dataBytes += dataSize;
+
+    // Try to compress the data if it is large enough
+    if ((dataSize >= m_compressionThreshold) && (dataSize > 0) && (dataSize <= maxBlockSize))
+    {
+        const Clock clock;
+
+        m_buffer.resize(headerSize + sizeFieldSize + compressBound(dataSize));
+        const std::size_t compressedSize = compress(data, dataSize, &m_buffer[headerSize + sizeFieldSize], m_hashTable);
+
+        m_statistics.compressionTime += clock.getElapsedTime();
+
+        // Only keep the compressed data if it is actually smaller
+        if (sizeFieldSize + compressedSize < dataSize)
+        {
+            m_buffer[0] = static_cast<std::byte>(Encoding::Lz4);
+            for (std::size_t i = 0; i < sizeFieldSize; ++i)
+                m_buffer[headerSize + i] = static_cast<std::byte>(dataSize >> (8 * (sizeFieldSize - 1 - i)));
+
+            size = headerSize + sizeFieldSize + compressedSize;
+            ++m_statistics.compressedPackets;
+            m_statistics.sentBytes += size;
+            return m_buffer.data();
+        }
+    }
+
+    // Send the data as is
+    m_buffer.resize(headerSize + dataSize);
+    m_buffer[0] = static_cast<std::byte>(Encoding::Raw);
+    if (dataSize > 0)
+        std::memcpy(&m_buffer[headerSize], data, dataSize);
+
+    size = m_buffer.size();
+    m_statistics.sentBytes += size;
+    return m_buffer.data();
+}
+
+
+////////////////////////////////////////////////////////////
+void CompressedPacket::onReceive(const void* data, std::size_t size)
+{
+    const auto* bytes = static_cast<const std::byte*>(data);
+    ++m_statistics.receivedPackets;
+
+    if ((size >= headerSize) && (bytes[0] == static_cast<std::byte>(Encoding::Raw)))
+    {
+        append(bytes + headerSize, size - headerSize);
+        return;
+    }
+
+    if ((size > headerSize + sizeFieldSize) && (bytes[0] == static_cast<std::byte>(Encoding::Lz4)))
+    {
+        const Clock clock;
+
+        std::size_t decompressedSize = 0;
+        for (std::size_t i = 0; i < sizeFieldSize; ++i)
+            decompressedSize = (decompressedSize << 8) | static_cast<std::size_t>(bytes[headerSize + i]);
+
+        // LZ4 can't expand data more than 255 times, don't allocate memory for a bogus size
+        const std::size_t compressedSize = size - headerSize - sizeFieldSize;
+        if (decompressedSize / 255 <= compressedSize)
+        {
+            m_buffer.resize(decompressedSize);
+            if (decompress(bytes + headerSize + sizeFieldSize, compressedSize, m_buffer.data(), decompressedSize))
+            {
+                append(m_buffer.data(), decompressedSize);
+                m_statistics.decompressionTime += clock.getElapsedTime();
+                return;
+            }
+        }
+    }
+
+    err() << "Failed to decompress packet: the received data is corrupted" << std::endl;
+}
+
+} // namespace sf
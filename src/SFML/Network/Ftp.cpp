@@ -27,7 +27,9 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/Ftp.hpp>
 #include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/SocketImpl.hpp>
 
+#include <SFML/System/Clock.hpp>
 #include <SFML/System/Err.hpp>
 
 #include <algorithm>
@@ -35,6 +37,7 @@
 #include <ostream>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 #include <cctype>
 #include <cstddef>
@@ -66,17 +69,24 @@ public:
     Ftp::Response open(Ftp::TransferMode mode);
 
     ////////////////////////////////////////////////////////////
-    void send(std::istream& stream);
+    void send(std::istream& stream, std::uint64_t offset = 0);
 
     ////////////////////////////////////////////////////////////
-    void receive(std::ostream& stream);
+    void send(const std::filesystem::path& file, std::istream& stream, std::uint64_t offset);
+
+    ////////////////////////////////////////////////////////////
+    void receive(std::ostream& stream, std::uint64_t offset = 0);
 
 private:
+    ////////////////////////////////////////////////////////////
+    void finish(std::uint64_t offset, std::uint64_t bytesTransferred);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
     Ftp&      m_ftp;        //!< Reference to the owner Ftp instance
     TcpSocket m_dataSocket; //!< Socket used for data transfers
+    Clock     m_clock;      //!< Clock measuring the duration of the transfer
 };
 
 
@@ -150,6 +160,16 @@ const std::vector<std::string>& Ftp::ListingResponse::getListing() const
 }
 
 
+////////////////////////////////////////////////////////////
+double Ftp::TransferStatistics::getBytesPerSecond() const
+{
+    if (duration <= Time::Zero)
+        return 0.0;
+
+    return static_cast<double>(bytesTransferred) / static_cast<double>(duration.asSeconds());
+}
+
+
 ////////////////////////////////////////////////////////////
 Ftp::~Ftp()
 {
@@ -285,25 +305,41 @@ Ftp::Response Ftp::deleteFile(const std::filesystem::path& name)
 
 
 ////////////////////////////////////////////////////////////
-Ftp::Response Ftp::download(const std::filesystem::path& remoteFile, const std::filesystem::path& localPath, TransferMode mode)
+Ftp::Response Ftp::download(const std::filesystem::path& remoteFile,
+                            const std::filesystem::path& localPath,
+                            TransferMode                 mode,
+                            bool                         resume)
 {
     // Open a data channel using the given transfer mode
     DataChannel data(*this);
     Response    response = data.open(mode);
     if (response.isOk())
     {
+        // When resuming, ask the server to skip the part of the file that we already have
+        const std::filesystem::path filepath = localPath / remoteFile.filename();
+        std::uint64_t               offset   = 0;
+        if (resume)
+        {
+            std::error_code     error;
+            const std::uintmax_t size = std::filesystem::file_size(filepath, error);
+            if (!error && (size > 0) && sendCommand("REST", std::to_string(size)).isOk())
+                offset = size;
+        }
+
         // Tell the server to start the transfer
         response = sendCommand("RETR", remoteFile.string());
         if (response.isOk())
         {
-            // Create the file and truncate it if necessary
-            const std::filesystem::path filepath = localPath / remoteFile.filename();
-            std::ofstream               file(filepath, std::ios_base::binary | std::ios_base::trunc);
+            // Create the file and truncate it if necessary, or append to it when resuming;
+            // the file is unbuffered since data is written in blocks as large as the transfer buffer
+            std::ofstream file;
+            file.rdbuf()->pubsetbuf(nullptr, 0);
+            file.open(filepath, std::ios_base::binary | (offset > 0 ? std::ios_base::app : std::ios_base::trunc));
             if (!file)
                 return Response(Response::Status::InvalidFile);
 
             // Receive the file data
-            data.receive(file);
+            data.receive(file, offset);
 
             // Close the file
             file.close();
@@ -311,8 +347,8 @@ Ftp::Response Ftp::download(const std::filesystem::path& remoteFile, const std::
             // Get the response from the server
             response = getResponse();
 
-            // If the download was unsuccessful, delete the partial file
-            if (!response.isOk())
+            // If the download was unsuccessful, delete the partial file, unless it is meant to be resumed
+            if (!response.isOk() && !resume)
                 std::filesystem::remove(filepath);
         }
     }
@@ -325,7 +361,8 @@ Ftp::Response Ftp::download(const std::filesystem::path& remoteFile, const std::
 Ftp::Response Ftp::upload(const std::filesystem::path& localFile,
                           const std::filesystem::path& remotePath,
                           TransferMode                 mode,
-                          bool                         append)
+                          bool                         append,
+                          bool                         resume)
 {
     // Get the contents of the file to send
     std::ifstream file(localFile, std::ios_base::binary);
@@ -337,12 +374,25 @@ Ftp::Response Ftp::upload(const std::filesystem::path& localFile,
     Response    response = data.open(mode);
     if (response.isOk())
     {
+        // When resuming, ask the server how much of the file it already has and skip that part
+        const std::string remoteFile = (remotePath / localFile.filename()).string();
+        std::uint64_t     offset     = 0;
+        if (resume)
+        {
+            const Response size = sendCommand("SIZE", remoteFile);
+            if (size.isOk())
+                std::istringstream(size.getMessage()) >> offset;
+
+            if ((offset > 0) && !sendCommand("REST", std::to_string(offset)).isOk())
+                offset = 0;
+        }
+
         // Tell the server to start the transfer
-        response = sendCommand(append ? "APPE" : "STOR", (remotePath / localFile.filename()).string());
+        response = sendCommand((append && !resume) ? "APPE" : "STOR", remoteFile);
         if (response.isOk())
         {
             // Send the file data
-            data.send(file);
+            data.send(localFile, file, offset);
 
             // Get the response from the server
             response = getResponse();
@@ -353,6 +403,27 @@ Ftp::Response Ftp::upload(const std::filesystem::path& localFile,
 }
 
 
+////////////////////////////////////////////////////////////
+void Ftp::setTransferBufferSize(std::size_t size)
+{
+    m_transferBufferSize = std::max(size, std::size_t{1});
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Ftp::getTransferBufferSize() const
+{
+    return m_transferBufferSize;
+}
+
+
+////////////////////////////////////////////////////////////
+const Ftp::TransferStatistics& Ftp::getTransferStatistics() const
+{
+    return m_transferStatistics;
+}
+
+
 ////////////////////////////////////////////////////////////
 Ftp::Response Ftp::sendCommand(const std::string& command, const std::string& parameter)
 {
@@ -583,38 +654,47 @@ Ftp::Response Ftp::DataChannel::open(Ftp::TransferMode mode)
 
 
 ////////////////////////////////////////////////////////////
-void Ftp::DataChannel::receive(std::ostream& stream)
+void Ftp::DataChannel::receive(std::ostream& stream, std::uint64_t offset)
 {
+    m_clock.restart();
+
     // Receive data
-    char        buffer[1024];
-    std::size_t received;
-    while (m_dataSocket.receive(buffer, sizeof(buffer), received) == Socket::Status::Done)
+    std::vector<char> buffer(m_ftp.m_transferBufferSize);
+    std::uint64_t     total = 0;
+    std::size_t       received;
+    while (m_dataSocket.receive(buffer.data(), buffer.size(), received) == Socket::Status::Done)
     {
-        stream.write(buffer, static_cast<std::streamsize>(received));
+        stream.write(buffer.data(), static_cast<std::streamsize>(received));
 
         if (!stream.good())
         {
             err() << "FTP Error: Writing to the file has failed" << std::endl;
             break;
         }
+
+        total += received;
     }
 
     // Close the data socket
     m_dataSocket.disconnect();
+    finish(offset, total);
 }
 
 
 ////////////////////////////////////////////////////////////
-void Ftp::DataChannel::send(std::istream& stream)
+void Ftp::DataChannel::send(std::istream& stream, std::uint64_t offset)
 {
+    m_clock.restart();
+
     // Send data
-    char        buffer[1024];
-    std::size_t count;
+    std::vector<char> buffer(m_ftp.m_transferBufferSize);
+    std::uint64_t     total = 0;
+    std::size_t       count;
 
     for (;;)
     {
         // read some data from the stream
-        stream.read(buffer, sizeof(buffer));
+        stream.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
 
         if (!stream.good() && !stream.eof())
         {
@@ -627,8 +707,10 @@ void Ftp::DataChannel::send(std::istream& stream)
         if (count > 0)
         {
             // we could read more data from the stream: send them
-            if (m_dataSocket.send(buffer, count) != Socket::Status::Done)
+            if (m_dataSocket.send(buffer.data(), count) != Socket::Status::Done)
                 break;
+
+            total += count;
         }
         else
         {
@@ -639,6 +721,35 @@ void Ftp::DataChannel::send(std::istream& stream)
 
     // Close the data socket
     m_dataSocket.disconnect();
+    finish(offset, total);
+}
+
+
+////////////////////////////////////////////////////////////
+void Ftp::DataChannel::send(const std::filesystem::path& file, std::istream& stream, std::uint64_t offset)
+{
+    m_clock.restart();
+
+    // Let the system send the file straight from the disk if it can
+    std::uint64_t sent = 0;
+    if (priv::SocketImpl::sendFile(m_dataSocket.getNativeHandle(), file, offset, sent) || (sent > 0))
+    {
+        // Close the data socket
+        m_dataSocket.disconnect();
+        finish(offset, sent);
+        return;
+    }
+
+    // Otherwise read the file through the transfer buffer
+    stream.seekg(static_cast<std::streamoff>(offset));
+    send(stream, offset);
+}
+
+
+////////////////////////////////////////////////////////////
+void Ftp::DataChannel::finish(std::uint64_t offset, std::uint64_t bytesTransferred)
+{
+    m_ftp.m_transferStatistics = {offset, bytesTransferred, m_clock.getElapsedTime()};
 }
 
 } // namespace sf
@@ -39,6 +39,40 @@
 
 #include <cctype>
 #include <cstddef>
+#include <cstdint>
+
+
+namespace
+{
+// Maximum number of idle connections kept alive
+constexpr std::size_t maxIdleConnections = 4;
+
+// Find the end of the header of a response (after the empty line that ends it)
+std::size_t findHeaderEnd(const std::string& data)
+{
+    const std::size_t crlf = data.find("\r\n\r\n");
+    const std::size_t lf   = data.find("\n\n");
+    if (crlf != std::string::npos && (lf == std::string::npos || crlf < lf))
+        return crlf + 4;
+
+    return lf != std::string::npos ? lf + 2 : std::string::npos;
+}
+
+// Size of the blocks received from the connection
+constexpr std::size_t receiveBlockSize = 64 * 1024;
+
+// Receive more data from a connection, directly at the end of a buffer
+bool receiveMore(sf::TcpSocket& connection, std::string& buffer)
+{
+    const std::size_t size     = buffer.size();
+    std::size_t       received = 0;
+    buffer.resize(size + receiveBlockSize);
+    const sf::Socket::Status status = connection.receive(&buffer[size], receiveBlockSize, received);
+    buffer.resize(size + received);
+
+    return status == sf::Socket::Status::Done;
+}
+} // namespace
 
 
 namespace sf
@@ -186,7 +220,7 @@ const std::string& Http::Response::getBody() const
 
 
 ////////////////////////////////////////////////////////////
-void Http::Response::parse(const std::string& data)
+void Http::Response::parseHeader(const std::string& data)
 {
     std::istringstream in(data);
 
@@ -226,42 +260,6 @@ void Http::Response::parse(const std::string& data)
 
     // Parse the other lines, which contain fields, one by one
     parseFields(in);
-
-    m_body.clear();
-
-    // Determine whether the transfer is chunked
-    if (toLower(getField("transfer-encoding")) != "chunked")
-    {
-        // Not chunked - just read everything at once
-        std::copy(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>(), std::back_inserter(m_body));
-    }
-    else
-    {
-        // Chunked - have to read chunk by chunk
-        std::size_t length;
-
-        // Read all chunks, identified by a chunk-size not being 0
-        while (in >> std::hex >> length)
-        {
-            // Drop the rest of the line (chunk-extension)
-            in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-
-            // Copy the actual content data
-            std::istreambuf_iterator<char>       it(in);
-            const std::istreambuf_iterator<char> itEnd;
-            for (std::size_t i = 0; ((i < length) && (it != itEnd)); ++i)
-            {
-                m_body.push_back(*it);
-                ++it; // Iterate in separate expression to work around false positive -Wnull-dereference warning in GCC 12.1.0
-            }
-        }
-
-        // Drop the rest of the line (chunk-extension)
-        in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-
-        // Read all trailers (if present)
-        parseFields(in);
-    }
 }
 
 
@@ -299,6 +297,9 @@ Http::Http(const std::string& host, unsigned short port)
 ////////////////////////////////////////////////////////////
 void Http::setHost(const std::string& host, unsigned short port)
 {
+    // The idle connections are bound to the previous host
+    disconnect();
+
     // Check the protocol
     if (toLower(host.substr(0, 7)) == "http://")
     {
@@ -331,7 +332,127 @@ void Http::setHost(const std::string& host, unsigned short port)
 ////////////////////////////////////////////////////////////
 Http::Response Http::sendRequest(const Http::Request& request, Time timeout)
 {
-    // First make sure that the request is valid -- add missing mandatory fields
+    return sendPipelined({request}, nullptr, timeout).front();
+}
+
+
+////////////////////////////////////////////////////////////
+Http::Response Http::sendRequest(const Request& request, const BodyCallback& callback, Time timeout)
+{
+    return sendPipelined({request}, &callback, timeout).front();
+}
+
+
+////////////////////////////////////////////////////////////
+Http::Response Http::sendRequest(const Request& request, std::ostream& body, Time timeout)
+{
+    const BodyCallback callback = [&body](const Response&, const char* data, std::size_t size)
+    { return static_cast<bool>(body.write(data, static_cast<std::streamsize>(size))); };
+
+    return sendPipelined({request}, &callback, timeout).front();
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<Http::Response> Http::sendRequests(const std::vector<Request>& requests, Time timeout)
+{
+    return sendPipelined(requests, nullptr, timeout);
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<Http::Response> Http::sendPipelined(const std::vector<Request>& requests,
+                                                const BodyCallback*         callback,
+                                                Time                        timeout)
+{
+    std::vector<Response> responses(requests.size());
+
+    // Convert the requests to strings
+    std::vector<std::string> requestStrings;
+    std::vector<bool>        closeRequested;
+    requestStrings.reserve(requests.size());
+    closeRequested.reserve(requests.size());
+    for (const Request& request : requests)
+    {
+        const Request toSend = completeRequest(request);
+        requestStrings.push_back(toSend.prepare());
+
+        // Connections are persistent by default since HTTP/1.1, older versions have to ask for it
+        const auto        it         = toSend.m_fields.find("connection");
+        const std::string connection = it != toSend.m_fields.end() ? toLower(it->second) : "";
+        const bool        isHttp11   = toSend.m_majorVersion * 10 + toSend.m_minorVersion >= 11;
+        closeRequested.push_back(isHttp11 ? (connection == "close") : (connection != "keep-alive"));
+    }
+
+    // Send the requests that haven't been answered yet, until they all are
+    std::size_t next = 0;
+    while (next < requests.size())
+    {
+        TcpSocket connection;
+        bool      reused = false;
+        if (!acquireConnection(connection, reused, timeout))
+            break;
+
+        // Pipeline the requests up to the first one that closes the connection
+        std::size_t end = next;
+        std::string data;
+        while ((end < requests.size()) && ((end == next) || !closeRequested[end - 1]))
+            data += requestStrings[end++];
+
+        if (connection.send(data.data(), data.size()) != Socket::Status::Done)
+        {
+            // A connection kept alive may have been closed by the server in the meantime
+            if (reused)
+                continue;
+
+            break;
+        }
+
+        // Receive the responses, in order
+        const std::size_t first    = next;
+        std::string       buffer;
+        bool              reusable = true;
+        while ((next < end) && reusable)
+        {
+            const bool isHead = requests[next].m_method == Request::Method::Head;
+            reusable          = receiveResponse(connection, buffer, isHead, callback, responses[next]);
+            if (responses[next].getStatus() == Response::Status::ConnectionFailed)
+                break;
+
+            ++next;
+        }
+
+        if (next == first)
+        {
+            // Nothing received: retry with a new connection if this one was kept alive from a previous
+            // request (the server may have closed it in the meantime), otherwise the server failed to answer
+            if (reused)
+                continue;
+
+            responses[next].m_status = Response::Status::InvalidResponse;
+            break;
+        }
+
+        if (reusable && (next == end) && !closeRequested[end - 1] && buffer.empty())
+            releaseConnection(std::move(connection));
+    }
+
+    return responses;
+}
+
+
+////////////////////////////////////////////////////////////
+void Http::disconnect()
+{
+    const std::lock_guard lock(m_mutex);
+    m_connections.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+Http::Request Http::completeRequest(const Request& request) const
+{
+    // Make sure that the request is valid -- add missing mandatory fields
     Request toSend(request);
     if (!toSend.hasField("From"))
     {
@@ -355,44 +476,180 @@ Http::Response Http::sendRequest(const Http::Request& request, Time timeout)
     {
         toSend.setField("Content-Type", "application/x-www-form-urlencoded");
     }
-    if ((toSend.m_majorVersion * 10 + toSend.m_minorVersion >= 11) && !toSend.hasField("Connection"))
+
+    return toSend;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Http::acquireConnection(TcpSocket& connection, bool& reused, Time timeout)
+{
+    // Reuse an idle connection if there's one
+    {
+        const std::lock_guard lock(m_mutex);
+        if (!m_connections.empty())
+        {
+            connection = std::move(m_connections.back());
+            m_connections.pop_back();
+            reused = true;
+            return true;
+        }
+    }
+
+    reused = false;
+    return m_host && (connection.connect(*m_host, m_port, timeout) == Socket::Status::Done);
+}
+
+
+////////////////////////////////////////////////////////////
+void Http::releaseConnection(TcpSocket&& connection)
+{
+    const std::lock_guard lock(m_mutex);
+    if (m_connections.size() < maxIdleConnections)
+        m_connections.push_back(std::move(connection));
+}
+
+
+////////////////////////////////////////////////////////////
+bool Http::receiveResponse(TcpSocket&          connection,
+                           std::string&        buffer,
+                           bool                isHead,
+                           const BodyCallback* callback,
+                           Response&           response)
+{
+    // Position of the first byte of the buffer not consumed yet
+    std::size_t position = 0;
+
+    // Receive more data, dropping what was already consumed so that the buffer doesn't grow with the body
+    const auto receive = [&]()
+    {
+        buffer.erase(0, position);
+        position = 0;
+        return receiveMore(connection, buffer);
+    };
+
+    // Receive the header, up to the empty line that ends it
+    std::size_t headerEnd = 0;
+    while ((headerEnd = findHeaderEnd(buffer)) == std::string::npos)
+    {
+        if (!receive())
+        {
+            // Parse whatever was received, to keep the status of truncated responses
+            if (!buffer.empty())
+                response.parseHeader(buffer);
+
+            return false;
+        }
+    }
+
+    response.parseHeader(buffer.substr(0, headerEnd));
+    position = headerEnd;
+    if (response.getStatus() == Response::Status::InvalidResponse)
+        return false;
+
+    // HTTP/1.0 connections are closed after the response unless asked otherwise
+    const std::string connectionField = toLower(response.getField("connection"));
+    const bool        persistent      = (response.m_majorVersion * 10 + response.m_minorVersion >= 11)
+                                            ? (connectionField != "close")
+                                            : (connectionField == "keep-alive");
+
+    // Some responses never have a body
+    const auto status = static_cast<int>(response.getStatus());
+    if (isHead || ((status >= 100) && (status < 200)) || (status == 204) || (status == 304))
     {
-        toSend.setField("Connection", "close");
+        buffer.erase(0, position);
+        return persistent;
     }
 
-    // Prepare the response
-    Response received;
+    // Hand the body over as it arrives, either to the callback or to the response
+    bool       aborted = false;
+    const auto deliver = [&](std::size_t size)
+    {
+        if (!callback)
+            response.m_body.append(buffer, position, size);
+        else if (!aborted && (size > 0))
+            aborted = !(*callback)(response, buffer.data() + position, size);
+
+        position += size;
+        return !aborted;
+    };
 
-    // Connect the socket to the host
-    if (m_connection.connect(m_host.value(), m_port, timeout) == Socket::Status::Done)
+    // Deliver the given number of bytes of the body
+    const auto receiveBody = [&](std::uint64_t length)
     {
-        // Convert the request to string and send it through the connected socket
-        const std::string requestStr = toSend.prepare();
+        while (length > 0)
+        {
+            if ((position == buffer.size()) && !receive())
+                return false;
+
+            const auto size = static_cast<std::size_t>(std::min<std::uint64_t>(length, buffer.size() - position));
+            length -= size;
+            if (!deliver(size))
+                return false;
+        }
+        return true;
+    };
+
+    // Extract the next line from the buffer
+    const auto receiveLine = [&](std::string& line)
+    {
+        std::size_t lineEnd = 0;
+        while ((lineEnd = buffer.find('\n', position)) == std::string::npos)
+        {
+            if (!receive())
+                return false;
+        }
+
+        line     = buffer.substr(position, lineEnd - position);
+        position = lineEnd + 1;
+        if (!line.empty() && (line.back() == '\r'))
+            line.pop_back();
+        return true;
+    };
 
-        if (!requestStr.empty())
+    bool complete = true;
+    if (toLower(response.getField("transfer-encoding")) == "chunked")
+    {
+        // Chunked - decode the chunks as they arrive, until the chunk-size is 0
+        std::string line;
+        while ((complete = receiveLine(line)))
         {
-            // Send it through the socket
-            if (m_connection.send(requestStr.c_str(), requestStr.size()) == Socket::Status::Done)
-            {
-                // Wait for the server's response
-                std::string receivedStr;
-                std::size_t size = 0;
-                char        buffer[1024];
-                while (m_connection.receive(buffer, sizeof(buffer), size) == Socket::Status::Done)
-                {
-                    receivedStr.append(buffer, buffer + size);
-                }
-
-                // Build the Response object from the received data
-                received.parse(receivedStr);
-            }
+            std::uint64_t length = 0;
+            std::istringstream(line) >> std::hex >> length;
+            if (length == 0)
+                break;
+
+            // Deliver the actual content data, then skip the \r\n that follows it
+            if (!(complete = receiveBody(length) && receiveLine(line)))
+                break;
         }
 
-        // Close the connection
-        m_connection.disconnect();
+        // Read all trailers (if present), up to the empty line that ends them
+        std::ostringstream trailers;
+        while (complete && (complete = receiveLine(line)) && !line.empty())
+            trailers << line << "\r\n";
+
+        std::istringstream in(trailers.str());
+        response.parseFields(in);
+    }
+    else if (const std::string& contentLength = response.getField("content-length"); !contentLength.empty())
+    {
+        // The body has a known length
+        std::uint64_t length = 0;
+        std::istringstream(contentLength) >> length;
+        complete = receiveBody(length);
+    }
+    else
+    {
+        // The body ends when the server closes the connection
+        while (deliver(buffer.size() - position) && receive())
+            ;
+
+        complete = false;
     }
 
-    return received;
+    buffer.erase(0, std::min(position, buffer.size()));
+    return complete && persistent;
 }
 
 } // namespace sf
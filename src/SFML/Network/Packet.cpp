@@ -35,6 +35,64 @@
 #include <cwchar>
 
 
+namespace
+{
+// Reverse the order of the bytes of an integer
+std::uint16_t byteSwap(std::uint16_t value)
+{
+    return static_cast<std::uint16_t>((value << 8) | (value >> 8));
+}
+
+std::uint32_t byteSwap(std::uint32_t value)
+{
+    return ((value & 0x000000FF) << 24) | ((value & 0x0000FF00) << 8) | ((value & 0x00FF0000) >> 8) |
+           ((value & 0xFF000000) >> 24);
+}
+
+std::uint64_t byteSwap(std::uint64_t value)
+{
+    return (std::uint64_t{byteSwap(static_cast<std::uint32_t>(value))} << 32) |
+           byteSwap(static_cast<std::uint32_t>(value >> 32));
+}
+
+// Reverse the bytes of each integer of an array, in a simple loop that compilers can vectorize
+template <typename T>
+void byteSwapArray(std::byte* data, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        T value;
+        std::memcpy(&value, data + i * sizeof(T), sizeof(T));
+        value = byteSwap(value);
+        std::memcpy(data + i * sizeof(T), &value, sizeof(T));
+    }
+}
+
+// Convert an array of integers between host and network byte order (big endian)
+void convertByteOrder(std::byte* data, std::size_t count, std::size_t elementSize)
+{
+    // Nothing to do on big endian systems
+    if (htons(1) == 1)
+        return;
+
+    switch (elementSize)
+    {
+        case 2:
+            byteSwapArray<std::uint16_t>(data, count);
+            break;
+        case 4:
+            byteSwapArray<std::uint32_t>(data, count);
+            break;
+        case 8:
+            byteSwapArray<std::uint64_t>(data, count);
+            break;
+        default:
+            break;
+    }
+}
+} // namespace
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
@@ -65,6 +123,13 @@ void Packet::clear()
 }
 
 
+////////////////////////////////////////////////////////////
+void Packet::reserve(std::size_t capacity)
+{
+    m_data.reserve(capacity);
+}
+
+
 ////////////////////////////////////////////////////////////
 const void* Packet::getData() const
 {
@@ -557,6 +622,67 @@ Packet& Packet::operator<<(const String& data)
 }
 
 
+////////////////////////////////////////////////////////////
+Packet& Packet::writeVarUint(std::uint64_t data)
+{
+    // 7 bits per byte, the highest bit tells whether more bytes follow
+    std::uint8_t toWrite[10];
+    std::size_t  size = 0;
+    while (data >= 0x80)
+    {
+        toWrite[size++] = static_cast<std::uint8_t>(data | 0x80);
+        data >>= 7;
+    }
+    toWrite[size++] = static_cast<std::uint8_t>(data);
+
+    append(toWrite, size);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeVarInt(std::int64_t data)
+{
+    // Zig-zag encoding: the sign is moved to the lowest bit
+    return writeVarUint((static_cast<std::uint64_t>(data) << 1) ^ static_cast<std::uint64_t>(data >> 63));
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readVarUint(std::uint64_t& data)
+{
+    std::uint64_t value    = 0;
+    std::size_t   position = m_readPos;
+    for (unsigned int shift = 0;; shift += 7)
+    {
+        // The 10th byte can only hold the highest bit of a 64 bits value
+        m_isValid = m_isValid && (position < m_data.size()) && (shift < 63 || m_data[position] <= std::byte{1});
+        if (!m_isValid)
+            return *this;
+
+        const auto byte = static_cast<std::uint8_t>(m_data[position++]);
+        value |= std::uint64_t{byte & 0x7Fu} << shift;
+        if ((byte & 0x80) == 0)
+            break;
+    }
+
+    data      = value;
+    m_readPos = position;
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readVarInt(std::int64_t& data)
+{
+    std::uint64_t value = 0;
+    if (readVarUint(value))
+        data = static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+
+    return *this;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Packet::checkSize(std::size_t size)
 {
@@ -566,6 +692,34 @@ bool Packet::checkSize(std::size_t size)
 }
 
 
+////////////////////////////////////////////////////////////
+void Packet::appendArray(const void* data, std::size_t count, std::size_t elementSize, bool isInteger)
+{
+    const std::size_t offset = m_data.size();
+    append(data, count * elementSize);
+
+    if (isInteger && (count > 0))
+        convertByteOrder(&m_data[offset], count, elementSize);
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::extractArray(void* data, std::size_t count, std::size_t elementSize, bool isInteger)
+{
+    // Check the number of elements first, the size in bytes could overflow
+    m_isValid = m_isValid && (count <= (m_data.size() - m_readPos) / elementSize);
+
+    if (m_isValid && (count > 0))
+    {
+        std::memcpy(data, &m_data[m_readPos], count * elementSize);
+        if (isInteger)
+            convertByteOrder(static_cast<std::byte*>(data), count, elementSize);
+
+        m_readPos += count * elementSize;
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 const void* Packet::onSend(std::size_t& size)
 {
@@ -0,0 +1,254 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Resolver.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+
+namespace
+{
+// Number of addresses added to the cache between two removals of the expired ones
+constexpr std::size_t purgeInterval = 64;
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct Resolver::Impl
+{
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+    struct CacheEntry
+    {
+        IpAddress address;    //!< Resolved address
+        TimePoint expiration; //!< Time at which the address must be resolved again
+    };
+
+    explicit Impl(Lookup theLookup, Time theTimeToLive) : lookup(std::move(theLookup)), timeToLive(theTimeToLive)
+    {
+    }
+
+    void work();
+
+    Lookup                                                 lookup;       //!< Function resolving a host name
+    Time                                                   timeToLive;   //!< Duration during which an address is cached
+    mutable std::mutex                                     mutex;        //!< Protects everything below
+    std::condition_variable                                condition;    //!< Wakes the threads up when a host name is queued
+    std::unordered_map<std::string, CacheEntry>            cache;        //!< Resolved addresses
+    std::unordered_map<std::string, std::vector<Callback>> pending;      //!< Callbacks waiting for each host name being resolved
+    std::deque<std::string>                                queue;        //!< Host names waiting for a thread
+    std::size_t                                            insertions{}; //!< Addresses cached since the last purge
+    bool                                                   stopping{};   //!< Are the threads asked to stop?
+    std::vector<std::thread>                               threads;      //!< Threads performing the lookups
+};
+
+
+////////////////////////////////////////////////////////////
+void Resolver::Impl::work()
+{
+    std::unique_lock lock(mutex);
+
+    for (;;)
+    {
+        condition.wait(lock, [this] { return stopping || !queue.empty(); });
+        if (stopping)
+            return;
+
+        const std::string hostName = std::move(queue.front());
+        queue.pop_front();
+
+        // The lookup may block for a long time, don't hold the lock meanwhile
+        lock.unlock();
+        const std::optional<IpAddress> address = lookup(hostName);
+        lock.lock();
+
+        if (address)
+        {
+            const TimePoint now = std::chrono::steady_clock::now();
+            cache.insert_or_assign(hostName, CacheEntry{*address, now + timeToLive.toDuration()});
+
+            // Expired addresses are otherwise only removed when they are requested again
+            if (++insertions >= purgeInterval)
+            {
+                for (auto it = cache.begin(); it != cache.end();)
+                    it = (it->second.expiration <= now) ? cache.erase(it) : std::next(it);
+
+                insertions = 0;
+            }
+        }
+
+        std::vector<Callback> callbacks;
+        callbacks.swap(pending[hostName]);
+        pending.erase(hostName);
+
+        lock.unlock();
+        for (const Callback& callback : callbacks)
+            callback(address);
+        lock.lock();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+Resolver::Resolver(std::size_t threadCount, Time timeToLive) :
+Resolver([](const std::string& hostName) { return IpAddress::resolve(hostName); }, threadCount, timeToLive)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+Resolver::Resolver(Lookup lookup, std::size_t threadCount, Time timeToLive) :
+m_impl(std::make_unique<Impl>(std::move(lookup), timeToLive))
+{
+    for (std::size_t i = 0; i < std::max(threadCount, std::size_t{1}); ++i)
+        m_impl->threads.emplace_back([this] { m_impl->work(); });
+}
+
+
+////////////////////////////////////////////////////////////
+Resolver::~Resolver()
+{
+    // Abandon the host names that no thread has started resolving
+    std::vector<Callback> abandoned;
+    {
+        const std::lock_guard lock(m_impl->mutex);
+        m_impl->stopping = true;
+
+        for (const std::string& hostName : m_impl->queue)
+        {
+            std::vector<Callback>& callbacks = m_impl->pending[hostName];
+            std::move(callbacks.begin(), callbacks.end(), std::back_inserter(abandoned));
+        }
+        m_impl->queue.clear();
+    }
+    m_impl->condition.notify_all();
+
+    for (const Callback& callback : abandoned)
+        callback(std::nullopt);
+
+    for (std::thread& thread : m_impl->threads)
+        thread.join();
+}
+
+
+////////////////////////////////////////////////////////////
+std::future<std::optional<IpAddress>> Resolver::resolve(std::string_view hostName)
+{
+    auto promise = std::make_shared<std::promise<std::optional<IpAddress>>>();
+    auto future  = promise->get_future();
+
+    resolve(hostName, [promise](std::optional<IpAddress> address) { promise->set_value(address); });
+
+    return future;
+}
+
+
+////////////////////////////////////////////////////////////
+void Resolver::resolve(std::string_view hostName, Callback callback)
+{
+    std::optional<IpAddress> address;
+    {
+        const std::lock_guard lock(m_impl->mutex);
+
+        std::string name(hostName);
+        if (const auto it = m_impl->cache.find(name); it != m_impl->cache.end())
+        {
+            if (it->second.expiration > std::chrono::steady_clock::now())
+                address = it->second.address;
+            else
+                m_impl->cache.erase(it);
+        }
+
+        if (!address)
+        {
+            // Queue the host name, unless it is already being resolved for another request
+            auto [it, inserted] = m_impl->pending.try_emplace(name);
+            it->second.push_back(std::move(callback));
+
+            if (inserted)
+            {
+                m_impl->queue.push_back(std::move(name));
+                m_impl->condition.notify_one();
+            }
+            return;
+        }
+    }
+
+    callback(address);
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<IpAddress> Resolver::getCachedAddress(std::string_view hostName) const
+{
+    const std::lock_guard lock(m_impl->mutex);
+
+    const auto it = m_impl->cache.find(std::string(hostName));
+    if ((it == m_impl->cache.end()) || (it->second.expiration <= std::chrono::steady_clock::now()))
+        return std::nullopt;
+
+    return it->second.address;
+}
+
+
+////////////////////////////////////////////////////////////
+void Resolver::setTimeToLive(Time timeToLive)
+{
+    const std::lock_guard lock(m_impl->mutex);
+    m_impl->timeToLive = timeToLive;
+}
+
+
+////////////////////////////////////////////////////////////
+Time Resolver::getTimeToLive() const
+{
+    const std::lock_guard lock(m_impl->mutex);
+    return m_impl->timeToLive;
+}
+
+
+////////////////////////////////////////////////////////////
+void Resolver::clearCache()
+{
+    const std::lock_guard lock(m_impl->mutex);
+    m_impl->cache.clear();
+    m_impl->insertions = 0;
+}
+
+} // namespace sf
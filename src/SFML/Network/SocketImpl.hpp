@@ -43,6 +43,7 @@
 #include <netdb.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
+#include <poll.h>
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -51,6 +52,8 @@
 
 #endif
 
+#include <filesystem>
+
 #include <cstdint>
 
 
@@ -68,13 +71,27 @@ public:
     // Types
     ////////////////////////////////////////////////////////////
 #if defined(SFML_SYSTEM_WINDOWS)
-    using AddrLength = int;
-    using Size       = int;
+    using AddrLength     = int;
+    using Size           = int;
+    using PollDescriptor = WSAPOLLFD;
 #else
-    using AddrLength = socklen_t;
-    using Size       = std::size_t;
+    using AddrLength     = socklen_t;
+    using Size           = std::size_t;
+    using PollDescriptor = pollfd;
 #endif
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Block of data sent by sendBuffers
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Buffer
+    {
+        const void* data{}; //!< Pointer to the bytes to send
+        std::size_t size{}; //!< Number of bytes to send
+    };
+
+    static constexpr std::size_t maxBuffers{64}; //!< Maximum number of blocks sent by a single call to sendBuffers
+
     ////////////////////////////////////////////////////////////
     /// \brief Create an internal sockaddr_in address
     ///
@@ -118,6 +135,58 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     static Socket::Status getErrorStatus();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until some sockets are ready
+    ///
+    /// Unlike select(), this is not limited in the number or
+    /// the values of the socket handles.
+    ///
+    /// \param descriptors Sockets to wait for, and the events to wait for on each
+    /// \param count       Number of elements in \a descriptors
+    /// \param timeout     Maximum time to wait in milliseconds, or -1 to wait indefinitely
+    ///
+    /// \return Number of ready sockets, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    static int poll(PollDescriptor* descriptors, std::size_t count, int timeout);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several blocks of data with a single system call
+    ///
+    /// The blocks are sent one after the other, as if they
+    /// were contiguous. Only the first maxBuffers blocks are
+    /// sent.
+    ///
+    /// \param sock    Handle of the socket
+    /// \param buffers Blocks of data to send
+    /// \param count   Number of elements in \a buffers
+    ///
+    /// \return Number of bytes sent, or -1 on error (see getErrorStatus)
+    ///
+    ////////////////////////////////////////////////////////////
+    static std::int64_t sendBuffers(SocketHandle sock, const Buffer* buffers, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send the contents of a file through a connected socket
+    ///
+    /// The data is sent by the system straight from the file,
+    /// without being copied through user space. On systems
+    /// that don't support it, this function does nothing and
+    /// returns false.
+    ///
+    /// \param sock   Handle of the socket (must be blocking)
+    /// \param path   Path of the file to send
+    /// \param offset Position in the file to start sending from
+    /// \param sent   Filled with the number of bytes sent
+    ///
+    /// \return True if the end of the file was sent
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool sendFile(SocketHandle                 sock,
+                         const std::filesystem::path& path,
+                         std::uint64_t                offset,
+                         std::uint64_t&               sent);
 };
 
 } // namespace sf::priv
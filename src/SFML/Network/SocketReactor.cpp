@@ -0,0 +1,472 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/SocketImpl.hpp>
+#include <SFML/Network/SocketReactor.hpp>
+#include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct SocketReactor::Impl
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Operation waiting for a socket to be ready
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Operation
+    {
+        std::function<Socket::Status()>     attempt;  //!< Try to perform the operation, NotReady or Partial means wait
+        std::function<void(Socket::Status)> complete; //!< Call the handler of the operation with its final status
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pending operations of a socket
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        std::deque<Operation> reads;  //!< Operations waiting for the socket to be readable, in order
+        std::deque<Operation> writes; //!< Operations waiting for the socket to be writable, in order
+    };
+
+    ////////////////////////////////////////////////////////////
+    Impl()
+    {
+        // Other threads interrupt the wait by sending a datagram to this socket
+        if (wakeUpSocket.bind(Socket::AnyPort, IpAddress::LocalHost) != Socket::Status::Done)
+            err() << "Failed to create the wake-up socket of the socket reactor" << std::endl;
+
+        wakeUpSocket.setBlocking(false);
+    }
+
+    ////////////////////////////////////////////////////////////
+    void add(Socket& socket, bool write, Operation operation)
+    {
+        socket.setBlocking(false);
+
+        const std::lock_guard lock(mutex);
+        Entry&                entry = entries[&socket];
+        (write ? entry.writes : entry.reads).push_back(std::move(operation));
+        ++outstanding;
+        wakeUp();
+    }
+
+    ////////////////////////////////////////////////////////////
+    void post(std::function<void()> function)
+    {
+        const std::lock_guard lock(mutex);
+        ready.push_back(std::move(function));
+        ++outstanding;
+        wakeUp();
+    }
+
+    ////////////////////////////////////////////////////////////
+    void wakeUp()
+    {
+        // The mutex must be locked; only a thread waiting for the sockets needs to be interrupted
+        if (!polling)
+            return;
+
+        const char byte = 0;
+        (void)wakeUpSocket.send(&byte, sizeof(byte), IpAddress::LocalHost, wakeUpSocket.getLocalPort());
+    }
+
+    ////////////////////////////////////////////////////////////
+    bool callReadyHandler()
+    {
+        std::function<void()> handler;
+        {
+            const std::lock_guard lock(mutex);
+            if (ready.empty())
+                return false;
+
+            handler = std::move(ready.front());
+            ready.pop_front();
+        }
+
+        if (handler)
+            handler();
+
+        // Let the threads waiting for the sockets return if there's nothing left to do
+        const std::lock_guard lock(mutex);
+        if (--outstanding == 0)
+            wakeUp();
+
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void attempt(std::deque<Operation>& operations)
+    {
+        // Only the first operation is attempted, so that operations are performed in order
+        if (operations.empty())
+            return;
+
+        const Socket::Status status = operations.front().attempt();
+        if ((status == Socket::Status::NotReady) || (status == Socket::Status::Partial))
+            return;
+
+        ready.emplace_back([complete = std::move(operations.front().complete), status]
+                           { complete(status); });
+        operations.pop_front();
+    }
+
+    ////////////////////////////////////////////////////////////
+    bool waitForSockets(bool wait, std::uint64_t stopCount)
+    {
+        // A single thread waits for the sockets at a time, the others call the handlers
+        std::unique_lock pollLock(pollMutex, std::defer_lock);
+        if (wait)
+            pollLock.lock();
+        else if (!pollLock.try_lock())
+            return true;
+
+        {
+            const std::lock_guard lock(mutex);
+            if ((outstanding == 0) || (stops != stopCount))
+                return false;
+
+            if (wait && !ready.empty())
+                return true;
+
+            descriptors.resize(1);
+            descriptors[0].fd     = wakeUpSocket.getNativeHandle();
+            descriptors[0].events = POLLIN;
+            sockets.clear();
+            for (const auto& [socket, entry] : entries)
+            {
+                const int read  = entry.reads.empty() ? 0 : POLLIN;
+                const int write = entry.writes.empty() ? 0 : POLLOUT;
+
+                priv::SocketImpl::PollDescriptor& descriptor = descriptors.emplace_back();
+                descriptor.fd                                = socket->getNativeHandle();
+                descriptor.events                            = static_cast<short>(read | write);
+                sockets.push_back(socket);
+            }
+
+            polling = true;
+        }
+
+        for (priv::SocketImpl::PollDescriptor& descriptor : descriptors)
+            descriptor.revents = 0;
+
+        if (priv::SocketImpl::poll(descriptors.data(), descriptors.size(), wait ? -1 : 0) < 0)
+            err() << "Failed to wait for the sockets of the socket reactor" << std::endl;
+
+        const std::lock_guard lock(mutex);
+        polling = false;
+
+        // Discard the wake-up datagrams
+        if (descriptors[0].revents != 0)
+        {
+            char                     buffer[16];
+            std::size_t              received = 0;
+            std::optional<IpAddress> address;
+            unsigned short           port = 0;
+            while (wakeUpSocket.receive(buffer, sizeof(buffer), received, address, port) == Socket::Status::Done)
+                ;
+        }
+
+        // Perform the operations of the ready sockets; errors and hang-ups are reported by the operations themselves
+        for (std::size_t i = 1; i < descriptors.size(); ++i)
+        {
+            const auto events = descriptors[i].revents;
+            const auto it     = entries.find(sockets[i - 1]);
+            if ((events == 0) || (it == entries.end()))
+                continue;
+
+            if (events & (POLLIN | POLLERR | POLLHUP | POLLNVAL))
+                attempt(it->second.reads);
+
+            if (events & (POLLOUT | POLLERR | POLLHUP | POLLNVAL))
+                attempt(it->second.writes);
+
+            if (it->second.reads.empty() && it->second.writes.empty())
+                entries.erase(it);
+        }
+
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::mutex                                    mutex;         //!< Mutex protecting the state of the reactor
+    std::unordered_map<Socket*, Entry>            entries;       //!< Pending operations of each socket
+    std::deque<std::function<void()>>             ready;         //!< Handlers ready to be called
+    std::size_t                                   outstanding{}; //!< Number of pending operations and handlers to call
+    std::uint64_t                                 stops{};       //!< Number of calls to stop
+    bool                                          polling{};     //!< Is a thread waiting for the sockets?
+    UdpSocket                                     wakeUpSocket;  //!< Socket used to interrupt the wait
+    std::mutex                                    pollMutex;     //!< Mutex allowing a single thread to wait at a time
+    std::vector<priv::SocketImpl::PollDescriptor> descriptors;   //!< Sockets to wait for, the first one is wakeUpSocket
+    std::vector<Socket*>                          sockets;       //!< Sockets matching the other descriptors
+};
+
+
+////////////////////////////////////////////////////////////
+SocketReactor::SocketReactor() : m_impl(std::make_unique<Impl>())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+SocketReactor::~SocketReactor() = default;
+
+
+////////////////////////////////////////////////////////////
+void SocketReactor::asyncAccept(TcpListener& listener, AcceptHandler handler)
+{
+    auto socket = std::make_shared<TcpSocket>();
+    m_impl->add(listener,
+                false,
+                {[&listener, socket] { return listener.accept(*socket); },
+                 [handler = std::move(handler), socket](Socket::Status status)
+                 { handler(status, std::move(*socket)); }});
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketReactor::asyncConnect(TcpSocket& socket, IpAddress remoteAddress, unsigned short remotePort, Handler handler)
+{
+    // Start connecting right away; a non-blocking connection completes when the socket becomes writable
+    socket.setBlocking(false);
+    const Socket::Status status = socket.connect(remoteAddress, remotePort);
+    if (status != Socket::Status::NotReady)
+    {
+        post([handler = std::move(handler), status] { handler(status); });
+        return;
+    }
+
+    // Once the connection request has returned, the address of the peer tells whether it was accepted
+    m_impl->add(socket,
+                true,
+                {[&socket]
+                 { return socket.getRemoteAddress().has_value() ? Socket::Status::Done : Socket::Status::Error; },
+                 std::move(handler)});
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketReactor::asyncSend(TcpSocket& socket, const void* data, std::size_t size, Handler handler)
+{
+    const auto* bytes  = static_cast<const std::byte*>(data);
+    auto        buffer = std::make_shared<std::vector<std::byte>>(bytes, bytes + size);
+    auto        offset = std::make_shared<std::size_t>(0);
+    m_impl->add(socket,
+                true,
+                {[&socket, buffer, offset]
+                 {
+                     std::size_t          sent      = 0;
+                     const std::size_t    remaining = buffer->size() - *offset;
+                     const Socket::Status status    = socket.send(buffer->data() + *offset, remaining, sent);
+                     *offset += sent;
+                     return status;
+                 },
+                 [handler = std::move(handler)](Socket::Status status)
+                 {
+                     if (handler)
+                         handler(status);
+                 }});
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketReactor::asyncSend(TcpSocket& socket, Packet packet, Handler handler)
+{
+    // The packet keeps track of the data already sent by itself
+    auto copy = std::make_shared<Packet>(std::move(packet));
+    m_impl->add(socket,
+                true,
+                {[&socket, copy] { return socket.send(*copy); },
+                 [handler = std::move(handler)](Socket::Status status)
+                 {
+                     if (handler)
+                         handler(status);
+                 }});
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketReactor::asyncReceive(TcpSocket& socket, void* data, std::size_t size, ReceiveHandler handler)
+{
+    auto received = std::make_shared<std::size_t>(0);
+    m_impl->add(socket,
+                false,
+                {[&socket, data, size, received] { return socket.receive(data, size, *received); },
+                 [handler = std::move(handler), received](Socket::Status status) { handler(status, *received); }});
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketReactor::asyncReceive(TcpSocket& socket, Packet& packet, Handler handler)
+{
+    // The socket keeps the partially received packet by itself
+    m_impl->add(socket, false, {[&socket, &packet] { return socket.receive(packet); }, std::move(handler)});
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketReactor::asyncSend(UdpSocket&     socket,
+                              const void*    data,
+                              std::size_t    size,
+                              IpAddress      remoteAddress,
+                              unsigned short remotePort,
+                              Handler        handler)
+{
+    // The socket must have a handle to be waited for, unbound UDP sockets get one on their first send
+    socket.create();
+
+    const auto* bytes  = static_cast<const std::byte*>(data);
+    auto        buffer = std::make_shared<std::vector<std::byte>>(bytes, bytes + size);
+    m_impl->add(socket,
+                true,
+                {[&socket, buffer, remoteAddress, remotePort]
+                 { return socket.send(buffer->data(), buffer->size(), remoteAddress, remotePort); },
+                 [handler = std::move(handler)](Socket::Status status)
+                 {
+                     if (handler)
+                         handler(status);
+                 }});
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketReactor::asyncReceive(UdpSocket& socket, void* data, std::size_t size, DatagramHandler handler)
+{
+    struct Datagram
+    {
+        std::size_t              received{};
+        std::optional<IpAddress> remoteAddress;
+        unsigned short           remotePort{};
+    };
+
+    auto datagram = std::make_shared<Datagram>();
+    m_impl->add(socket,
+                false,
+                {[&socket, data, size, datagram]
+                 {
+                     auto& [received, remoteAddress, remotePort] = *datagram;
+                     return socket.receive(data, size, received, remoteAddress, remotePort);
+                 },
+                 [handler = std::move(handler), datagram](Socket::Status status)
+                 { handler(status, datagram->received, datagram->remoteAddress, datagram->remotePort); }});
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketReactor::cancel(Socket& socket)
+{
+    const std::lock_guard lock(m_impl->mutex);
+    const auto            it = m_impl->entries.find(&socket);
+    if (it == m_impl->entries.end())
+        return;
+
+    m_impl->outstanding -= it->second.reads.size() + it->second.writes.size();
+    m_impl->entries.erase(it);
+    m_impl->wakeUp();
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketReactor::post(std::function<void()> function)
+{
+    m_impl->post(std::move(function));
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SocketReactor::run()
+{
+    std::uint64_t stopCount = 0;
+    {
+        const std::lock_guard lock(m_impl->mutex);
+        stopCount = m_impl->stops;
+    }
+
+    // Call the ready handlers, and wait for the sockets when there are none
+    std::size_t count = 0;
+    for (;;)
+    {
+        if (m_impl->callReadyHandler())
+            ++count;
+        else if (!m_impl->waitForSockets(true, stopCount))
+            break;
+
+        const std::lock_guard lock(m_impl->mutex);
+        if (m_impl->stops != stopCount)
+            break;
+    }
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SocketReactor::poll()
+{
+    std::uint64_t stopCount = 0;
+    {
+        const std::lock_guard lock(m_impl->mutex);
+        stopCount = m_impl->stops;
+    }
+
+    (void)m_impl->waitForSockets(false, stopCount);
+
+    std::size_t count = 0;
+    while (m_impl->callReadyHandler())
+        ++count;
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketReactor::stop()
+{
+    const std::lock_guard lock(m_impl->mutex);
+    ++m_impl->stops;
+    m_impl->wakeUp();
+}
+
+} // namespace sf
@@ -32,12 +32,13 @@
 #include <SFML/System/Err.hpp>
 
 #include <ostream>
+#include <utility>
 
 
 namespace sf
 {
 ////////////////////////////////////////////////////////////
-TcpListener::TcpListener() : Socket(Type::Tcp)
+TcpListener::TcpListener() : Socket(Type::Tcp), m_backlog(SOMAXCONN)
 {
 }
 
@@ -61,6 +62,34 @@ unsigned short TcpListener::getLocalPort() const
 }
 
 
+////////////////////////////////////////////////////////////
+void TcpListener::setPortReuseEnabled(bool enabled)
+{
+    m_portReuse = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TcpListener::isPortReuseEnabled() const
+{
+    return m_portReuse;
+}
+
+
+////////////////////////////////////////////////////////////
+void TcpListener::setBacklog(int backlog)
+{
+    m_backlog = backlog;
+}
+
+
+////////////////////////////////////////////////////////////
+int TcpListener::getBacklog() const
+{
+    return m_backlog;
+}
+
+
 ////////////////////////////////////////////////////////////
 Socket::Status TcpListener::listen(unsigned short port, const IpAddress& address)
 {
@@ -74,6 +103,22 @@ Socket::Status TcpListener::listen(unsigned short port, const IpAddress& address
     if (address == IpAddress::Broadcast)
         return Status::Error;
 
+    // Let other listeners share the port, the system then balances the connections between them
+    if (m_portReuse)
+    {
+#ifdef SO_REUSEPORT
+        int yes = 1;
+        if (setsockopt(getNativeHandle(), SOL_SOCKET, SO_REUSEPORT, reinterpret_cast<char*>(&yes), sizeof(yes)) == -1)
+        {
+            err() << "Failed to enable port reuse on listener socket" << std::endl;
+            return Status::Error;
+        }
+#else
+        err() << "Port reuse is not supported on this system" << std::endl;
+        return Status::Error;
+#endif
+    }
+
     // Bind the socket to the specified port
     sockaddr_in addr = priv::SocketImpl::createAddress(address.toInteger(), port);
     if (bind(getNativeHandle(), reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == -1)
@@ -84,7 +129,7 @@ Socket::Status TcpListener::listen(unsigned short port, const IpAddress& address
     }
 
     // Listen to the bound port
-    if (::listen(getNativeHandle(), SOMAXCONN) == -1)
+    if (::listen(getNativeHandle(), m_backlog) == -1)
     {
         // Oops, socket is deaf
         err() << "Failed to listen to port " << port << std::endl;
@@ -129,4 +174,30 @@ Socket::Status TcpListener::accept(TcpSocket& socket)
     return Status::Done;
 }
 
+
+////////////////////////////////////////////////////////////
+Socket::Status TcpListener::acceptAll(std::vector<TcpSocket>& sockets)
+{
+    // Wait for a first connection, like accept
+    TcpSocket    socket;
+    const Status status = accept(socket);
+    if (status != Status::Done)
+        return status;
+
+    sockets.push_back(std::move(socket));
+
+    // Then take the connections that are already pending, without waiting for more
+    const bool blocking = isBlocking();
+    if (blocking)
+        setBlocking(false);
+
+    while (accept(socket) == Status::Done)
+        sockets.push_back(std::move(socket));
+
+    if (blocking)
+        setBlocking(true);
+
+    return Status::Done;
+}
+
 } // namespace sf
@@ -50,6 +50,9 @@ const int flags = MSG_NOSIGNAL;
 #else
 const int flags = 0;
 #endif
+
+// Small blocks of the send queue are merged up to this size, so that they can be sent with fewer system calls
+constexpr std::size_t maxMergedBlockSize = 64 * 1024;
 } // namespace
 
 namespace sf
@@ -218,6 +221,12 @@ void TcpSocket::disconnect()
 
     // Reset the pending packet data
     m_pendingPacket = PendingPacket();
+
+    // Drop the data that was waiting to be sent
+    m_sendQueue.clear();
+    m_sendQueueOffset = 0;
+    m_queuedSize      = 0;
+    m_queueFull       = false;
 }
 
 
@@ -429,4 +438,110 @@ Socket::Status TcpSocket::receive(Packet& packet)
     return Status::Done;
 }
 
+
+////////////////////////////////////////////////////////////
+void TcpSocket::queue(const void* data, std::size_t size)
+{
+    if (!data || (size == 0))
+        return;
+
+    // Append small data to the last block rather than creating a new one
+    const auto* bytes = static_cast<const std::byte*>(data);
+    if (m_sendQueue.empty() || (m_sendQueue.back().size() + size > maxMergedBlockSize))
+        m_sendQueue.emplace_back();
+
+    m_sendQueue.back().insert(m_sendQueue.back().end(), bytes, bytes + size);
+    m_queuedSize += size;
+
+    if (m_queuedSize >= m_queueHighWatermark)
+        m_queueFull = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void TcpSocket::queue(Packet& packet)
+{
+    // As with send(Packet&), the size of the packet is sent first
+    std::size_t         size       = 0;
+    const void*         data       = packet.onSend(size);
+    const std::uint32_t packetSize = htonl(static_cast<std::uint32_t>(size));
+
+    queue(&packetSize, sizeof(packetSize));
+    queue(data, size);
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TcpSocket::flush()
+{
+    bool sentAny = false;
+    while (!m_sendQueue.empty())
+    {
+        // Gather the queued blocks, so that they are sent with a single system call
+        priv::SocketImpl::Buffer buffers[priv::SocketImpl::maxBuffers];
+        const std::size_t        count = std::min(m_sendQueue.size(), priv::SocketImpl::maxBuffers);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const std::size_t offset = (i == 0) ? m_sendQueueOffset : 0;
+            buffers[i].data          = m_sendQueue[i].data() + offset;
+            buffers[i].size          = m_sendQueue[i].size() - offset;
+        }
+
+        const std::int64_t result = priv::SocketImpl::sendBuffers(getNativeHandle(), buffers, count);
+        if (result < 0)
+        {
+            const Status status = priv::SocketImpl::getErrorStatus();
+
+            if ((status == Status::NotReady) && sentAny)
+                return Status::Partial;
+
+            return status;
+        }
+
+        // Remove the blocks that were entirely sent
+        auto        sent     = static_cast<std::size_t>(result);
+        std::size_t finished = 0;
+        m_queuedSize -= sent;
+        sent += m_sendQueueOffset;
+        while ((finished < count) && (sent >= m_sendQueue[finished].size()))
+            sent -= m_sendQueue[finished++].size();
+
+        m_sendQueue.erase(m_sendQueue.begin(), m_sendQueue.begin() + static_cast<std::ptrdiff_t>(finished));
+        m_sendQueueOffset = sent;
+        sentAny           = sentAny || (result > 0);
+
+        if (m_queuedSize <= m_queueLowWatermark)
+            m_queueFull = false;
+    }
+
+    return Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TcpSocket::getQueuedSize() const
+{
+    return m_queuedSize;
+}
+
+
+////////////////////////////////////////////////////////////
+void TcpSocket::setQueueWatermarks(std::size_t low, std::size_t high)
+{
+    m_queueLowWatermark  = std::min(low, high);
+    m_queueHighWatermark = high;
+
+    if (m_queuedSize >= m_queueHighWatermark)
+        m_queueFull = true;
+    else if (m_queuedSize <= m_queueLowWatermark)
+        m_queueFull = false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TcpSocket::isQueueFull() const
+{
+    return m_queueFull;
+}
+
 } // namespace sf
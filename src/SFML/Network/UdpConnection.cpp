@@ -0,0 +1,671 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/UdpConnection.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <cstring>
+
+
+namespace
+{
+// Layout of a datagram:
+// - protocol identifier (1 byte)
+// - sequence number of the datagram (2 bytes)
+// - sequence number of the latest datagram received from the peer (2 bytes)
+// - bits telling which of the 32 previous datagrams were received (4 bytes)
+// - kind of content (1 byte), with a flag telling whether the acknowledgment fields are valid
+// Then, unless the datagram only carries acknowledgments:
+// - channel (1 byte)
+// - message identifier (4 bytes)
+// - order of the message in its channel (4 bytes)
+// - index of the fragment and number of fragments (2 + 2 bytes)
+// - fragment data
+constexpr std::uint8_t protocolId        = 0xA7;
+constexpr std::size_t  headerSize        = 10;
+constexpr std::size_t  messageHeaderSize = 13;
+constexpr std::uint8_t hasAckFlag        = 0x80;
+constexpr std::uint8_t ackOnlyKind       = 0;
+
+// Number of datagrams remembered until their acknowledgment, more than the 33 acknowledged by each datagram
+constexpr std::size_t sentHistorySize = 64;
+
+// Maximum number of reliable fragments in flight: a single acknowledgment covers all of them,
+// and they stay in the sent history until they are acknowledged
+constexpr std::size_t sendWindowSize = 32;
+
+// Maximum number of times the resend delay of a fragment is doubled, when its copies keep getting lost
+constexpr unsigned int maxResendBackoff = 5;
+
+// Number of incomplete incoming messages kept for reassembly, to bound the memory used by a misbehaving peer
+constexpr std::size_t maxIncompleteMessages = 256;
+
+// Bounds of the delay after which unacknowledged messages are resent, before the backoff
+constexpr sf::Time minResendDelay = sf::milliseconds(20);
+constexpr sf::Time maxResendDelay = sf::seconds(1);
+
+
+// Is sequence number a more recent than b, accounting for wrap-around?
+bool isNewer(std::uint16_t a, std::uint16_t b)
+{
+    return static_cast<std::int16_t>(static_cast<std::uint16_t>(a - b)) > 0;
+}
+
+
+// Big endian serialization
+void write(std::byte* data, std::uint64_t value, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; ++i)
+        data[i] = static_cast<std::byte>(value >> (8 * (size - 1 - i)));
+}
+
+template <typename T>
+T read(const std::byte* data)
+{
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+        value = (value << 8) | static_cast<std::uint64_t>(data[i]);
+
+    return static_cast<T>(value);
+}
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct UdpConnection::Impl
+{
+    struct Fragment
+    {
+        bool          acknowledged{}; //!< Has the peer acknowledged the fragment?
+        bool          sent{};         //!< Has the fragment been sent at least once?
+        std::uint16_t sequence{};     //!< Sequence number of the latest datagram carrying the fragment
+        unsigned int  resendCount{};  //!< Number of times the fragment was resent
+        Time          lastSent;       //!< Time at which the fragment was last sent
+    };
+
+    struct OutgoingMessage
+    {
+        Delivery               delivery;          //!< Delivery guarantees
+        std::uint8_t           channel;           //!< Channel of the message
+        std::uint32_t          order;             //!< Order of the message in its channel
+        std::vector<std::byte> data;              //!< Message data, kept until all the fragments are acknowledged
+        std::vector<Fragment>  fragments;         //!< State of each fragment
+        std::size_t            acknowledgedCount; //!< Number of fragments acknowledged
+    };
+
+    struct SentDatagram
+    {
+        std::optional<std::uint16_t> sequence;  //!< Sequence number of the datagram, empty if the slot is unused
+        Time                         time;      //!< Time at which the datagram was sent
+        bool                         message;   //!< Does the datagram carry a message fragment? (the peer acknowledges it promptly)
+        bool                         reliable;  //!< Does the datagram carry a fragment of a reliable message?
+        std::uint32_t                messageId; //!< Identifier of the reliable message
+        std::uint16_t                fragment;  //!< Index of the fragment
+    };
+
+    struct IncomingMessage
+    {
+        Delivery                            delivery;      //!< Delivery guarantees
+        std::uint8_t                        channel;       //!< Channel of the message
+        std::uint32_t                       order;         //!< Order of the message in its channel
+        std::vector<std::vector<std::byte>> fragments;     //!< Fragments received so far
+        std::size_t                         receivedCount; //!< Number of fragments received
+    };
+
+    using OrderKey = std::pair<std::uint8_t, std::uint32_t>; // Channel and order of an ordered message
+
+    struct Message
+    {
+        std::uint8_t           channel; //!< Channel of the message
+        std::vector<std::byte> data;    //!< Message data
+    };
+
+    Impl(UdpSocket& theSocket, IpAddress theRemoteAddress, unsigned short theRemotePort) :
+    socket(theSocket),
+    remoteAddress(theRemoteAddress),
+    remotePort(theRemotePort)
+    {
+    }
+
+    Time getResendDelay(unsigned int resendCount) const
+    {
+        // The delay doubles after each resend of the same fragment (RFC 6298), in case the network is congested
+        const Time delay = std::clamp(smoothedRtt + rttVariation * 4.f, minResendDelay, maxResendDelay);
+        return delay * static_cast<std::int64_t>(1u << std::min(resendCount, maxResendBackoff));
+    }
+
+    void sendDatagram(std::uint8_t kind, OutgoingMessage* message, std::uint32_t messageId, std::uint16_t fragment);
+    void forget(std::uint16_t sequence);
+    void sendPendingFragments();
+    void acknowledge(std::uint16_t sequence);
+    void receiveFragment(std::uint8_t kind, const std::byte* data, std::size_t size);
+    void deliver(IncomingMessage& message);
+
+    UdpSocket&                                 socket;                         //!< Socket used to exchange the datagrams
+    IpAddress                                  remoteAddress;                  //!< Address of the peer
+    unsigned short                             remotePort;                     //!< Port of the peer
+    Clock                                      clock;                          //!< Time reference
+    Time                                       lastReceiveTime;                //!< Time at which the last datagram was received
+    Time                                       smoothedRtt{milliseconds(100)}; //!< Smoothed round trip time
+    Time                                       rttVariation{milliseconds(50)}; //!< Variation of the round trip time
+    std::uint16_t                              localSequence{};                //!< Sequence number of the next datagram
+    std::uint16_t                              remoteSequence{};               //!< Latest sequence number received
+    std::uint32_t                              remoteHistory{};                //!< Which of the 32 datagrams before remoteSequence were received
+    bool                                       hasRemoteSequence{};            //!< Has a datagram been received yet?
+    bool                                       ackPending{};                   //!< Must the received messages be acknowledged?
+    std::array<SentDatagram, sentHistorySize>  sentDatagrams{};                //!< Recently sent datagrams, indexed by sequence number
+    std::size_t                                inFlightCount{};                //!< Number of reliable fragments sent and not acknowledged yet
+    std::uint32_t                              nextReliableId{};               //!< Identifier of the next reliable message
+    std::uint32_t                              nextUnreliableId{};             //!< Identifier of the next unreliable message
+    std::array<std::uint32_t, 256>             nextSendOrder{};                //!< Order of the next ordered message sent on each channel
+    std::array<std::uint32_t, 256>             nextReceiveOrder{};             //!< Order of the next ordered message to deliver on each channel
+    std::map<std::uint32_t, OutgoingMessage>   outgoing;                       //!< Reliable messages not acknowledged yet
+    std::map<std::uint32_t, IncomingMessage>   incomingReliable;               //!< Reliable messages being reassembled
+    std::map<std::uint32_t, IncomingMessage>   incomingUnreliable;             //!< Unreliable messages being reassembled
+    std::uint32_t                              completeBelow{};                //!< All the reliable messages below this identifier were received
+    std::set<std::uint32_t>                    completeAbove;                  //!< Reliable messages received above completeBelow
+    std::map<OrderKey, std::vector<std::byte>> heldMessages;                   //!< Ordered messages waiting for the previous ones
+    std::deque<Message>                        received;                       //!< Messages ready to be delivered
+    std::vector<std::byte>                     buffer;                         //!< Datagram being built
+    std::vector<std::byte>                     receiveBuffer;                  //!< Datagram being received
+    Statistics                                 statistics;                     //!< Statistics of the connection
+};
+
+
+////////////////////////////////////////////////////////////
+void UdpConnection::Impl::sendDatagram(std::uint8_t     kind,
+                                       OutgoingMessage* message,
+                                       std::uint32_t    messageId,
+                                       std::uint16_t    fragment)
+{
+    const std::uint16_t sequence = localSequence++;
+
+    // Header, with the acknowledgments of the peer's datagrams
+    buffer.resize(headerSize);
+    buffer[0] = static_cast<std::byte>(protocolId);
+    write(&buffer[1], sequence, 2);
+    write(&buffer[3], remoteSequence, 2);
+    write(&buffer[5], remoteHistory, 4);
+    buffer[9] = static_cast<std::byte>(kind | (hasRemoteSequence ? hasAckFlag : 0));
+    ackPending = false;
+
+    // Message fragment
+    if (message)
+    {
+        const auto        fragmentCount = static_cast<std::uint16_t>(message->fragments.size());
+        const std::size_t offset        = std::size_t{fragment} * MaxFragmentSize;
+        const std::size_t size          = std::min(MaxFragmentSize, message->data.size() - offset);
+
+        buffer.resize(headerSize + messageHeaderSize + size);
+        buffer[headerSize] = static_cast<std::byte>(message->channel);
+        write(&buffer[headerSize + 1], messageId, 4);
+        write(&buffer[headerSize + 5], message->order, 4);
+        write(&buffer[headerSize + 9], fragment, 2);
+        write(&buffer[headerSize + 11], fragmentCount, 2);
+        if (size > 0)
+            std::memcpy(&buffer[headerSize + messageHeaderSize], &message->data[offset], size);
+    }
+
+    // Remember the datagram, to handle its acknowledgment
+    const Time now = clock.getElapsedTime();
+    if (message)
+    {
+        Fragment& state = message->fragments[fragment];
+        state.sent      = true;
+        state.sequence  = sequence;
+        state.lastSent  = now;
+    }
+
+    // The datagram that used the same slot is too old to be acknowledged anymore
+    SentDatagram& sent = sentDatagrams[sequence % sentHistorySize];
+    if (sent.sequence && sent.reliable)
+        --inFlightCount;
+
+    if (message && (message->delivery != Delivery::Unreliable))
+        ++inFlightCount;
+
+    sent.sequence      = sequence;
+    sent.time          = now;
+    sent.message       = message != nullptr;
+    sent.reliable      = message && (message->delivery != Delivery::Unreliable);
+    sent.messageId     = messageId;
+    sent.fragment      = fragment;
+
+    ++statistics.sentDatagrams;
+    (void)socket.send(buffer.data(), buffer.size(), remoteAddress, remotePort);
+}
+
+
+////////////////////////////////////////////////////////////
+void UdpConnection::Impl::forget(std::uint16_t sequence)
+{
+    SentDatagram& sent = sentDatagrams[sequence % sentHistorySize];
+    if (sent.sequence != sequence)
+        return;
+
+    sent.sequence.reset();
+    if (sent.reliable)
+        --inFlightCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void UdpConnection::Impl::sendPendingFragments()
+{
+    // Send the fragments that were never sent, oldest message first, as long as the window allows it
+    for (auto& [messageId, message] : outgoing)
+    {
+        const auto kind = static_cast<std::uint8_t>(static_cast<std::uint8_t>(message.delivery) + 1);
+        for (std::size_t i = 0; i < message.fragments.size(); ++i)
+        {
+            if (inFlightCount >= sendWindowSize)
+                return;
+
+            if (!message.fragments[i].sent)
+                sendDatagram(kind, &message, messageId, static_cast<std::uint16_t>(i));
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void UdpConnection::Impl::acknowledge(std::uint16_t sequence)
+{
+    SentDatagram& sent = sentDatagrams[sequence % sentHistorySize];
+    if (sent.sequence != sequence)
+        return;
+
+    forget(sequence);
+
+    // Update the round trip time estimate (RFC 6298), the acknowledgments of datagrams
+    // without messages are only sent along with other datagrams and may be late
+    if (sent.message)
+    {
+        const Time sample     = clock.getElapsedTime() - sent.time;
+        const Time difference = smoothedRtt > sample ? smoothedRtt - sample : sample - smoothedRtt;
+        rttVariation          = rttVariation * 0.75f + difference * 0.25f;
+        smoothedRtt           = smoothedRtt * 0.875f + sample * 0.125f;
+    }
+
+    if (!sent.reliable)
+        return;
+
+    // The fragment may have been acknowledged already, through another copy of it
+    const auto it = outgoing.find(sent.messageId);
+    if (it == outgoing.end())
+        return;
+
+    Fragment& fragment = it->second.fragments[sent.fragment];
+    if (fragment.acknowledged)
+        return;
+
+    fragment.acknowledged = true;
+    if (++it->second.acknowledgedCount == it->second.fragments.size())
+        outgoing.erase(it);
+}
+
+
+////////////////////////////////////////////////////////////
+void UdpConnection::Impl::receiveFragment(std::uint8_t kind, const std::byte* data, std::size_t size)
+{
+    if ((kind > static_cast<std::uint8_t>(Delivery::Ordered) + 1) || (size < messageHeaderSize))
+        return;
+
+    const auto delivery      = static_cast<Delivery>(kind - 1);
+    const auto channel       = read<std::uint8_t>(data);
+    const auto messageId     = read<std::uint32_t>(data + 1);
+    const auto order         = read<std::uint32_t>(data + 5);
+    const auto fragment      = read<std::uint16_t>(data + 9);
+    const auto fragmentCount = read<std::uint16_t>(data + 11);
+    const auto fragmentSize  = size - messageHeaderSize;
+    if ((fragment >= fragmentCount) || (fragmentSize > MaxFragmentSize) ||
+        ((fragment + 1 < fragmentCount) && (fragmentSize != MaxFragmentSize)))
+        return;
+
+    // Ignore the reliable messages that were already received (resent because the acknowledgment was lost)
+    const bool reliable = delivery != Delivery::Unreliable;
+    if (reliable && ((messageId < completeBelow) || (completeAbove.count(messageId) > 0)))
+        return;
+
+    // Add the fragment to the message being reassembled
+    auto& incoming = reliable ? incomingReliable : incomingUnreliable;
+    auto  it       = incoming.find(messageId);
+    if (it == incoming.end())
+    {
+        if (incoming.size() >= maxIncompleteMessages)
+        {
+            // Unreliable messages are likely lost, give up the oldest one; reliable ones will be resent
+            if (reliable)
+                return;
+
+            incoming.erase(incoming.begin());
+        }
+
+        it = incoming.emplace(messageId, IncomingMessage{delivery, channel, order, {}, 0}).first;
+        it->second.fragments.resize(fragmentCount);
+    }
+
+    IncomingMessage& message = it->second;
+    if ((message.fragments.size() != fragmentCount) || (message.delivery != delivery) || (message.channel != channel))
+        return;
+
+    std::vector<std::byte>& fragmentData = message.fragments[fragment];
+    if (!fragmentData.empty() || ((fragmentSize == 0) && (fragmentCount > 1)))
+        return;
+
+    fragmentData.assign(data + messageHeaderSize, data + size);
+    if (++message.receivedCount < fragmentCount)
+        return;
+
+    // The message is complete
+    if (reliable)
+    {
+        completeAbove.insert(messageId);
+        while (!completeAbove.empty() && (*completeAbove.begin() == completeBelow))
+        {
+            completeAbove.erase(completeAbove.begin());
+            ++completeBelow;
+        }
+    }
+
+    deliver(message);
+    incoming.erase(it);
+}
+
+
+////////////////////////////////////////////////////////////
+void UdpConnection::Impl::deliver(IncomingMessage& message)
+{
+    std::vector<std::byte> data;
+    for (std::vector<std::byte>& fragment : message.fragments)
+        data.insert(data.end(), fragment.begin(), fragment.end());
+
+    if (message.delivery != Delivery::Ordered)
+    {
+        received.push_back({message.channel, std::move(data)});
+        return;
+    }
+
+    // Hold the ordered messages that arrived before the previous ones of their channel
+    std::uint32_t& nextOrder = nextReceiveOrder[message.channel];
+    if (message.order != nextOrder)
+    {
+        if (message.order - nextOrder < 0x80000000u)
+            heldMessages.emplace(std::pair(message.channel, message.order), std::move(data));
+        return;
+    }
+
+    received.push_back({message.channel, std::move(data)});
+    ++nextOrder;
+
+    // Deliver the following messages, if they were held
+    for (auto it = heldMessages.find({message.channel, nextOrder}); it != heldMessages.end();
+         it      = heldMessages.find({message.channel, nextOrder}))
+    {
+        received.push_back({message.channel, std::move(it->second)});
+        heldMessages.erase(it);
+        ++nextOrder;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+UdpConnection::UdpConnection(UdpSocket& socket, IpAddress remoteAddress, unsigned short remotePort) :
+m_impl(std::make_unique<Impl>(socket, remoteAddress, remotePort))
+{
+    socket.setBlocking(false);
+}
+
+
+////////////////////////////////////////////////////////////
+UdpConnection::~UdpConnection() = default;
+
+
+////////////////////////////////////////////////////////////
+UdpConnection::UdpConnection(UdpConnection&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+UdpConnection& UdpConnection::operator=(UdpConnection&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+IpAddress UdpConnection::getRemoteAddress() const
+{
+    return m_impl->remoteAddress;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned short UdpConnection::getRemotePort() const
+{
+    return m_impl->remotePort;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status UdpConnection::send(Packet& packet, std::uint8_t channel, Delivery delivery)
+{
+    std::size_t size = 0;
+    const auto* data = static_cast<const std::byte*>(packet.onSend(size));
+
+    const std::size_t fragmentCount = std::max<std::size_t>((size + MaxFragmentSize - 1) / MaxFragmentSize, 1);
+    if (fragmentCount > 0xFFFF)
+    {
+        err() << "Cannot send message over UDP connection, its size (" << size << ") is too large" << std::endl;
+        return Socket::Status::Error;
+    }
+
+    const bool          reliable  = delivery != Delivery::Unreliable;
+    const std::uint32_t messageId = reliable ? m_impl->nextReliableId++ : m_impl->nextUnreliableId++;
+    const auto          kind      = static_cast<std::uint8_t>(static_cast<std::uint8_t>(delivery) + 1);
+
+    Impl::OutgoingMessage message{delivery, channel, 0, {}, std::vector<Impl::Fragment>(fragmentCount), 0};
+    message.data.assign(data, data + size);
+    if (delivery == Delivery::Ordered)
+        message.order = m_impl->nextSendOrder[channel]++;
+
+    // Reliable messages are kept until they are acknowledged, and their fragments are sent as the
+    // send window allows it; unreliable messages are sent at once, and forgotten
+    if (reliable)
+    {
+        m_impl->outgoing.emplace(messageId, std::move(message));
+        m_impl->sendPendingFragments();
+    }
+    else
+    {
+        for (std::size_t i = 0; i < fragmentCount; ++i)
+            m_impl->sendDatagram(kind, &message, messageId, static_cast<std::uint16_t>(i));
+    }
+
+    ++m_impl->statistics.sentMessages;
+    return Socket::Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UdpConnection::receive(Packet& packet, std::uint8_t& channel)
+{
+    if (m_impl->received.empty())
+        return false;
+
+    Impl::Message& message = m_impl->received.front();
+    channel                = message.channel;
+    packet.clear();
+    packet.onReceive(message.data.data(), message.data.size());
+
+    m_impl->received.pop_front();
+    ++m_impl->statistics.receivedMessages;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void UdpConnection::update(bool readSocket)
+{
+    // Process the datagrams waiting in the socket, ignoring those coming from other peers
+    if (readSocket)
+    {
+        std::vector<std::byte>& datagram = m_impl->receiveBuffer;
+        datagram.resize(UdpSocket::MaxDatagramSize);
+
+        std::size_t              received = 0;
+        std::optional<IpAddress> sender;
+        unsigned short           senderPort = 0;
+        while (m_impl->socket.receive(datagram.data(), datagram.size(), received, sender, senderPort) ==
+               Socket::Status::Done)
+        {
+            if ((sender == m_impl->remoteAddress) && (senderPort == m_impl->remotePort))
+                handleDatagram(datagram.data(), received);
+        }
+    }
+
+    // Resend the fragments that were not acknowledged in time; the previous copy is considered lost
+    const Time now = m_impl->clock.getElapsedTime();
+    for (auto& [messageId, message] : m_impl->outgoing)
+    {
+        const auto kind = static_cast<std::uint8_t>(static_cast<std::uint8_t>(message.delivery) + 1);
+        for (std::size_t i = 0; i < message.fragments.size(); ++i)
+        {
+            Impl::Fragment& fragment = message.fragments[i];
+            if (fragment.sent && !fragment.acknowledged &&
+                (now - fragment.lastSent >= m_impl->getResendDelay(fragment.resendCount)))
+            {
+                m_impl->forget(fragment.sequence);
+                ++fragment.resendCount;
+                m_impl->sendDatagram(kind, &message, messageId, static_cast<std::uint16_t>(i));
+                ++m_impl->statistics.resentDatagrams;
+            }
+        }
+    }
+
+    // Send the new fragments that the acknowledgments made room for
+    m_impl->sendPendingFragments();
+
+    // Acknowledge the received messages, if no datagram did it already
+    if (m_impl->ackPending)
+        m_impl->sendDatagram(ackOnlyKind, nullptr, 0, 0);
+}
+
+
+////////////////////////////////////////////////////////////
+void UdpConnection::handleDatagram(const void* data, std::size_t size)
+{
+    const auto* bytes = static_cast<const std::byte*>(data);
+    if ((size < headerSize) || (bytes[0] != static_cast<std::byte>(protocolId)))
+        return;
+
+    const auto sequence = read<std::uint16_t>(bytes + 1);
+    const auto ack      = read<std::uint16_t>(bytes + 3);
+    const auto ackBits  = read<std::uint32_t>(bytes + 5);
+    const auto kind     = read<std::uint8_t>(bytes + 9);
+
+    m_impl->lastReceiveTime = m_impl->clock.getElapsedTime();
+    ++m_impl->statistics.receivedDatagrams;
+
+    // Record the sequence number, so that the datagram is acknowledged
+    if (!m_impl->hasRemoteSequence)
+    {
+        m_impl->remoteSequence    = sequence;
+        m_impl->hasRemoteSequence = true;
+    }
+    else if (isNewer(sequence, m_impl->remoteSequence))
+    {
+        const auto shift         = static_cast<std::uint16_t>(sequence - m_impl->remoteSequence);
+        m_impl->remoteHistory    = shift <= 32 ? ((m_impl->remoteHistory << 1 | 1u) << (shift - 1)) : 0;
+        m_impl->remoteSequence   = sequence;
+    }
+    else if (const auto age = static_cast<std::uint16_t>(m_impl->remoteSequence - sequence); (age > 0) && (age <= 32))
+    {
+        m_impl->remoteHistory |= 1u << (age - 1);
+    }
+
+    // Handle the acknowledgments of our own datagrams
+    if (kind & hasAckFlag)
+    {
+        m_impl->acknowledge(ack);
+        for (std::uint16_t i = 0; i < 32; ++i)
+        {
+            if (ackBits & (1u << i))
+                m_impl->acknowledge(static_cast<std::uint16_t>(ack - i - 1));
+        }
+    }
+
+    const auto contentKind = static_cast<std::uint8_t>(kind & ~hasAckFlag);
+    if (contentKind == ackOnlyKind)
+        return;
+
+    m_impl->ackPending = true;
+    m_impl->receiveFragment(contentKind, bytes + headerSize, size - headerSize);
+}
+
+
+////////////////////////////////////////////////////////////
+Time UdpConnection::getRoundTripTime() const
+{
+    return m_impl->smoothedRtt;
+}
+
+
+////////////////////////////////////////////////////////////
+Time UdpConnection::getTimeSinceLastReceive() const
+{
+    return m_impl->clock.getElapsedTime() - m_impl->lastReceiveTime;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t UdpConnection::getUnacknowledgedCount() const
+{
+    return m_impl->outgoing.size();
+}
+
+
+////////////////////////////////////////////////////////////
+const UdpConnection::Statistics& UdpConnection::getStatistics() const
+{
+    return m_impl->statistics;
+}
+
+} // namespace sf
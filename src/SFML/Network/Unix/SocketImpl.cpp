@@ -29,8 +29,17 @@
 
 #include <SFML/System/Err.hpp>
 
+#include <algorithm>
 #include <fcntl.h>
 #include <ostream>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
+#if defined(SFML_SYSTEM_LINUX)
+#include <sys/sendfile.h>
+
+#include <csignal>
+#endif
 
 #include <cerrno>
 
@@ -108,4 +117,120 @@ Socket::Status SocketImpl::getErrorStatus()
     // clang-format on
 }
 
+
+////////////////////////////////////////////////////////////
+int SocketImpl::poll(PollDescriptor* descriptors, std::size_t count, int timeout)
+{
+    int result = 0;
+    while (((result = ::poll(descriptors, static_cast<nfds_t>(count), timeout)) < 0) && (errno == EINTR))
+        ;
+
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t SocketImpl::sendBuffers(SocketHandle sock, const Buffer* buffers, std::size_t count)
+{
+    count = std::min(count, maxBuffers);
+
+    iovec vectors[maxBuffers];
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        vectors[i].iov_base = const_cast<void*>(buffers[i].data);
+        vectors[i].iov_len  = buffers[i].size;
+    }
+
+    msghdr message{};
+    message.msg_iov    = vectors;
+    message.msg_iovlen = static_cast<decltype(message.msg_iovlen)>(count);
+
+    // sendmsg() is used rather than writev() so that no SIGPIPE is raised if the peer closed the connection
+#if defined(SFML_SYSTEM_LINUX)
+    const int flags = MSG_NOSIGNAL;
+#else
+    const int flags = 0;
+#endif
+
+    ssize_t result = 0;
+    while (((result = ::sendmsg(sock, &message, flags)) < 0) && (errno == EINTR))
+        ;
+
+    return static_cast<std::int64_t>(result);
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketImpl::sendFile([[maybe_unused]] SocketHandle                 sock,
+                          [[maybe_unused]] const std::filesystem::path& path,
+                          [[maybe_unused]] std::uint64_t                offset,
+                          std::uint64_t&                                sent)
+{
+    sent = 0;
+
+#if defined(SFML_SYSTEM_LINUX)
+
+    const int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file < 0)
+        return false;
+
+    struct stat status
+    {
+    };
+    if (::fstat(file, &status) < 0)
+    {
+        ::close(file);
+        return false;
+    }
+
+    // Unlike send(), sendfile() can't be told not to raise SIGPIPE when the peer
+    // closes the connection, so the signal is blocked and discarded instead
+    sigset_t pipeSignal;
+    sigset_t previousMask;
+    sigemptyset(&pipeSignal);
+    sigaddset(&pipeSignal, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &pipeSignal, &previousMask);
+
+    auto position = static_cast<off_t>(offset);
+    bool success  = true;
+    while (position < status.st_size)
+    {
+        // A single call transfers at most about 2 GB
+        const auto    count  = static_cast<std::size_t>(std::min<off_t>(status.st_size - position, 0x40000000));
+        const ssize_t result = ::sendfile(sock, file, &position, count);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            success = false;
+            break;
+        }
+
+        // The file was truncated while sending it
+        if (result == 0)
+            break;
+
+        sent += static_cast<std::uint64_t>(result);
+    }
+
+    if (!success && (errno == EPIPE))
+    {
+        const int      error = errno;
+        const timespec zero{};
+        sigtimedwait(&pipeSignal, nullptr, &zero);
+        errno = error;
+    }
+
+    pthread_sigmask(SIG_SETMASK, &previousMask, nullptr);
+    ::close(file);
+    return success;
+
+#else
+
+    return false;
+
+#endif
+}
+
 } // namespace sf::priv
@@ -27,6 +27,8 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/SocketImpl.hpp>
 
+#include <algorithm>
+
 #include <cstdint>
 
 
@@ -86,6 +88,45 @@ Socket::Status SocketImpl::getErrorStatus()
 }
 
 
+////////////////////////////////////////////////////////////
+int SocketImpl::poll(PollDescriptor* descriptors, std::size_t count, int timeout)
+{
+    return WSAPoll(descriptors, static_cast<ULONG>(count), timeout);
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t SocketImpl::sendBuffers(SocketHandle sock, const Buffer* buffers, std::size_t count)
+{
+    count = std::min(count, maxBuffers);
+
+    WSABUF wsaBuffers[maxBuffers];
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        wsaBuffers[i].buf = static_cast<CHAR*>(const_cast<void*>(buffers[i].data));
+        wsaBuffers[i].len = static_cast<ULONG>(buffers[i].size);
+    }
+
+    DWORD sent = 0;
+    if (WSASend(sock, wsaBuffers, static_cast<DWORD>(count), &sent, 0, nullptr, nullptr) == SOCKET_ERROR)
+        return -1;
+
+    return static_cast<std::int64_t>(sent);
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketImpl::sendFile(SocketHandle /* sock */,
+                          const std::filesystem::path& /* path */,
+                          std::uint64_t /* offset */,
+                          std::uint64_t& sent)
+{
+    // Not supported, the caller sends the file through a buffer instead
+    sent = 0;
+    return false;
+}
+
+
 ////////////////////////////////////////////////////////////
 // Windows needs some initialization and cleanup to get
 // sockets working properly... so let's create a class that will
@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/MappedFileInputStream.hpp>
+
+#if defined(SFML_SYSTEM_WINDOWS)
+#include <SFML/System/Win32/MappedFileImpl.hpp>
+#else
+#include <SFML/System/Unix/MappedFileImpl.hpp>
+#endif
+
+#include <algorithm>
+#include <utility>
+
+#include <cstring>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+MappedFileInputStream::~MappedFileInputStream()
+{
+    close();
+}
+
+
+////////////////////////////////////////////////////////////
+MappedFileInputStream::MappedFileInputStream(MappedFileInputStream&& other) noexcept :
+m_data(std::exchange(other.m_data, nullptr)),
+m_size(std::exchange(other.m_size, -1)),
+m_offset(std::exchange(other.m_offset, 0))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+MappedFileInputStream& MappedFileInputStream::operator=(MappedFileInputStream&& other) noexcept
+{
+    if (this != &other)
+    {
+        close();
+        m_data   = std::exchange(other.m_data, nullptr);
+        m_size   = std::exchange(other.m_size, -1);
+        m_offset = std::exchange(other.m_offset, 0);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool MappedFileInputStream::open(const std::filesystem::path& filename, AccessPattern accessPattern)
+{
+    close();
+
+    const std::byte* data = nullptr;
+    std::int64_t     size = 0;
+    if (!priv::mapFileImpl(filename, accessPattern, data, size))
+        return false;
+
+    m_data = data;
+    m_size = size;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void MappedFileInputStream::close()
+{
+    if (m_size >= 0)
+        priv::unmapFileImpl(m_data, m_size);
+
+    m_data   = nullptr;
+    m_size   = -1;
+    m_offset = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void MappedFileInputStream::setAccessPattern(AccessPattern accessPattern)
+{
+    if (m_size >= 0)
+        priv::adviseMappedFileImpl(m_data, m_size, accessPattern);
+}
+
+
+////////////////////////////////////////////////////////////
+const void* MappedFileInputStream::getData() const
+{
+    return m_data;
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t MappedFileInputStream::read(void* data, std::int64_t size)
+{
+    if (m_size < 0)
+        return -1;
+
+    const std::int64_t count = std::min(size, m_size - m_offset);
+    if (count > 0)
+    {
+        std::memcpy(data, m_data + m_offset, static_cast<std::size_t>(count));
+        m_offset += count;
+        return count;
+    }
+
+    return 0;
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t MappedFileInputStream::seek(std::int64_t position)
+{
+    if ((m_size < 0) || (position < 0))
+        return -1;
+
+    m_offset = std::min(position, m_size);
+    return m_offset;
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t MappedFileInputStream::tell()
+{
+    if (m_size < 0)
+        return -1;
+
+    return m_offset;
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t MappedFileInputStream::getSize()
+{
+    return m_size;
+}
+
+} // namespace sf
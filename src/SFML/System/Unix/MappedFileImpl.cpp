@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Unix/MappedFileImpl.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <limits>
+
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+bool mapFileImpl(const std::filesystem::path&         filename,
+                 MappedFileInputStream::AccessPattern accessPattern,
+                 const std::byte*&                    data,
+                 std::int64_t&                        size)
+{
+    const int file = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file < 0)
+        return false;
+
+    // Only regular files can be mapped, and only if they fit in the address space
+    struct stat status
+    {
+    };
+    if ((::fstat(file, &status) < 0) || !S_ISREG(status.st_mode) ||
+        (static_cast<std::uintmax_t>(status.st_size) > std::numeric_limits<std::size_t>::max()))
+    {
+        ::close(file);
+        return false;
+    }
+
+    // mmap fails on empty files, there's nothing to map anyway
+    data = nullptr;
+    size = status.st_size;
+    if (size > 0)
+    {
+        void* address = mmap(nullptr, static_cast<std::size_t>(size), PROT_READ, MAP_PRIVATE, file, 0);
+        if (address == MAP_FAILED)
+        {
+            ::close(file);
+            return false;
+        }
+
+        data = static_cast<const std::byte*>(address);
+        adviseMappedFileImpl(data, size, accessPattern);
+    }
+
+    // The mapping keeps its own reference to the file
+    ::close(file);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void unmapFileImpl(const std::byte* data, std::int64_t size)
+{
+    if (data)
+        munmap(const_cast<std::byte*>(data), static_cast<std::size_t>(size));
+}
+
+
+////////////////////////////////////////////////////////////
+void adviseMappedFileImpl(const std::byte* data, std::int64_t size, MappedFileInputStream::AccessPattern accessPattern)
+{
+    if (!data)
+        return;
+
+    int advice = MADV_NORMAL;
+    switch (accessPattern)
+    {
+        case MappedFileInputStream::AccessPattern::Normal:
+            advice = MADV_NORMAL;
+            break;
+        case MappedFileInputStream::AccessPattern::Sequential:
+            advice = MADV_SEQUENTIAL;
+            break;
+        case MappedFileInputStream::AccessPattern::Random:
+            advice = MADV_RANDOM;
+            break;
+    }
+
+    // This is only a hint, failing to give it is not an error
+    madvise(const_cast<std::byte*>(data), static_cast<std::size_t>(size), advice);
+}
+
+} // namespace sf::priv
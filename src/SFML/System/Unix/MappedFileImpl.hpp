@@ -0,0 +1,78 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/MappedFileInputStream.hpp>
+
+#include <filesystem>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Unix implementation of the mapping of a file in memory
+///
+/// Empty files are opened successfully, with a null pointer.
+///
+/// \param filename      Name of the file to map
+/// \param accessPattern How the contents of the file will be accessed
+/// \param data          Receives the pointer to the mapped contents of the file
+/// \param size          Receives the size of the file, in bytes
+///
+/// \return True on success, false on error
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool mapFileImpl(const std::filesystem::path&         filename,
+                               MappedFileInputStream::AccessPattern accessPattern,
+                               const std::byte*&                    data,
+                               std::int64_t&                        size);
+
+////////////////////////////////////////////////////////////
+/// \brief Unix implementation of the unmapping of a file
+///
+/// \param data Pointer to the mapped contents of the file
+/// \param size Size of the file, in bytes
+///
+////////////////////////////////////////////////////////////
+void unmapFileImpl(const std::byte* data, std::int64_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Unix implementation of the access pattern hint of a mapped file
+///
+/// \param data          Pointer to the mapped contents of the file
+/// \param size          Size of the file, in bytes
+/// \param accessPattern How the contents of the file will be accessed
+///
+////////////////////////////////////////////////////////////
+void adviseMappedFileImpl(const std::byte* data, std::int64_t size, MappedFileInputStream::AccessPattern accessPattern);
+
+} // namespace sf::priv
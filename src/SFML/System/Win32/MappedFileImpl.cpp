@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Win32/MappedFileImpl.hpp>
+#include <SFML/System/Win32/WindowsHeader.hpp>
+
+#include <limits>
+
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+bool mapFileImpl(const std::filesystem::path&         filename,
+                 MappedFileInputStream::AccessPattern accessPattern,
+                 const std::byte*&                    data,
+                 std::int64_t&                        size)
+{
+    // The access pattern can only be given to the cache manager when the file is opened
+    DWORD flags = FILE_ATTRIBUTE_NORMAL;
+    if (accessPattern == MappedFileInputStream::AccessPattern::Sequential)
+        flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+    else if (accessPattern == MappedFileInputStream::AccessPattern::Random)
+        flags |= FILE_FLAG_RANDOM_ACCESS;
+
+    HANDLE file = CreateFileW(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    // Only files on disk can be mapped, and only if they fit in the address space
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || (GetFileType(file) != FILE_TYPE_DISK) ||
+        (static_cast<std::uintmax_t>(fileSize.QuadPart) > std::numeric_limits<std::size_t>::max()))
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    // Empty files can't be mapped, there's nothing to map anyway
+    data = nullptr;
+    size = static_cast<std::int64_t>(fileSize.QuadPart);
+    if (size > 0)
+    {
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        // The view keeps its own references to the mapping and the file
+        data = static_cast<const std::byte*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        CloseHandle(mapping);
+    }
+
+    CloseHandle(file);
+    return (size == 0) || data;
+}
+
+
+////////////////////////////////////////////////////////////
+void unmapFileImpl(const std::byte* data, std::int64_t /* size */)
+{
+    if (data)
+        UnmapViewOfFile(data);
+}
+
+
+////////////////////////////////////////////////////////////
+void adviseMappedFileImpl(const std::byte* /* data */,
+                          std::int64_t /* size */,
+                          MappedFileInputStream::AccessPattern /* accessPattern */)
+{
+    // PrefetchVirtualMemory would need Windows 8, the hint given to CreateFileW is used instead
+}
+
+} // namespace sf::priv
@@ -0,0 +1,98 @@
+#include <SFML/Audio/AsyncOutputSoundFile.hpp>
+
+// Other 1st party headers
+#include <SFML/Audio/InputSoundFile.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <thread>
+#include <type_traits>
+
+TEST_CASE("[Audio] sf::AsyncOutputSoundFile")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::AsyncOutputSoundFile>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::AsyncOutputSoundFile>);
+        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::AsyncOutputSoundFile>);
+        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::AsyncOutputSoundFile>);
+    }
+
+    const auto filename = std::filesystem::temp_directory_path() / "sfml-async-output-sound-file.wav";
+
+    SECTION("Construction")
+    {
+        const sf::AsyncOutputSoundFile outputSoundFile;
+        CHECK(outputSoundFile.getQueuedBlockCount() == 0);
+        CHECK(outputSoundFile.getDroppedBlockCount() == 0);
+    }
+
+    SECTION("write() without a file")
+    {
+        sf::AsyncOutputSoundFile outputSoundFile;
+        const std::array<std::int16_t, 4> samples{1, 2, 3, 4};
+        CHECK(!outputSoundFile.write(samples.data(), samples.size()));
+        CHECK(outputSoundFile.getDroppedBlockCount() == 0);
+        outputSoundFile.flush();
+        outputSoundFile.close();
+    }
+
+    SECTION("write()")
+    {
+        const std::array<std::int16_t, 4> samples{1, -2, 3, -4};
+        const std::array<float, 2>        floatSamples{0.25f, -0.5f};
+
+        {
+            sf::AsyncOutputSoundFile outputSoundFile;
+            REQUIRE(outputSoundFile.openFromFile(filename, 22'050, 2));
+            CHECK(outputSoundFile.write(samples.data(), samples.size()));
+            CHECK(outputSoundFile.write(floatSamples.data(), floatSamples.size()));
+            CHECK(!outputSoundFile.write(samples.data(), 0));
+            outputSoundFile.flush();
+            CHECK(outputSoundFile.getQueuedBlockCount() == 0);
+            CHECK(outputSoundFile.write(samples.data(), samples.size()));
+            CHECK(outputSoundFile.getDroppedBlockCount() == 0);
+        }
+
+        sf::InputSoundFile inputSoundFile;
+        REQUIRE(inputSoundFile.openFromFile(filename));
+        CHECK(inputSoundFile.getSampleCount() == 10);
+        CHECK(inputSoundFile.getChannelCount() == 2);
+        CHECK(inputSoundFile.getSampleRate() == 22'050);
+        std::array<std::int16_t, 10> readSamples{};
+        CHECK(inputSoundFile.read(readSamples.data(), readSamples.size()) == 10);
+        CHECK(readSamples == std::array<std::int16_t, 10>{1, -2, 3, -4, 8'192, -16'384, 1, -2, 3, -4});
+    }
+
+    SECTION("close() while another thread writes")
+    {
+        sf::AsyncOutputSoundFile outputSoundFile(8);
+        REQUIRE(outputSoundFile.openFromFile(filename, 44'100, 1));
+
+        const std::array<std::int16_t, 441> samples{};
+        std::atomic<bool>                   writing{true};
+        std::thread                         producer(
+            [&]
+            {
+                while (writing)
+                    (void)outputSoundFile.write(samples.data(), samples.size());
+            });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        outputSoundFile.close();
+        CHECK(!outputSoundFile.write(samples.data(), samples.size()));
+
+        writing = false;
+        producer.join();
+
+        sf::InputSoundFile inputSoundFile;
+        REQUIRE(inputSoundFile.openFromFile(filename));
+        CHECK(inputSoundFile.getSampleCount() % samples.size() == 0);
+    }
+
+    std::filesystem::remove(filename);
+}
@@ -0,0 +1,154 @@
+#include <SFML/Audio/BiquadFilter.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <SystemUtil.hpp>
+#include <type_traits>
+#include <vector>
+
+#include <cmath>
+
+namespace
+{
+// Level of a sine wave after going through the filter, once the filter has settled
+float filteredLevel(sf::BiquadFilter& filter, float frequency)
+{
+    constexpr unsigned int sampleRate = 44'100;
+    constexpr float        twoPi      = 2.f * 3.14159265f;
+
+    std::vector<float> samples(sampleRate / 2);
+    for (std::size_t i = 0; i < samples.size(); ++i)
+        samples[i] = std::sin(twoPi * frequency * static_cast<float>(i) / sampleRate);
+
+    filter.reset();
+    filter.process(samples.data(), samples.size(), 1, sampleRate);
+
+    float peak = 0.f;
+    for (std::size_t i = samples.size() / 2; i < samples.size(); ++i)
+        peak = std::max(peak, std::abs(samples[i]));
+    return peak;
+}
+} // namespace
+
+TEST_CASE("[Audio] sf::BiquadFilter")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_base_of_v<sf::MixerEffect, sf::BiquadFilter>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::BiquadFilter>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::BiquadFilter>);
+    }
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::BiquadFilter filter;
+            CHECK(filter.getType() == sf::BiquadFilter::Type::LowPass);
+            CHECK(filter.getFrequency() == 1000.f);
+            CHECK(filter.getQ() == Approx(0.7071f));
+            CHECK(filter.getGain() == 0.f);
+        }
+
+        SECTION("Parameters constructor")
+        {
+            const sf::BiquadFilter filter(sf::BiquadFilter::Type::Peak, 440.f, 2.f, -6.f);
+            CHECK(filter.getType() == sf::BiquadFilter::Type::Peak);
+            CHECK(filter.getFrequency() == 440.f);
+            CHECK(filter.getQ() == 2.f);
+            CHECK(filter.getGain() == -6.f);
+        }
+    }
+
+    SECTION("Set/get parameters")
+    {
+        sf::BiquadFilter filter;
+        filter.setType(sf::BiquadFilter::Type::HighShelf);
+        filter.setFrequency(5000.f);
+        filter.setQ(1.5f);
+        filter.setGain(3.f);
+        CHECK(filter.getType() == sf::BiquadFilter::Type::HighShelf);
+        CHECK(filter.getFrequency() == 5000.f);
+        CHECK(filter.getQ() == 1.5f);
+        CHECK(filter.getGain() == 3.f);
+    }
+
+    SECTION("process()")
+    {
+        SECTION("Low-pass")
+        {
+            sf::BiquadFilter filter(sf::BiquadFilter::Type::LowPass, 1000.f);
+            CHECK(filteredLevel(filter, 100.f) > 0.95f);
+            CHECK(filteredLevel(filter, 10'000.f) < 0.02f);
+        }
+
+        SECTION("High-pass")
+        {
+            sf::BiquadFilter filter(sf::BiquadFilter::Type::HighPass, 1000.f);
+            CHECK(filteredLevel(filter, 100.f) < 0.02f);
+            CHECK(filteredLevel(filter, 10'000.f) > 0.95f);
+        }
+
+        SECTION("Notch")
+        {
+            sf::BiquadFilter filter(sf::BiquadFilter::Type::Notch, 1000.f, 2.f);
+            CHECK(filteredLevel(filter, 1000.f) < 0.02f);
+            CHECK(filteredLevel(filter, 10'000.f) > 0.95f);
+        }
+
+        SECTION("Peak")
+        {
+            sf::BiquadFilter filter(sf::BiquadFilter::Type::Peak, 1000.f, 1.f, 6.f);
+            CHECK(filteredLevel(filter, 1000.f) > 1.9f);
+            CHECK(filteredLevel(filter, 20.f) < 1.05f);
+        }
+
+        SECTION("Channels are filtered separately")
+        {
+            sf::BiquadFilter   filter(sf::BiquadFilter::Type::LowPass, 1000.f);
+            std::vector<float> samples(2000, 0.f);
+            for (std::size_t i = 0; i < samples.size(); i += 2)
+                samples[i] = 1.f;
+
+            filter.process(samples.data(), samples.size() / 2, 2, 44'100);
+            CHECK(samples.back() == 0.f);
+            CHECK(samples[samples.size() - 2] == Approx(1.f));
+        }
+
+        SECTION("Interleaved channels match separate channels")
+        {
+            // Several channels are filtered at once; each must come out as if it had been filtered alone
+            for (const unsigned int channelCount : {2u, 3u, 4u, 5u, 8u})
+            {
+                constexpr std::size_t frameCount = 1000;
+                std::vector<float>    interleaved(frameCount * channelCount);
+                for (std::size_t i = 0; i < interleaved.size(); ++i)
+                {
+                    const auto speed = static_cast<float>(i % channelCount + 1) * 0.01f;
+                    interleaved[i]   = std::sin(speed * static_cast<float>(i));
+                }
+
+                sf::BiquadFilter   filter(sf::BiquadFilter::Type::Peak, 2000.f, 1.f, 6.f);
+                std::vector<float> expected = interleaved;
+                for (unsigned int channel = 0; channel < channelCount; ++channel)
+                {
+                    std::vector<float> single(frameCount);
+                    for (std::size_t frame = 0; frame < frameCount; ++frame)
+                        single[frame] = interleaved[frame * channelCount + channel];
+
+                    filter.reset();
+                    filter.process(single.data(), frameCount, 1, 44'100);
+                    for (std::size_t frame = 0; frame < frameCount; ++frame)
+                        expected[frame * channelCount + channel] = single[frame];
+                }
+
+                filter.reset();
+                float* const secondHalf = interleaved.data() + frameCount / 2 * channelCount;
+                filter.process(interleaved.data(), frameCount / 2, channelCount, 44'100);
+                filter.process(secondHalf, frameCount / 2, channelCount, 44'100);
+                for (std::size_t i = 0; i < interleaved.size(); ++i)
+                    CHECK(interleaved[i] == Approx(expected[i]));
+            }
+        }
+    }
+}
@@ -0,0 +1,67 @@
+#include <SFML/Audio/Compressor.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <SystemUtil.hpp>
+#include <type_traits>
+#include <vector>
+
+#include <cmath>
+
+TEST_CASE("[Audio] sf::Compressor")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_base_of_v<sf::MixerEffect, sf::Compressor>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::Compressor>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::Compressor>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::Compressor compressor;
+        CHECK(compressor.getThreshold() == -12.f);
+        CHECK(compressor.getRatio() == 4.f);
+        CHECK(compressor.getAttack() == sf::milliseconds(5));
+        CHECK(compressor.getRelease() == sf::milliseconds(100));
+        CHECK(compressor.getMakeupGain() == 0.f);
+        CHECK(compressor.getGainReduction() == 0.f);
+    }
+
+    SECTION("Set/get parameters")
+    {
+        sf::Compressor compressor;
+        compressor.setThreshold(-20.f);
+        compressor.setRatio(8.f);
+        compressor.setAttack(sf::milliseconds(1));
+        compressor.setRelease(sf::milliseconds(50));
+        compressor.setMakeupGain(6.f);
+        CHECK(compressor.getThreshold() == -20.f);
+        CHECK(compressor.getRatio() == 8.f);
+        CHECK(compressor.getAttack() == sf::milliseconds(1));
+        CHECK(compressor.getRelease() == sf::milliseconds(50));
+        CHECK(compressor.getMakeupGain() == 6.f);
+    }
+
+    SECTION("process()")
+    {
+        sf::Compressor compressor(-12.f, 4.f);
+
+        SECTION("Quiet signals are unchanged")
+        {
+            std::vector<float> samples(4410, 0.1f);
+            compressor.process(samples.data(), samples.size() / 2, 2, 44'100);
+            CHECK(samples.back() == Approx(0.1f));
+            CHECK(compressor.getGainReduction() == Approx(0.f));
+        }
+
+        SECTION("Loud signals are reduced")
+        {
+            // 0 dB is 12 dB above the threshold, it must come out 3 dB above it
+            std::vector<float> samples(44'100, 1.f);
+            compressor.process(samples.data(), samples.size() / 2, 2, 44'100);
+            CHECK(std::abs(20.f * std::log10(samples.back()) + 9.f) < 0.1f);
+            CHECK(std::abs(compressor.getGainReduction() - 9.f) < 0.1f);
+        }
+    }
+}
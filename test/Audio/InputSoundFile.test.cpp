@@ -4,12 +4,36 @@
 #include <SFML/System/FileInputStream.hpp>
 #include <SFML/System/Time.hpp>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <AudioBenchmarkUtil.hpp>
 #include <SystemUtil.hpp>
 #include <array>
+#include <filesystem>
 #include <fstream>
+#include <string>
 #include <type_traits>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+// Decode a whole file, the way sf::SoundBuffer and sf::Music do
+template <typename T>
+std::uint64_t decode(sf::InputSoundFile& file, std::vector<T>& buffer)
+{
+    file.seek(std::uint64_t{0});
+
+    std::uint64_t total = 0;
+    while (const std::uint64_t count = file.read(buffer.data(), buffer.size()))
+        total += count;
+
+    return total;
+}
+} // namespace
 
 TEST_CASE("[Audio] sf::InputSoundFile")
 {
@@ -238,7 +262,7 @@ TEST_CASE("[Audio] sf::InputSoundFile")
 
         SECTION("Null address")
         {
-            CHECK(inputSoundFile.read(nullptr, 10) == 0);
+            CHECK(inputSoundFile.read(static_cast<std::int16_t*>(nullptr), 10) == 0);
         }
 
         SECTION("Zero count")
@@ -277,11 +301,141 @@ TEST_CASE("[Audio] sf::InputSoundFile")
 
             SECTION("wav")
             {
-                // Cannot be tested since reading from a .wav file triggers UB
+                REQUIRE(inputSoundFile.openFromFile("Audio/killdeer.wav"));
+                CHECK(inputSoundFile.read(samples.data(), samples.size()) == 4);
+                CHECK(samples == std::array<std::int16_t, 4>{0, -256, 0, -256});
+                CHECK(inputSoundFile.read(samples.data(), samples.size()) == 4);
+                CHECK(samples == std::array<std::int16_t, 4>{0, -256, 0, 0});
+            }
+        }
+    }
+
+    SECTION("read(float*)")
+    {
+        sf::InputSoundFile   inputSoundFile;
+        std::array<float, 4> samples{};
+
+        SECTION("Unloaded file")
+        {
+            CHECK(inputSoundFile.read(samples.data(), samples.size()) == 0);
+        }
+
+        REQUIRE(inputSoundFile.openFromFile("Audio/ding.flac"));
+
+        SECTION("Null address")
+        {
+            CHECK(inputSoundFile.read(static_cast<float*>(nullptr), 10) == 0);
+        }
+
+        SECTION("Zero count")
+        {
+            CHECK(inputSoundFile.read(samples.data(), 0) == 0);
+        }
+
+        SECTION("Successful read")
+        {
+            SECTION("flac")
+            {
+                REQUIRE(inputSoundFile.openFromFile("Audio/ding.flac"));
+                CHECK(inputSoundFile.read(samples.data(), samples.size()) == 4);
+                CHECK(samples == std::array<float, 4>{0.f, 1.f / 32768, -1.f / 32768, 4.f / 32768});
+                CHECK(inputSoundFile.getSampleOffset() == 4);
+            }
+
+            SECTION("mp3")
+            {
+                REQUIRE(inputSoundFile.openFromFile("Audio/ding.mp3"));
+                CHECK(inputSoundFile.read(samples.data(), samples.size()) == 4);
+                CHECK(samples == std::array<float, 4>{0.f, -2.f / 32768, 0.f, 2.f / 32768});
+                CHECK(inputSoundFile.getSampleOffset() == 4);
+            }
+
+            SECTION("ogg")
+            {
+                REQUIRE(inputSoundFile.openFromFile("Audio/doodle_pop.ogg"));
+                CHECK(inputSoundFile.read(samples.data(), samples.size()) == 4);
+                CHECK(inputSoundFile.getSampleOffset() == 4);
+            }
+
+            SECTION("wav")
+            {
+                REQUIRE(inputSoundFile.openFromFile("Audio/killdeer.wav"));
+                CHECK(inputSoundFile.read(samples.data(), samples.size()) == 4);
+                CHECK(samples == std::array<float, 4>{0.f, -1.f / 128, 0.f, -1.f / 128});
+                inputSoundFile.seek(0);
+                CHECK(inputSoundFile.read(samples.data(), samples.size()) == 4);
+                CHECK(samples == std::array<float, 4>{0.f, -1.f / 128, 0.f, -1.f / 128});
             }
         }
     }
 
+    SECTION("saveSeekIndex()")
+    {
+        sf::InputSoundFile inputSoundFile;
+        const auto         filename = std::filesystem::temp_directory_path() / "ding.mp3.index";
+
+        SECTION("No file open")
+        {
+            CHECK(!inputSoundFile.saveSeekIndex(filename));
+        }
+
+        SECTION("Format without seek index")
+        {
+            REQUIRE(inputSoundFile.openFromFile("Audio/ding.flac"));
+            CHECK(!inputSoundFile.saveSeekIndex(filename));
+        }
+
+        SECTION("mp3")
+        {
+            REQUIRE(inputSoundFile.openFromFile("Audio/ding.mp3"));
+            inputSoundFile.seek(1'000);
+            REQUIRE(inputSoundFile.saveSeekIndex(filename));
+            CHECK(inputSoundFile.getSampleOffset() == 1'000);
+
+            std::array<std::int16_t, 4> samples{};
+            CHECK(inputSoundFile.read(samples.data(), samples.size()) == 4);
+
+            sf::InputSoundFile indexedSoundFile;
+            REQUIRE(indexedSoundFile.openFromFile("Audio/ding.mp3", filename));
+            CHECK(indexedSoundFile.getSampleCount() == 87'798);
+            CHECK(indexedSoundFile.getChannelCount() == 1);
+            CHECK(indexedSoundFile.getSampleRate() == 44'100);
+
+            std::array<std::int16_t, 4> indexedSamples{};
+            indexedSoundFile.seek(1'000);
+            CHECK(indexedSoundFile.read(indexedSamples.data(), indexedSamples.size()) == 4);
+            CHECK(indexedSamples == samples);
+
+            CHECK(std::filesystem::remove(filename));
+        }
+    }
+
+    SECTION("openFromFile() with seek index")
+    {
+        sf::InputSoundFile inputSoundFile;
+
+        SECTION("Missing seek index")
+        {
+            REQUIRE(inputSoundFile.openFromFile("Audio/ding.mp3", "does/not/exist.index"));
+            CHECK(inputSoundFile.getSampleCount() == 87'798);
+        }
+
+        SECTION("Invalid seek index")
+        {
+            const auto filename = std::filesystem::temp_directory_path() / "invalid.index";
+            std::ofstream(filename, std::ios_base::binary) << "not a seek index";
+            REQUIRE(inputSoundFile.openFromFile("Audio/ding.mp3", filename));
+            CHECK(inputSoundFile.getSampleCount() == 87'798);
+            CHECK(std::filesystem::remove(filename));
+        }
+
+        SECTION("Format without seek index")
+        {
+            REQUIRE(inputSoundFile.openFromFile("Audio/ding.flac", "does/not/exist.index"));
+            CHECK(inputSoundFile.getSampleCount() == 87'798);
+        }
+    }
+
     SECTION("close()")
     {
         sf::InputSoundFile inputSoundFile;
@@ -295,3 +449,52 @@ TEST_CASE("[Audio] sf::InputSoundFile")
         CHECK(inputSoundFile.getSampleOffset() == 0);
     }
 }
+
+// The benchmark names give the number of samples processed per run, to compute the throughput from the measured time
+TEST_CASE("[Audio] sf::InputSoundFile decoding benchmark", "[.benchmark]")
+{
+    std::vector<std::int16_t> samples(4096);
+    std::vector<float>        floatSamples(4096);
+
+    for (const std::filesystem::path& path : getBenchmarkFiles())
+    {
+        sf::InputSoundFile file;
+        REQUIRE(file.openFromFile(path));
+
+        const std::string name = path.filename().string() + " (" + std::to_string(file.getSampleCount()) + " samples)";
+
+        BENCHMARK("Decode " + name)
+        {
+            return decode(file, samples);
+        };
+
+        BENCHMARK("Decode to float " + name)
+        {
+            return decode(file, floatSamples);
+        };
+    }
+}
+
+TEST_CASE("[Audio] sf::InputSoundFile seeking benchmark", "[.benchmark]")
+{
+    std::vector<std::int16_t> samples(1024);
+
+    for (const std::filesystem::path& path : getBenchmarkFiles())
+    {
+        sf::InputSoundFile file;
+        REQUIRE(file.openFromFile(path));
+
+        // Spread the seeks over the whole file, in a shuffled order
+        std::array<std::uint64_t, 64> offsets{};
+        const std::uint64_t           frameCount = file.getSampleCount() / file.getChannelCount();
+        for (std::size_t i = 0; i < offsets.size(); ++i)
+            offsets[i] = (i * 37 % offsets.size()) * frameCount / offsets.size() * file.getChannelCount();
+
+        std::size_t next = 0;
+        BENCHMARK("Seek and read 1024 samples " + path.filename().string())
+        {
+            file.seek(offsets[next++ % offsets.size()]);
+            return file.read(samples.data(), samples.size());
+        };
+    }
+}
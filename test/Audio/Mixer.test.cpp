@@ -0,0 +1,326 @@
+#include <SFML/Audio/Mixer.hpp>
+
+// Other 1st party headers
+#include <SFML/Audio/MixerEffect.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Audio/SoundStream.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <AudioUtil.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <cstdint>
+
+namespace
+{
+sf::SoundBuffer makeBuffer(const std::vector<std::int16_t>& samples, unsigned int channelCount, unsigned int sampleRate)
+{
+    sf::SoundBuffer buffer;
+    REQUIRE(buffer.loadFromSamples(samples.data(), samples.size(), channelCount, sampleRate));
+    return buffer;
+}
+
+// Multiplies the samples by a constant factor and counts the resets
+class Gain : public sf::MixerEffect
+{
+public:
+    explicit Gain(float factor) : m_factor(factor)
+    {
+    }
+
+    void process(float* samples, std::size_t frameCount, unsigned int channelCount, unsigned int) override
+    {
+        for (std::size_t i = 0; i < frameCount * channelCount; ++i)
+            samples[i] *= m_factor;
+    }
+
+    void reset() override
+    {
+        ++resetCount;
+    }
+
+    int resetCount{};
+
+private:
+    float m_factor;
+};
+
+// Stream of silence whose first read blocks until it is released
+class BlockingStream : public sf::SoundStream
+{
+public:
+    BlockingStream() : m_release(release.get_future())
+    {
+        initialize(1, 44'100);
+    }
+
+    std::promise<void> decoding; // Set when the first read starts
+    std::promise<void> release;  // Set to let the first read finish
+
+protected:
+    bool onGetData(Chunk& data) override
+    {
+        if (!m_started.exchange(true))
+        {
+            decoding.set_value();
+            m_release.wait_for(std::chrono::seconds(5));
+        }
+
+        data.samples     = m_samples.data();
+        data.sampleCount = m_samples.size();
+        return true;
+    }
+
+    void onSeek(sf::Time) override
+    {
+    }
+
+private:
+    std::future<void>         m_release;
+    std::atomic<bool>         m_started{};
+    std::vector<std::int16_t> m_samples = std::vector<std::int16_t>(441);
+};
+} // namespace
+
+TEST_CASE("[Audio] sf::Mixer", runAudioDeviceTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::Mixer>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::Mixer>);
+        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::Mixer>);
+        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::Mixer>);
+        STATIC_CHECK(std::is_base_of_v<sf::SoundStream, sf::Mixer>);
+    }
+
+    // Constant mono source at half of the full scale, and stereo source at +/- a quarter of it
+    const auto mono   = makeBuffer(std::vector<std::int16_t>(1000, 16384), 1, 44'100);
+    const auto stereo = [] {
+        std::vector<std::int16_t> samples(2000);
+        for (std::size_t i = 0; i < samples.size(); ++i)
+            samples[i] = (i % 2 == 0) ? 8192 : -8192;
+        return makeBuffer(samples, 2, 44'100);
+    }();
+
+    sf::Mixer          mixer(2, 44'100);
+    std::vector<float> output(2 * 5000);
+
+    SECTION("Construction")
+    {
+        CHECK(mixer.getChannelCount() == 2);
+        CHECK(mixer.getSampleRate() == 44'100);
+        CHECK(mixer.getInputCount() == 0);
+    }
+
+    SECTION("render()")
+    {
+        SECTION("No input")
+        {
+            std::fill(output.begin(), output.end(), 1.f);
+            mixer.render(output.data(), 100);
+            CHECK(std::all_of(output.begin(), output.begin() + 200, [](float sample) { return sample == 0.f; }));
+        }
+
+        SECTION("Mono and stereo sources")
+        {
+            REQUIRE(mixer.addSound(mono));
+            REQUIRE(mixer.addSound(stereo));
+            CHECK(mixer.getInputCount() == 2);
+
+            mixer.render(output.data(), 101);
+            for (std::size_t frame = 0; frame < 101; ++frame)
+            {
+                CHECK(output[frame * 2] == Approx(0.75f));
+                CHECK(output[frame * 2 + 1] == Approx(0.25f));
+            }
+        }
+
+        SECTION("Pan ramp")
+        {
+            const auto id = mixer.addSound(mono, true);
+            REQUIRE(id);
+            mixer.setInputPan(*id, 1.f);
+
+            // The left side fades out over one block of 10 ms, the right side keeps its level
+            mixer.render(output.data(), 441);
+            for (std::size_t frame = 0; frame < 441; ++frame)
+            {
+                CHECK(output[frame * 2] == Approx(0.5f * (1.f - static_cast<float>(frame + 1) / 441.f)));
+                CHECK(output[frame * 2 + 1] == Approx(0.5f));
+            }
+
+            mixer.render(output.data(), 10);
+            CHECK(output[0] == 0.f);
+            CHECK(output[19] == Approx(0.5f));
+        }
+
+        SECTION("Volume ramp")
+        {
+            const auto id = mixer.addSound(mono, true);
+            REQUIRE(id);
+            mixer.setInputVolume(*id, 50.f);
+
+            mixer.render(output.data(), 441);
+            for (std::size_t frame = 0; frame < 441; ++frame)
+            {
+                const float expected = 0.5f * (1.f - 0.5f * static_cast<float>(frame + 1) / 441.f);
+                CHECK(output[frame * 2] == Approx(expected));
+                CHECK(output[frame * 2 + 1] == Approx(expected));
+            }
+        }
+
+        SECTION("Mono mix")
+        {
+            sf::Mixer monoMixer(1, 44'100);
+            REQUIRE(monoMixer.addSound(mono));
+            REQUIRE(monoMixer.addSound(stereo));
+
+            // The stereo source is down-mixed to silence
+            monoMixer.render(output.data(), 100);
+            CHECK(output[0] == Approx(0.5f));
+            CHECK(output[99] == Approx(0.5f));
+        }
+
+        SECTION("Resampling")
+        {
+            SECTION("Pitch")
+            {
+                // Twice as fast: the 1000 frames are consumed in 500 frames
+                const auto id = mixer.addSound(mono);
+                REQUIRE(id);
+                mixer.setInputPitch(*id, 2.f);
+
+                mixer.render(output.data(), 499);
+                CHECK(mixer.hasInput(*id));
+                CHECK(output[0] == Approx(0.5f));
+                CHECK(output[997] == Approx(0.5f));
+
+                mixer.render(output.data(), 3);
+                CHECK(!mixer.hasInput(*id));
+            }
+
+            SECTION("Sample rate")
+            {
+                // Ramps at half the sample rate of the mix are interpolated to twice as many frames
+                std::vector<std::int16_t> samples(200);
+                for (std::size_t frame = 0; frame < 100; ++frame)
+                {
+                    samples[frame * 2]     = static_cast<std::int16_t>(frame * 100);
+                    samples[frame * 2 + 1] = static_cast<std::int16_t>(-static_cast<int>(frame) * 100);
+                }
+                const auto ramp = makeBuffer(samples, 2, 22'050);
+                const auto id   = mixer.addSound(ramp);
+                REQUIRE(id);
+
+                mixer.render(output.data(), 198);
+                for (std::size_t frame = 0; frame < 198; ++frame)
+                {
+                    const float expected = static_cast<float>(frame) * 50.f / 32768.f;
+                    CHECK(output[frame * 2] == Approx(expected));
+                    CHECK(output[frame * 2 + 1] == Approx(-expected));
+                }
+                CHECK(mixer.hasInput(*id));
+
+                mixer.render(output.data(), 10);
+                CHECK(!mixer.hasInput(*id));
+            }
+        }
+
+        SECTION("End of the sounds")
+        {
+            const auto once = mixer.addSound(mono);
+            const auto loop = mixer.addSound(mono, true);
+            REQUIRE(once);
+            REQUIRE(loop);
+
+            mixer.render(output.data(), 999);
+            CHECK(mixer.hasInput(*once));
+
+            mixer.render(output.data(), 2);
+            CHECK(!mixer.hasInput(*once));
+            CHECK(mixer.getInputCount() == 1);
+
+            // The looping sound plays until it is removed
+            mixer.render(output.data(), 5000);
+            CHECK(mixer.hasInput(*loop));
+            CHECK(output[9999] == Approx(0.5f));
+
+            mixer.removeInput(*loop);
+            CHECK(mixer.getInputCount() == 0);
+        }
+
+        SECTION("Effects")
+        {
+            Gain       inputGain(0.5f);
+            Gain       outputGain(2.f);
+            const auto id = mixer.addSound(mono, true);
+            REQUIRE(id);
+            mixer.addEffect(*id, inputGain);
+            mixer.addEffect(outputGain);
+            CHECK(inputGain.resetCount == 1);
+            CHECK(outputGain.resetCount == 1);
+
+            mixer.render(output.data(), 100);
+            CHECK(output[0] == Approx(0.5f));
+            CHECK(output[199] == Approx(0.5f));
+
+            mixer.removeEffect(outputGain);
+            mixer.render(output.data(), 100);
+            CHECK(output[0] == Approx(0.25f));
+        }
+
+        SECTION("Nested mixers")
+        {
+            sf::Mixer bus(2, 44'100);
+            REQUIRE(bus.addSound(mono));
+            CHECK(!mixer.addStream(mixer));
+            const auto id = mixer.addStream(bus);
+            REQUIRE(id);
+
+            mixer.render(output.data(), 100);
+            CHECK(output[0] == Approx(0.5f));
+            CHECK(output[199] == Approx(0.5f));
+
+            // The bus keeps playing silence once its own inputs are done
+            mixer.render(output.data(), 2000);
+            CHECK(bus.getInputCount() == 0);
+            CHECK(mixer.hasInput(*id));
+            CHECK(output[3999] == 0.f);
+        }
+
+        SECTION("Setters while a stream is decoded")
+        {
+            BlockingStream stream;
+            const auto     id = mixer.addStream(stream);
+            REQUIRE(id);
+
+            std::atomic<bool> rendered{};
+            std::thread       renderer(
+                [&]
+                {
+                    mixer.render(output.data(), 100);
+                    rendered = true;
+                });
+            stream.decoding.get_future().wait();
+
+            // The stream is being decoded, the parameters of the inputs can be changed meanwhile
+            mixer.setInputVolume(*id, 50.f);
+            mixer.setInputPan(*id, 0.5f);
+            mixer.setInputPitch(*id, 2.f);
+            CHECK(mixer.hasInput(*id));
+            CHECK(mixer.getInputCount() == 1);
+            CHECK(!rendered);
+
+            stream.release.set_value();
+            renderer.join();
+            CHECK(rendered);
+        }
+    }
+}
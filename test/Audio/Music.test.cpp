@@ -1,8 +1,54 @@
 #include <SFML/Audio/Music.hpp>
 
+// Other 1st party headers
+#include <SFML/System/Time.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <AudioBenchmarkUtil.hpp>
+#include <AudioUtil.hpp>
+#include <filesystem>
+#include <string>
 #include <type_traits>
 
+#include <cstdint>
+
 static_assert(!std::is_copy_constructible_v<sf::Music>);
 static_assert(!std::is_copy_assignable_v<sf::Music>);
 static_assert(!std::is_nothrow_move_constructible_v<sf::Music>);
 static_assert(!std::is_nothrow_move_assignable_v<sf::Music>);
+
+namespace
+{
+// Give access to the refill function of sf::Music, which sf::SoundStream calls from its streaming thread
+class RefilledMusic : public sf::Music
+{
+public:
+    using sf::Music::onGetData;
+    using sf::Music::onSeek;
+};
+} // namespace
+
+TEST_CASE("[Audio] sf::Music streaming benchmark", runAudioDeviceTests() + "[.benchmark]")
+{
+    for (const std::filesystem::path& path : getBenchmarkFiles())
+    {
+        RefilledMusic music;
+        REQUIRE(music.openFromFile(path));
+
+        // Refill the stream with the whole file, as sf::SoundStream does while it plays
+        const std::string duration = std::to_string(music.getDuration().asSeconds());
+        BENCHMARK("Refill " + path.filename().string() + " (" + duration + " s of audio)")
+        {
+            music.onSeek(sf::Time::Zero);
+
+            sf::SoundStream::Chunk chunk;
+            std::uint64_t          total = 0;
+            while (music.onGetData(chunk))
+                total += chunk.sampleCount;
+
+            return total + chunk.sampleCount;
+        };
+    }
+}
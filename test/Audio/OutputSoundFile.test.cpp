@@ -1,8 +1,64 @@
 #include <SFML/Audio/OutputSoundFile.hpp>
 
+// Other 1st party headers
+#include <SFML/Audio/InputSoundFile.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <filesystem>
 #include <type_traits>
 
-static_assert(!std::is_copy_constructible_v<sf::OutputSoundFile>);
-static_assert(!std::is_copy_assignable_v<sf::OutputSoundFile>);
-static_assert(std::is_nothrow_move_constructible_v<sf::OutputSoundFile>);
-static_assert(std::is_nothrow_move_assignable_v<sf::OutputSoundFile>);
+TEST_CASE("[Audio] sf::OutputSoundFile")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::OutputSoundFile>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::OutputSoundFile>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::OutputSoundFile>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::OutputSoundFile>);
+    }
+
+    const auto filename = std::filesystem::temp_directory_path() / "sfml-output-sound-file.wav";
+
+    SECTION("write(const float*)")
+    {
+        const std::array<float, 4> samples{0.25f, -0.5f, 0.123456789f, -1.f};
+
+        SECTION("Float32")
+        {
+            {
+                sf::OutputSoundFile outputSoundFile;
+                REQUIRE(outputSoundFile.openFromFile(filename, 44'100, 2, sf::SampleFormat::Float32));
+                outputSoundFile.write(samples.data(), samples.size());
+            }
+
+            sf::InputSoundFile inputSoundFile;
+            REQUIRE(inputSoundFile.openFromFile(filename));
+            CHECK(inputSoundFile.getSampleCount() == 4);
+            CHECK(inputSoundFile.getChannelCount() == 2);
+            CHECK(inputSoundFile.getSampleRate() == 44'100);
+            std::array<float, 4> readSamples{};
+            CHECK(inputSoundFile.read(readSamples.data(), readSamples.size()) == 4);
+            CHECK(readSamples == samples);
+        }
+
+        SECTION("Int16")
+        {
+            {
+                sf::OutputSoundFile outputSoundFile;
+                REQUIRE(outputSoundFile.openFromFile(filename, 44'100, 1));
+                outputSoundFile.write(samples.data(), samples.size());
+            }
+
+            sf::InputSoundFile inputSoundFile;
+            REQUIRE(inputSoundFile.openFromFile(filename));
+            CHECK(inputSoundFile.getSampleCount() == 4);
+            std::array<std::int16_t, 4> readSamples{};
+            CHECK(inputSoundFile.read(readSamples.data(), readSamples.size()) == 4);
+            CHECK(readSamples == std::array<std::int16_t, 4>{8'192, -16'384, 4'045, -32'768});
+        }
+    }
+
+    std::filesystem::remove(filename);
+}
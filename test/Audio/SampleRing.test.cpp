@@ -0,0 +1,165 @@
+#include <SFML/Audio/SampleRing.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("[Audio] sf::priv::SampleRing")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_default_constructible_v<sf::priv::SampleRing>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::priv::SampleRing>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::priv::SampleRing>);
+    }
+
+    SECTION("Default constructor")
+    {
+        sf::priv::SampleRing        ring;
+        std::array<std::int16_t, 4> samples{};
+        CHECK(ring.getCapacity() == 0);
+        CHECK(ring.getAvailableSamples() == 0);
+        CHECK(ring.write(samples.data(), samples.size()) == 0);
+        CHECK(ring.read(samples.data(), samples.size()) == 0);
+        CHECK(ring.getOverrunCount() == 1);
+        CHECK(ring.getUnderrunCount() == 1);
+    }
+
+    SECTION("reset()")
+    {
+        sf::priv::SampleRing ring;
+
+        ring.reset(0, 1);
+        CHECK(ring.getCapacity() == 2);
+
+        ring.reset(8, 1);
+        CHECK(ring.getCapacity() == 8);
+
+        ring.reset(9, 1);
+        CHECK(ring.getCapacity() == 16);
+
+        const std::array<std::int16_t, 4> samples{1, 2, 3, 4};
+        CHECK(ring.write(samples.data(), samples.size()) == 4);
+        std::array<std::int16_t, 8> result{};
+        CHECK(ring.read(result.data(), result.size()) == 4);
+
+        ring.reset(16, 2);
+        CHECK(ring.getCapacity() == 16);
+        CHECK(ring.getAvailableSamples() == 0);
+        CHECK(ring.getOverrunCount() == 0);
+        CHECK(ring.getUnderrunCount() == 0);
+    }
+
+    SECTION("Wraparound")
+    {
+        sf::priv::SampleRing ring;
+        ring.reset(8, 1);
+
+        std::vector<std::int16_t> samples(6);
+        std::vector<std::int16_t> result(6);
+        for (int round = 0; round < 5; ++round)
+        {
+            std::iota(samples.begin(), samples.end(), static_cast<std::int16_t>(round * 6));
+            CHECK(ring.write(samples.data(), samples.size()) == 6);
+            CHECK(ring.getAvailableSamples() == 6);
+            CHECK(ring.read(result.data(), result.size()) == 6);
+            CHECK(result == samples);
+        }
+
+        CHECK(ring.getOverrunCount() == 0);
+        CHECK(ring.getUnderrunCount() == 0);
+    }
+
+    SECTION("Overrun on a full buffer")
+    {
+        sf::priv::SampleRing ring;
+        ring.reset(8, 1);
+
+        const std::vector<std::int16_t> samples{0, 1, 2, 3, 4, 5};
+        CHECK(ring.write(samples.data(), samples.size()) == 6);
+        CHECK(ring.write(samples.data(), samples.size()) == 2);
+        CHECK(ring.getOverrunCount() == 1);
+        CHECK(ring.getAvailableSamples() == 8);
+
+        CHECK(ring.write(samples.data(), samples.size()) == 0);
+        CHECK(ring.getOverrunCount() == 2);
+
+        // The oldest samples are kept, the newest ones are dropped
+        std::vector<std::int16_t> result(8);
+        CHECK(ring.read(result.data(), result.size()) == 8);
+        CHECK(result == std::vector<std::int16_t>{0, 1, 2, 3, 4, 5, 0, 1});
+    }
+
+    SECTION("Overrun keeps whole frames")
+    {
+        sf::priv::SampleRing ring;
+        ring.reset(8, 3);
+
+        const std::vector<std::int16_t> samples{0, 1, 2, 3, 4, 5};
+        CHECK(ring.write(samples.data(), samples.size()) == 6);
+        CHECK(ring.write(samples.data(), samples.size()) == 0);
+        CHECK(ring.getOverrunCount() == 1);
+        CHECK(ring.getAvailableSamples() == 6);
+    }
+
+    SECTION("Whole-frame reads")
+    {
+        sf::priv::SampleRing ring;
+        ring.reset(16, 2);
+
+        const std::vector<std::int16_t> samples{0, 1, 2, 3, 4, 5};
+        CHECK(ring.write(samples.data(), samples.size()) == 6);
+
+        std::vector<std::int16_t> result(5);
+        CHECK(ring.read(result.data(), 5) == 4);
+        CHECK(ring.getUnderrunCount() == 0);
+        CHECK(ring.read(result.data(), 1) == 0);
+        CHECK(ring.getUnderrunCount() == 0);
+        CHECK(ring.getAvailableSamples() == 2);
+        CHECK(ring.read(result.data(), 4) == 2);
+        CHECK(result[0] == 4);
+        CHECK(result[1] == 5);
+        CHECK(ring.getUnderrunCount() == 1);
+    }
+
+    SECTION("Concurrent writer and reader")
+    {
+        sf::priv::SampleRing ring;
+        ring.reset(64, 2);
+
+        constexpr std::size_t totalCount = 100'000;
+        std::thread           writer(
+            [&ring]
+            {
+                std::array<std::int16_t, 10> chunk{};
+                std::size_t                  written = 0;
+                while (written < totalCount)
+                {
+                    const std::size_t count = std::min(chunk.size(), totalCount - written);
+                    for (std::size_t i = 0; i < count; ++i)
+                        chunk[i] = static_cast<std::int16_t>(written + i);
+                    written += ring.write(chunk.data(), count);
+                }
+            });
+
+        std::vector<std::int16_t> result;
+        std::array<std::int16_t, 6> chunk{};
+        while (result.size() < totalCount)
+        {
+            const std::size_t count = ring.read(chunk.data(), chunk.size());
+            result.insert(result.end(), chunk.begin(), chunk.begin() + static_cast<std::ptrdiff_t>(count));
+        }
+        writer.join();
+
+        bool ordered = true;
+        for (std::size_t i = 0; i < result.size(); ++i)
+            ordered = ordered && (result[i] == static_cast<std::int16_t>(i));
+        CHECK(ordered);
+        CHECK(ring.getAvailableSamples() == 0);
+    }
+}
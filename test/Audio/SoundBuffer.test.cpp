@@ -1,6 +1,17 @@
 #include <SFML/Audio/SoundBuffer.hpp>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <AudioBenchmarkUtil.hpp>
+#include <AudioUtil.hpp>
+#include <algorithm>
+#include <filesystem>
 #include <type_traits>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
 
 static_assert(std::is_copy_constructible_v<sf::SoundBuffer>);
 static_assert(std::is_copy_assignable_v<sf::SoundBuffer>);
@@ -8,3 +19,126 @@ static_assert(std::is_move_constructible_v<sf::SoundBuffer>);
 static_assert(!std::is_nothrow_move_constructible_v<sf::SoundBuffer>);
 static_assert(std::is_move_assignable_v<sf::SoundBuffer>);
 static_assert(!std::is_nothrow_move_assignable_v<sf::SoundBuffer>);
+
+static_assert(std::is_aggregate_v<sf::SoundBuffer::MemoryUsage>);
+static_assert(std::is_nothrow_copy_constructible_v<sf::SoundBuffer::MemoryUsage>);
+
+TEST_CASE("[Audio] sf::SoundBuffer", runAudioDeviceTests())
+{
+    SECTION("Construction")
+    {
+        const sf::SoundBuffer soundBuffer;
+        CHECK(soundBuffer.getSamples() == nullptr);
+        CHECK(soundBuffer.getSampleCount() == 0);
+        CHECK(soundBuffer.getKeepSamples());
+    }
+
+    SECTION("Release and restore samples")
+    {
+        const auto usage = sf::SoundBuffer::getMemoryUsage();
+
+        sf::SoundBuffer soundBuffer;
+        REQUIRE(soundBuffer.loadFromFile("Audio/killdeer.wav"));
+        REQUIRE(soundBuffer.getSamples() != nullptr);
+        const std::vector<std::int16_t> samples(soundBuffer.getSamples(),
+                                                soundBuffer.getSamples() + soundBuffer.getSampleCount());
+        const std::uint64_t             sampleBytes = samples.size() * sizeof(std::int16_t);
+
+        const auto loadedUsage = sf::SoundBuffer::getMemoryUsage();
+        CHECK(loadedUsage.bufferCount == usage.bufferCount + 1);
+        CHECK(loadedUsage.sampleBytes == usage.sampleBytes + sampleBytes);
+        CHECK(loadedUsage.openAlBytes == usage.openAlBytes + sampleBytes);
+
+        soundBuffer.releaseSamples();
+        CHECK(soundBuffer.getSamples() == nullptr);
+        CHECK(soundBuffer.getSampleCount() == samples.size());
+        CHECK(sf::SoundBuffer::getMemoryUsage().sampleBytes == usage.sampleBytes);
+        CHECK(sf::SoundBuffer::getMemoryUsage().openAlBytes == loadedUsage.openAlBytes);
+
+        SECTION("restoreSamples()")
+        {
+            REQUIRE(soundBuffer.restoreSamples());
+            REQUIRE(soundBuffer.getSamples() != nullptr);
+            CHECK(std::equal(samples.begin(), samples.end(), soundBuffer.getSamples()));
+            CHECK(sf::SoundBuffer::getMemoryUsage().sampleBytes == loadedUsage.sampleBytes);
+        }
+
+        SECTION("Copies restore the released samples")
+        {
+            const sf::SoundBuffer copy(soundBuffer);
+            REQUIRE(copy.getSamples() != nullptr);
+            CHECK(std::equal(samples.begin(), samples.end(), copy.getSamples()));
+        }
+
+        SECTION("Failed reload")
+        {
+            // The buffer keeps its previous sound, which can still be restored
+            CHECK(!soundBuffer.loadFromFile("does/not/exist.wav"));
+            const std::byte garbage[16]{};
+            CHECK(!soundBuffer.loadFromMemory(garbage, sizeof(garbage)));
+            CHECK(soundBuffer.getSampleCount() == samples.size());
+            REQUIRE(soundBuffer.restoreSamples());
+            CHECK(std::equal(samples.begin(), samples.end(), soundBuffer.getSamples()));
+        }
+
+        SECTION("Changed source file")
+        {
+            const auto filename = std::filesystem::temp_directory_path() / "sfml-sound-buffer-source.wav";
+            std::filesystem::copy_file("Audio/killdeer.wav",
+                                       filename,
+                                       std::filesystem::copy_options::overwrite_existing);
+
+            REQUIRE(soundBuffer.loadFromFile(filename));
+            soundBuffer.releaseSamples();
+
+            // Same samples at another sample rate
+            sf::SoundBuffer other;
+            REQUIRE(other.loadFromSamples(samples.data(), samples.size(), soundBuffer.getChannelCount(), 8000));
+            REQUIRE(other.saveToFile(filename));
+
+            CHECK(!soundBuffer.restoreSamples());
+            CHECK(soundBuffer.getSamples() == nullptr);
+            std::filesystem::remove(filename);
+        }
+    }
+
+    SECTION("setKeepSamples()")
+    {
+        sf::SoundBuffer soundBuffer;
+        soundBuffer.setKeepSamples(false);
+        CHECK(!soundBuffer.getKeepSamples());
+
+        // The samples are dropped as soon as OpenAL has its own copy
+        REQUIRE(soundBuffer.loadFromFile("Audio/killdeer.wav"));
+        CHECK(soundBuffer.getSamples() == nullptr);
+        CHECK(soundBuffer.getSampleCount() > 0);
+        REQUIRE(soundBuffer.restoreSamples());
+        CHECK(soundBuffer.getSamples() != nullptr);
+
+        soundBuffer.setKeepSamples(true);
+        CHECK(soundBuffer.getKeepSamples());
+    }
+
+    SECTION("Samples without source file can't be restored")
+    {
+        const std::vector<std::int16_t> samples(1000, 1234);
+        sf::SoundBuffer                 soundBuffer;
+        REQUIRE(soundBuffer.loadFromSamples(samples.data(), samples.size(), 1, 44'100));
+        soundBuffer.releaseSamples();
+        CHECK(!soundBuffer.restoreSamples());
+        CHECK(soundBuffer.getSamples() == nullptr);
+    }
+}
+
+TEST_CASE("[Audio] sf::SoundBuffer loading benchmark", runAudioDeviceTests() + "[.benchmark]")
+{
+    for (const std::filesystem::path& path : getBenchmarkFiles())
+    {
+        BENCHMARK("loadFromFile " + path.filename().string())
+        {
+            sf::SoundBuffer buffer;
+            REQUIRE(buffer.loadFromFile(path));
+            return buffer.getSampleCount();
+        };
+    }
+}
@@ -0,0 +1,193 @@
+#include <SFML/Audio/SoundBufferCache.hpp>
+
+// Other 1st party headers
+#include <SFML/Audio/SoundBuffer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <AudioUtil.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+std::vector<char> loadIntoMemory(const std::filesystem::path& filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    REQUIRE(file);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+} // namespace
+
+TEST_CASE("[Audio] sf::SoundBufferCache")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::SoundBufferCache>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::SoundBufferCache>);
+        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::SoundBufferCache>);
+        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::SoundBufferCache>);
+
+        STATIC_CHECK(std::is_copy_constructible_v<sf::SoundBufferCache::Handle>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::SoundBufferCache::Handle>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::SoundBufferCache::Handle>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::SoundBufferCache::Handle>);
+        STATIC_CHECK(!std::is_convertible_v<sf::SoundBufferCache::Handle, bool>);
+    }
+
+    SECTION("Default handle")
+    {
+        const sf::SoundBufferCache::Handle handle;
+        CHECK(!handle);
+        CHECK(handle.getStatus() == sf::SoundBufferCache::Status::Failed);
+        CHECK(handle.wait() == sf::SoundBufferCache::Status::Failed);
+        CHECK(handle.get() == nullptr);
+    }
+
+    SECTION("Invalid file in memory")
+    {
+        sf::SoundBufferCache cache;
+        const char           payload[] = "not a sound file";
+
+        const sf::SoundBufferCache::Handle handle = cache.loadFromMemory(payload, sizeof(payload));
+        CHECK(handle);
+        CHECK(handle.wait() == sf::SoundBufferCache::Status::Failed);
+        CHECK(handle.get() == nullptr);
+
+        // A failed sound buffer is loaded again rather than shared
+        const sf::SoundBufferCache::Handle retry = cache.loadFromMemory(payload, sizeof(payload));
+        CHECK(retry.wait() == sf::SoundBufferCache::Status::Failed);
+        CHECK(handle.getStatus() == sf::SoundBufferCache::Status::Failed);
+        CHECK(cache.getBufferCount() == 1);
+    }
+}
+
+TEST_CASE("[Audio] sf::SoundBufferCache loading", runAudioDeviceTests())
+{
+    sf::SoundBufferCache cache(2);
+
+    SECTION("loadFromFile()")
+    {
+        SECTION("Same path")
+        {
+            const sf::SoundBufferCache::Handle first  = cache.loadFromFile("Audio/killdeer.wav");
+            const sf::SoundBufferCache::Handle second = cache.loadFromFile("./Audio/../Audio/killdeer.wav");
+            REQUIRE(first.wait() == sf::SoundBufferCache::Status::Ready);
+            REQUIRE(second.wait() == sf::SoundBufferCache::Status::Ready);
+            CHECK(first.get() == second.get());
+            CHECK(first.get()->getSampleCount() == 112'941);
+            CHECK(cache.getBufferCount() == 1);
+        }
+
+        SECTION("Different paths")
+        {
+            const sf::SoundBufferCache::Handle first  = cache.loadFromFile("Audio/killdeer.wav");
+            const sf::SoundBufferCache::Handle second = cache.loadFromFile("Audio/ding.mp3");
+            REQUIRE(first.wait() == sf::SoundBufferCache::Status::Ready);
+            REQUIRE(second.wait() == sf::SoundBufferCache::Status::Ready);
+            CHECK(first.get() != second.get());
+            CHECK(cache.getBufferCount() == 2);
+        }
+
+        SECTION("Retry after a failure")
+        {
+            const std::filesystem::path filename = std::filesystem::temp_directory_path() /
+                                                   "sfml_sound_buffer_cache.wav";
+            std::filesystem::remove(filename);
+
+            const sf::SoundBufferCache::Handle missing = cache.loadFromFile(filename);
+            CHECK(missing.wait() == sf::SoundBufferCache::Status::Failed);
+
+            // The file appears later, the next request loads it
+            std::filesystem::copy_file("Audio/killdeer.wav", filename);
+            const sf::SoundBufferCache::Handle retry = cache.loadFromFile(filename);
+            CHECK(retry.wait() == sf::SoundBufferCache::Status::Ready);
+            CHECK(missing.getStatus() == sf::SoundBufferCache::Status::Failed);
+            CHECK(missing.get() == nullptr);
+
+            std::filesystem::remove(filename);
+        }
+    }
+
+    SECTION("loadFromMemory()")
+    {
+        std::vector<char> contents = loadIntoMemory("Audio/killdeer.wav");
+
+        SECTION("Same contents")
+        {
+            const sf::SoundBufferCache::Handle first = cache.loadFromMemory(contents.data(), contents.size());
+            REQUIRE(first.wait() == sf::SoundBufferCache::Status::Ready);
+
+            // The contents are still recognized once the cache has released its copy, and from another address
+            const std::vector<char>            copy   = contents;
+            const sf::SoundBufferCache::Handle second = cache.loadFromMemory(copy.data(), copy.size());
+            CHECK(second.getStatus() == sf::SoundBufferCache::Status::Ready);
+            CHECK(first.get() == second.get());
+            CHECK(cache.getBufferCount() == 1);
+        }
+
+        SECTION("Contents of the same size")
+        {
+            const sf::SoundBufferCache::Handle first = cache.loadFromMemory(contents.data(), contents.size());
+            REQUIRE(first.wait() == sf::SoundBufferCache::Status::Ready);
+
+            // A single different byte is enough to get another sound buffer
+            contents.back() ^= 1;
+            const sf::SoundBufferCache::Handle second = cache.loadFromMemory(contents.data(), contents.size());
+            REQUIRE(second.wait() == sf::SoundBufferCache::Status::Ready);
+            CHECK(first.get() != second.get());
+            CHECK(cache.getBufferCount() == 2);
+        }
+
+        SECTION("Same contents as a file")
+        {
+            // Files in memory are not matched with the files on disk
+            const sf::SoundBufferCache::Handle file   = cache.loadFromFile("Audio/killdeer.wav");
+            const sf::SoundBufferCache::Handle memory = cache.loadFromMemory(contents.data(), contents.size());
+            REQUIRE(file.wait() == sf::SoundBufferCache::Status::Ready);
+            REQUIRE(memory.wait() == sf::SoundBufferCache::Status::Ready);
+            CHECK(file.get() != memory.get());
+        }
+    }
+
+    SECTION("Expired sound buffers")
+    {
+        {
+            const sf::SoundBufferCache::Handle handle = cache.loadFromFile("Audio/ding.mp3");
+            REQUIRE(handle.wait() == sf::SoundBufferCache::Status::Ready);
+        }
+        CHECK(cache.getBufferCount() == 0);
+
+        // Enough requests to purge the expired entries
+        std::vector<sf::SoundBufferCache::Handle> handles;
+        for (char i = 0; i < 100; ++i)
+            handles.push_back(cache.loadFromMemory(&i, 1));
+        for (const sf::SoundBufferCache::Handle& handle : handles)
+            CHECK(handle.wait() == sf::SoundBufferCache::Status::Failed);
+        CHECK(cache.getBufferCount() == 100);
+
+        // The sound buffer was destroyed with its last handle, it is loaded again
+        handles.clear();
+        CHECK(cache.getBufferCount() == 0);
+        const sf::SoundBufferCache::Handle handle = cache.loadFromFile("Audio/ding.mp3");
+        CHECK(handle.wait() == sf::SoundBufferCache::Status::Ready);
+        CHECK(cache.getBufferCount() == 1);
+    }
+
+    SECTION("Destruction of the cache before the handles")
+    {
+        std::vector<sf::SoundBufferCache::Handle> handles;
+        {
+            sf::SoundBufferCache other(1);
+            for (int i = 0; i < 20; ++i)
+                handles.push_back(other.loadFromFile((i % 2 == 0) ? "Audio/killdeer.wav" : "Audio/ding.mp3"));
+        }
+
+        for (const sf::SoundBufferCache::Handle& handle : handles)
+            CHECK(handle.getStatus() != sf::SoundBufferCache::Status::Loading);
+        CHECK(handles[0].get() == handles[2].get());
+    }
+}
@@ -0,0 +1,9 @@
+#include <SFML/Audio/SoundRingRecorder.hpp>
+
+#include <type_traits>
+
+static_assert(std::is_default_constructible_v<sf::SoundRingRecorder>);
+static_assert(!std::is_copy_constructible_v<sf::SoundRingRecorder>);
+static_assert(!std::is_copy_assignable_v<sf::SoundRingRecorder>);
+static_assert(!std::is_nothrow_move_constructible_v<sf::SoundRingRecorder>);
+static_assert(!std::is_nothrow_move_assignable_v<sf::SoundRingRecorder>);
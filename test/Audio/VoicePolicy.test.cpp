@@ -0,0 +1,174 @@
+#include <SFML/Audio/VoicePolicy.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <SystemUtil.hpp>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("[Audio] sf::priv::VoicePolicy")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_aggregate_v<sf::priv::VoiceRank>);
+        STATIC_CHECK(std::is_aggregate_v<sf::priv::VoiceSwap>);
+    }
+
+    SECTION("computeAudibility()")
+    {
+        SECTION("Inside the minimum distance")
+        {
+            CHECK(sf::priv::computeAudibility({0, 0, 0}, 80.f, 1.f, 1.f, 100.f) == 80.f);
+            CHECK(sf::priv::computeAudibility({0.5f, 0, 0}, 80.f, 1.f, 1.f, 100.f) == 80.f);
+        }
+
+        SECTION("Attenuated with the distance")
+        {
+            CHECK(sf::priv::computeAudibility({3, 0, 0}, 100.f, 1.f, 1.f, 100.f) == Approx(100.f / 3.f));
+            CHECK(sf::priv::computeAudibility({0, 3, 0}, 100.f, 1.f, 0.5f, 100.f) == Approx(50.f));
+            CHECK(sf::priv::computeAudibility({0, 0, 3}, 100.f, 1.f, 0.f, 100.f) == 100.f);
+        }
+
+        SECTION("Culled beyond the cull distance")
+        {
+            CHECK(sf::priv::computeAudibility({10, 0, 0}, 100.f, 1.f, 1.f, 10.f) >= 0.f);
+            CHECK(sf::priv::computeAudibility({10.5f, 0, 0}, 100.f, 1.f, 1.f, 10.f) < 0.f);
+            CHECK(sf::priv::computeAudibility({0, 0, -11}, 100.f, 1.f, 0.f, 10.f) < 0.f);
+        }
+
+        SECTION("Silent sound")
+        {
+            CHECK(sf::priv::computeAudibility({2, 0, 0}, 0.f, 1.f, 1.f, 10.f) == 0.f);
+        }
+    }
+
+    SECTION("isQuieter()")
+    {
+        const sf::priv::VoiceRank culled{10, -1.f};
+        const sf::priv::VoiceRank loud{0, 100.f};
+        const sf::priv::VoiceRank quiet{0, 10.f};
+        const sf::priv::VoiceRank important{1, 1.f};
+
+        SECTION("Culled sounds come first")
+        {
+            CHECK(sf::priv::isQuieter(culled, quiet));
+            CHECK(!sf::priv::isQuieter(quiet, culled));
+            CHECK(sf::priv::isQuieter(culled, sf::priv::VoiceRank{-10, 0.f}));
+        }
+
+        SECTION("Priority comes before audibility")
+        {
+            CHECK(sf::priv::isQuieter(loud, important));
+            CHECK(!sf::priv::isQuieter(important, loud));
+        }
+
+        SECTION("Audibility breaks ties")
+        {
+            CHECK(sf::priv::isQuieter(quiet, loud));
+            CHECK(!sf::priv::isQuieter(loud, quiet));
+            CHECK(!sf::priv::isQuieter(loud, loud));
+        }
+    }
+
+    SECTION("planVoiceSwaps()")
+    {
+        SECTION("No active voice")
+        {
+            CHECK(sf::priv::planVoiceSwaps({}, {{0, 100.f}}).empty());
+        }
+
+        SECTION("No waiting sound")
+        {
+            CHECK(sf::priv::planVoiceSwaps({{0, 1.f}}, {}).empty());
+        }
+
+        SECTION("Louder sounds steal the quietest voices")
+        {
+            const std::vector<sf::priv::VoiceRank> active{{0, 50.f}, {0, 10.f}, {0, 30.f}};
+            const std::vector<sf::priv::VoiceRank> waiting{{0, 40.f}, {0, 35.f}, {0, 5.f}};
+
+            const auto swaps = sf::priv::planVoiceSwaps(active, waiting);
+            REQUIRE(swaps.size() == 2);
+            CHECK(swaps[0].waiting == 0);
+            CHECK(swaps[0].active == 1);
+            CHECK(swaps[1].waiting == 1);
+            CHECK(swaps[1].active == 2);
+        }
+
+        SECTION("Priority protects active voices")
+        {
+            const std::vector<sf::priv::VoiceRank> active{{1, 1.f}, {0, 10.f}};
+            const std::vector<sf::priv::VoiceRank> waiting{{0, 100.f}, {0, 90.f}};
+
+            const auto swaps = sf::priv::planVoiceSwaps(active, waiting);
+            REQUIRE(swaps.size() == 1);
+            CHECK(swaps[0].waiting == 0);
+            CHECK(swaps[0].active == 1);
+        }
+
+        SECTION("Culled sounds never steal")
+        {
+            const std::vector<sf::priv::VoiceRank> active{{0, 1.f}};
+            CHECK(sf::priv::planVoiceSwaps(active, {{10, -1.f}}).empty());
+        }
+
+        SECTION("Culled active sounds lose their voice first")
+        {
+            const std::vector<sf::priv::VoiceRank> active{{0, 20.f}, {5, -1.f}};
+
+            const auto swaps = sf::priv::planVoiceSwaps(active, {{0, 1.f}});
+            REQUIRE(swaps.size() == 1);
+            CHECK(swaps[0].active == 1);
+        }
+
+        SECTION("Promoted sounds keep their voice")
+        {
+            const std::vector<sf::priv::VoiceRank> active{{0, 1.f}};
+
+            const auto swaps = sf::priv::planVoiceSwaps(active, {{0, 50.f}, {0, 50.f}, {0, 40.f}});
+            REQUIRE(swaps.size() == 1);
+            CHECK(swaps[0].waiting == 0);
+        }
+    }
+
+    SECTION("computeVirtualOffset()")
+    {
+        SECTION("Not playing")
+        {
+            CHECK(sf::priv::computeVirtualOffset(sf::seconds(1), sf::Time::Zero, 1.f, sf::seconds(3), false) ==
+                  sf::seconds(1));
+        }
+
+        SECTION("Elapsed time scaled by the pitch")
+        {
+            CHECK(sf::priv::computeVirtualOffset(sf::seconds(1), sf::seconds(1), 1.f, sf::seconds(10), false) ==
+                  sf::seconds(2));
+            CHECK(sf::priv::computeVirtualOffset(sf::seconds(1), sf::seconds(1), 2.f, sf::seconds(10), false) ==
+                  sf::seconds(3));
+            CHECK(sf::priv::computeVirtualOffset(sf::Time::Zero, sf::seconds(2), 0.5f, sf::seconds(10), false) ==
+                  sf::seconds(1));
+        }
+
+        SECTION("Non-looping sounds run past their end")
+        {
+            CHECK(sf::priv::computeVirtualOffset(sf::seconds(2), sf::seconds(3), 1.f, sf::seconds(4), false) ==
+                  sf::seconds(5));
+        }
+
+        SECTION("Looping sounds wrap around")
+        {
+            CHECK(sf::priv::computeVirtualOffset(sf::seconds(2), sf::seconds(3), 1.f, sf::seconds(4), true) ==
+                  sf::seconds(1));
+            CHECK(sf::priv::computeVirtualOffset(sf::seconds(1), sf::seconds(4), 2.f, sf::seconds(4), true) ==
+                  sf::seconds(1));
+            CHECK(sf::priv::computeVirtualOffset(sf::seconds(1), sf::seconds(3), 1.f, sf::seconds(4), true) ==
+                  sf::Time::Zero);
+        }
+
+        SECTION("Empty looping sound")
+        {
+            CHECK(sf::priv::computeVirtualOffset(sf::seconds(1), sf::seconds(1), 1.f, sf::Time::Zero, true) ==
+                  sf::seconds(2));
+        }
+    }
+}
@@ -0,0 +1,132 @@
+#include <SFML/Audio/VoicePool.hpp>
+
+// Other 1st party headers
+#include <SFML/Audio/Sound.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <AudioUtil.hpp>
+#include <type_traits>
+#include <vector>
+
+#include <cstdint>
+
+static_assert(std::is_aggregate_v<sf::VoicePool::Statistics>);
+static_assert(std::is_nothrow_copy_constructible_v<sf::VoicePool::Statistics>);
+
+TEST_CASE("[Audio] sf::VoicePool", runAudioDeviceTests())
+{
+    // Ten seconds of silence, so that the sounds don't end during the test
+    const std::vector<std::int16_t> samples(441'000);
+    sf::SoundBuffer                 buffer;
+    REQUIRE(buffer.loadFromSamples(samples.data(), samples.size(), 1, 44'100));
+
+    sf::VoicePool::setMaxVoices(2);
+    CHECK(sf::VoicePool::getMaxVoices() == 2);
+    const std::uint64_t stolenVoices = sf::VoicePool::getStatistics().stolenVoices;
+
+    sf::Sound first(buffer);
+    sf::Sound second(buffer);
+    sf::Sound third(buffer);
+
+    SECTION("Voice limit")
+    {
+        first.play();
+        second.play();
+        third.play();
+
+        const auto statistics = sf::VoicePool::getStatistics();
+        CHECK(statistics.activeVoices == 2);
+        CHECK(statistics.virtualVoices == 1);
+        CHECK(statistics.sourceCount <= 2);
+        CHECK(statistics.stolenVoices == stolenVoices);
+        CHECK(third.getStatus() == sf::Sound::Playing);
+
+        // The virtual sound gets the voice of a sound that stops
+        first.stop();
+        CHECK(sf::VoicePool::getStatistics().activeVoices == 2);
+        CHECK(sf::VoicePool::getStatistics().virtualVoices == 0);
+    }
+
+    SECTION("Priority stealing")
+    {
+        sf::VoicePool::setMaxVoices(1);
+        first.play();
+
+        // A sound with a higher priority takes the voice
+        second.setPriority(10);
+        second.play();
+        CHECK(sf::VoicePool::getStatistics().stolenVoices == stolenVoices + 1);
+        CHECK(sf::VoicePool::getStatistics().activeVoices == 1);
+        CHECK(sf::VoicePool::getStatistics().virtualVoices == 1);
+        CHECK(first.getStatus() == sf::Sound::Playing);
+
+        // It keeps it against sounds with a lower priority, which would have taken it from the first sound
+        third.setPriority(5);
+        third.play();
+        CHECK(sf::VoicePool::getStatistics().stolenVoices == stolenVoices + 1);
+        CHECK(sf::VoicePool::getStatistics().virtualVoices == 2);
+
+        // update() moves the voice to the most important virtual sound once the priorities change
+        third.setPriority(20);
+        sf::VoicePool::update();
+        CHECK(sf::VoicePool::getStatistics().stolenVoices == stolenVoices + 2);
+        CHECK(sf::VoicePool::getStatistics().activeVoices == 1);
+        CHECK(sf::VoicePool::getStatistics().virtualVoices == 2);
+    }
+
+    SECTION("Restarting a stolen sound")
+    {
+        sf::VoicePool::setMaxVoices(1);
+        first.play();
+        second.setPriority(10);
+        second.play();
+        REQUIRE(sf::VoicePool::getStatistics().virtualVoices == 1);
+
+        // The sound that lost its voice gets it back when the other one stops
+        second.stop();
+        CHECK(sf::VoicePool::getStatistics().activeVoices == 1);
+        CHECK(sf::VoicePool::getStatistics().virtualVoices == 0);
+        CHECK(first.getStatus() == sf::Sound::Playing);
+
+        // A virtual sound can be stopped, and restarted with a priority high enough to steal the voice back
+        second.play();
+        CHECK(sf::VoicePool::getStatistics().stolenVoices == stolenVoices + 2);
+        first.stop();
+        CHECK(first.getStatus() == sf::Sound::Stopped);
+        CHECK(sf::VoicePool::getStatistics().virtualVoices == 0);
+
+        first.setPriority(30);
+        first.play();
+        CHECK(sf::VoicePool::getStatistics().activeVoices == 1);
+        CHECK(sf::VoicePool::getStatistics().virtualVoices == 1);
+        CHECK(sf::VoicePool::getStatistics().stolenVoices == stolenVoices + 3);
+        CHECK(first.getStatus() == sf::Sound::Playing);
+        CHECK(second.getStatus() == sf::Sound::Playing);
+    }
+
+    SECTION("Culling")
+    {
+        first.setCullDistance(100.f);
+        first.play();
+        CHECK(sf::VoicePool::getStatistics().activeVoices == 1);
+
+        // update() takes the voice back from sounds that move beyond their cull distance
+        first.setPosition({1000.f, 0.f, 0.f});
+        sf::VoicePool::update();
+        CHECK(sf::VoicePool::getStatistics().activeVoices == 0);
+        CHECK(sf::VoicePool::getStatistics().virtualVoices == 1);
+        CHECK(first.getStatus() == sf::Sound::Playing);
+
+        first.setPosition({});
+        sf::VoicePool::update();
+        CHECK(sf::VoicePool::getStatistics().activeVoices == 1);
+        CHECK(sf::VoicePool::getStatistics().virtualVoices == 0);
+    }
+
+    first.stop();
+    second.stop();
+    third.stop();
+    sf::VoicePool::setMaxVoices(64);
+}
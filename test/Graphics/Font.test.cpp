@@ -1,16 +1,21 @@
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
 // Other 1st party headers
 #include <SFML/System/FileInputStream.hpp>
+#include <SFML/System/String.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
 #include <WindowUtil.hpp>
 #include <fstream>
+#include <string>
 #include <type_traits>
 
+#include <cstring>
+
 TEST_CASE("[Graphics] sf::Font", runDisplayTests())
 {
     SECTION("Type traits")
@@ -155,6 +160,139 @@ TEST_CASE("[Graphics] sf::Font", runDisplayTests())
         }
     }
 
+    SECTION("saveAtlasToMemory()/loadAtlasFromMemory()")
+    {
+        sf::Font font;
+
+        SECTION("Invalid data")
+        {
+            CHECK(!font.saveAtlasToMemory());
+            CHECK(!font.loadAtlasFromMemory(nullptr, 1));
+            const std::byte testByte{0xCD};
+            CHECK(!font.loadAtlasFromMemory(&testByte, 1));
+        }
+
+        SECTION("Successful round trip")
+        {
+            REQUIRE(font.loadFromFile("Graphics/tuffy.ttf"));
+            const auto expectedGlyph       = font.getGlyph(0x45, 16, false);
+            const auto expectedKerning     = font.getKerning(0x41, 0x56, 12);
+            const auto expectedBoldKerning = font.getKerning(0x43, 0x44, 24, true);
+
+            const auto atlas = font.saveAtlasToMemory();
+            REQUIRE(atlas);
+
+            sf::Font atlasFont;
+            REQUIRE(atlasFont.loadAtlasFromMemory(atlas->data(), atlas->size()));
+            CHECK(atlasFont.getInfo().family == "Tuffy");
+            const auto& glyph = atlasFont.getGlyph(0x45, 16, false);
+            CHECK(glyph.advance == expectedGlyph.advance);
+            CHECK(glyph.lsbDelta == expectedGlyph.lsbDelta);
+            CHECK(glyph.rsbDelta == expectedGlyph.rsbDelta);
+            CHECK(glyph.bounds == expectedGlyph.bounds);
+            CHECK(glyph.textureRect == expectedGlyph.textureRect);
+            CHECK(atlasFont.hasGlyph(0x41));
+            CHECK(!atlasFont.hasGlyph(0xC0));
+            CHECK(atlasFont.getKerning(0x41, 0x56, 12) == expectedKerning);
+            CHECK(atlasFont.getKerning(0x43, 0x44, 24, true) == expectedBoldKerning);
+            CHECK(atlasFont.getLineSpacing(24) == font.getLineSpacing(24));
+            CHECK(atlasFont.getUnderlinePosition(16) == font.getUnderlinePosition(16));
+            CHECK(atlasFont.getUnderlineThickness(16) == font.getUnderlineThickness(16));
+            CHECK(atlasFont.getLineSpacing(48) == 0);
+            CHECK(atlasFont.getTexture(16).getSize() == font.getTexture(16).getSize());
+            CHECK(atlasFont.getTexture(16).copyToImage().getPixel({2, 5}) ==
+                  font.getTexture(16).copyToImage().getPixel({2, 5}));
+        }
+    }
+
+    SECTION("Distance field")
+    {
+        sf::Font font;
+        CHECK(!font.isDistanceFieldEnabled());
+
+        REQUIRE(font.loadFromFile("Graphics/tuffy.ttf"));
+        font.setDistanceFieldEnabled(true);
+        CHECK(font.isDistanceFieldEnabled());
+
+        const auto small = font.getGlyph(0x45, 12, false);
+        const auto large = font.getGlyph(0x45, 96, false);
+        CHECK(small.textureRect == large.textureRect);
+        CHECK(large.bounds.width == Approx(small.bounds.width * 8));
+        CHECK(large.advance == Approx(small.advance * 8));
+        CHECK(font.getGlyph(0x45, 12, true).advance == Approx(small.advance + 1));
+        CHECK(font.getGlyph(0x45, 12, false, 2).textureRect == small.textureRect);
+        CHECK(&font.getTexture(12) == &font.getTexture(96));
+        CHECK(font.getTexture(12).isSmooth());
+
+        font.setDistanceFieldEnabled(false);
+        CHECK(!font.isDistanceFieldEnabled());
+        CHECK(&font.getTexture(12) != &font.getTexture(96));
+    }
+
+    SECTION("Distance field kerning")
+    {
+        // Loading the glyphs at the reference size must not change the kerning
+        sf::Font cold;
+        REQUIRE(cold.loadFromFile("Graphics/tuffy.ttf"));
+        cold.setDistanceFieldEnabled(true);
+        const float kerning = cold.getKerning(0x41, 0x56, 12);
+
+        sf::Font warm;
+        REQUIRE(warm.loadFromFile("Graphics/tuffy.ttf"));
+        warm.setDistanceFieldEnabled(true);
+        CHECK(warm.getGlyph(0x41, 12, false).advance > 0);
+        CHECK(warm.getGlyph(0x56, 12, false).advance > 0);
+        CHECK(warm.getKerning(0x41, 0x56, 12) == kerning);
+        CHECK(cold.getKerning(0x41, 0x56, 12) == kerning);
+    }
+
+    SECTION("Glyph and kerning caches")
+    {
+        sf::Font font;
+        REQUIRE(font.loadFromFile("Graphics/tuffy.ttf"));
+
+        const sf::Glyph& glyph = font.getGlyph(U'A', 24, false);
+        CHECK(&font.getGlyph(U'A', 24, false) == &glyph);
+        CHECK(&font.getGlyph(U'A', 24, true) != &glyph);
+        CHECK(font.getGlyph(U'A', 24, false, 1).textureRect != font.getGlyph(U'A', 24, false, 2).textureRect);
+        CHECK(font.getGlyph(U'A', 24, false, 1).textureRect == font.getGlyph(U'A', 24, false, 1).textureRect);
+        CHECK(font.getKerning(U'A', U'V', 24) == font.getKerning(U'A', U'V', 24));
+
+        // Copies don't reference the glyphs of the original font
+        const sf::Glyph expected = glyph;
+        const sf::Font  copy(font);
+        font = sf::Font();
+        CHECK(copy.getGlyph(U'A', 24, false).textureRect == expected.textureRect);
+        CHECK(copy.getGlyph(U'A', 24, false).advance == expected.advance);
+    }
+
+    SECTION("preload()")
+    {
+        sf::Font font;
+        CHECK(!font.preload("Hello", {12}));
+
+        REQUIRE(font.loadFromFile("Graphics/tuffy.ttf"));
+        CHECK(font.preload("Hello", {12, 24}, false, 0, 4));
+        CHECK(font.preload(U'a', U'f', {12}));
+
+        sf::Font lazyFont;
+        REQUIRE(lazyFont.loadFromFile("Graphics/tuffy.ttf"));
+        for (const char32_t character : std::u32string(U"Helo"))
+        {
+            const auto& glyph     = font.getGlyph(character, 24, false);
+            const auto& lazyGlyph = lazyFont.getGlyph(character, 24, false);
+            CHECK(glyph.textureRect == lazyGlyph.textureRect);
+            CHECK(glyph.bounds == lazyGlyph.bounds);
+            CHECK(glyph.advance == lazyGlyph.advance);
+        }
+
+        const sf::Image image     = font.getTexture(24).copyToImage();
+        const sf::Image lazyImage = lazyFont.getTexture(24).copyToImage();
+        const sf::Vector2u size      = image.getSize();
+        REQUIRE(size == lazyImage.getSize());
+        CHECK(std::memcmp(image.getPixelsPtr(), lazyImage.getPixelsPtr(), size.x * size.y * 4) == 0);
+    }
+
     SECTION("Set/get smooth")
     {
         sf::Font font;
@@ -3,6 +3,7 @@
 // Other 1st party headers
 #include <SFML/Graphics/Font.hpp>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
@@ -202,3 +203,55 @@ TEST_CASE("[Graphics] sf::Text", runDisplayTests())
         }
     }
 }
+
+TEST_CASE("[Graphics] sf::Text layout benchmark", "[.benchmark]")
+{
+    sf::Font font;
+    REQUIRE(font.loadFromFile("Graphics/tuffy.ttf"));
+
+    // 10k characters long strings, made of lines of about 80 characters
+    const auto makeString = [](const sf::String& sentence)
+    {
+        sf::String string;
+        while (string.getSize() < 10'000)
+            string += sentence + (string.getSize() % 80 < sentence.getSize() ? U"\n" : U" ");
+        return string.substring(0, 10'000);
+    };
+
+    const sf::String ascii    = makeString(U"The quick brown fox jumps over the lazy dog.");
+    const sf::String latin1   = makeString(U"Voix ambigu\u00EB d'un c\u0153ur qui, au z\u00E9phyr pr\u00E9f\u00E8re.");
+    const sf::String cyrillic = makeString(U"\u0421\u044A\u0435\u0448\u044C \u0436\u0435 "
+                                           U"\u0435\u0449\u0451 \u044D\u0442\u0438\u0445");
+
+    // Text only lays its string out when it changes, alternate between
+    // the string and an empty one to force a new layout on every run
+    sf::Text   text(font, "", 16);
+    const auto layout = [&text](const sf::String& string)
+    {
+        text.setString(string);
+        const sf::FloatRect bounds = text.getLocalBounds();
+        text.setString("");
+        return bounds;
+    };
+
+    BENCHMARK("ASCII")
+    {
+        return layout(ascii);
+    };
+
+    BENCHMARK("Latin-1")
+    {
+        return layout(latin1);
+    };
+
+    BENCHMARK("Cyrillic")
+    {
+        return layout(cyrillic);
+    };
+
+    text.setOutlineThickness(1);
+    BENCHMARK("ASCII, outlined")
+    {
+        return layout(ascii);
+    };
+}
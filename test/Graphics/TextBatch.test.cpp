@@ -0,0 +1,191 @@
+#include <SFML/Graphics/TextBatch.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Text.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+#include <cstring>
+
+TEST_CASE("[Graphics] sf::TextBatch", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_constructible_v<sf::TextBatch, sf::Font&&, unsigned int>);
+        STATIC_CHECK(std::is_copy_constructible_v<sf::TextBatch>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::TextBatch>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::TextBatch>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::TextBatch>);
+    }
+
+    sf::Font font;
+    REQUIRE(font.loadFromFile("Graphics/tuffy.ttf"));
+
+    SECTION("Construction")
+    {
+        const sf::TextBatch batch(font, 24);
+        CHECK(&batch.getFont() == &font);
+        CHECK(batch.getCharacterSize() == 24);
+        CHECK(batch.getOutlineThickness() == 0);
+        CHECK(batch.getStringCount() == 0);
+    }
+
+    SECTION("Add/remove strings")
+    {
+        sf::TextBatch     batch(font, 24);
+        const std::size_t first  = batch.add("first", {10, 20});
+        const std::size_t second = batch.add("second", {30, 40}, sf::Color::Red, sf::Text::Bold);
+        CHECK(first != second);
+        CHECK(batch.getStringCount() == 2);
+        CHECK(batch.getString(first) == "first");
+        CHECK(batch.getStringPosition(first) == sf::Vector2f(10, 20));
+        CHECK(batch.getStringFillColor(first) == sf::Color::White);
+        CHECK(batch.getStringOutlineColor(first) == sf::Color::Black);
+        CHECK(batch.getStringStyle(first) == sf::Text::Regular);
+        CHECK(batch.getString(second) == "second");
+        CHECK(batch.getStringFillColor(second) == sf::Color::Red);
+        CHECK(batch.getStringStyle(second) == sf::Text::Bold);
+
+        batch.setStringOutlineColor(first, sf::Color::Blue);
+        batch.remove(first);
+        batch.remove(first);
+        CHECK(batch.getStringCount() == 1);
+        CHECK(batch.getString(second) == "second");
+        CHECK(batch.add("third", {}) == first);
+        CHECK(batch.getStringCount() == 2);
+        CHECK(batch.getStringOutlineColor(first) == sf::Color::Black);
+
+        batch.clear();
+        CHECK(batch.getStringCount() == 0);
+    }
+
+    SECTION("Set/get string attributes")
+    {
+        sf::TextBatch     batch(font, 24);
+        const std::size_t id = batch.add("text", {});
+        batch.setString(id, "other text");
+        batch.setStringPosition(id, {5, 6});
+        batch.setStringFillColor(id, sf::Color::Green);
+        batch.setStringOutlineColor(id, sf::Color::Blue);
+        batch.setStringStyle(id, sf::Text::Italic);
+        batch.setOutlineThickness(2);
+        CHECK(batch.getString(id) == "other text");
+        CHECK(batch.getStringPosition(id) == sf::Vector2f(5, 6));
+        CHECK(batch.getStringFillColor(id) == sf::Color::Green);
+        CHECK(batch.getStringOutlineColor(id) == sf::Color::Blue);
+        CHECK(batch.getStringStyle(id) == sf::Text::Italic);
+        CHECK(batch.getOutlineThickness() == 2);
+    }
+
+    SECTION("Get string bounds")
+    {
+        sf::Text text(font, "Test", 18);
+        text.setPosition({100, 200});
+
+        sf::TextBatch     batch(font, 18);
+        const std::size_t id = batch.add("Test", {100, 200});
+        CHECK(batch.getStringBounds(id) == text.getGlobalBounds());
+    }
+
+    SECTION("Draw")
+    {
+        sf::RenderTexture textsTexture;
+        sf::RenderTexture batchTexture;
+        REQUIRE(textsTexture.create({200, 100}));
+        REQUIRE(batchTexture.create({200, 100}));
+
+        sf::Text first(font, "Hello", 20);
+        first.setPosition({10, 10});
+        first.setOutlineThickness(1);
+        sf::Text second(font, "World", 20);
+        second.setPosition({50, 50});
+        second.setFillColor(sf::Color::Red);
+        second.setStyle(sf::Text::Bold);
+        second.setOutlineThickness(1);
+
+        sf::TextBatch batch(font, 20);
+        batch.setOutlineThickness(1);
+        batch.add("Hi", {10, 10});
+        const std::size_t id = batch.add("World", {50, 50}, sf::Color::Green, sf::Text::Bold);
+        batchTexture.draw(batch);
+
+        // Strings changed after a draw are updated
+        batch.setString(0, "Hello");
+        batch.setStringFillColor(id, sf::Color::Red);
+
+        textsTexture.clear();
+        textsTexture.draw(first);
+        textsTexture.draw(second);
+        textsTexture.display();
+
+        batchTexture.clear();
+        batchTexture.draw(batch);
+        batchTexture.display();
+
+        const sf::Image textsImage = textsTexture.getTexture().copyToImage();
+        const sf::Image batchImage = batchTexture.getTexture().copyToImage();
+        CHECK(std::memcmp(textsImage.getPixelsPtr(), batchImage.getPixelsPtr(), 200 * 100 * 4) == 0);
+        CHECK(batch.getStringBounds(id) == second.getGlobalBounds());
+    }
+
+    SECTION("Draw distance field glyphs")
+    {
+        font.setDistanceFieldEnabled(true);
+
+        sf::RenderTexture textsTexture;
+        sf::RenderTexture batchTexture;
+        REQUIRE(textsTexture.create({200, 100}));
+        REQUIRE(batchTexture.create({200, 100}));
+
+        // The bold string comes first, the batch draws it after the regular one
+        sf::Text bold(font, "Bold", 20);
+        bold.setPosition({10, 10});
+        bold.setStyle(sf::Text::Bold);
+        bold.setOutlineThickness(1);
+        sf::Text regular(font, "Regular", 20);
+        regular.setPosition({50, 50});
+        regular.setOutlineThickness(1);
+
+        sf::TextBatch batch(font, 20);
+        batch.setOutlineThickness(1);
+        const std::size_t id = batch.add("Bold", {10, 10}, sf::Color::White, sf::Text::Bold);
+        batch.add("Regular", {50, 50});
+
+        textsTexture.clear();
+        textsTexture.draw(bold);
+        textsTexture.draw(regular);
+        textsTexture.display();
+
+        batchTexture.clear();
+        batchTexture.draw(batch);
+        batchTexture.display();
+
+        const sf::Image textsImage = textsTexture.getTexture().copyToImage();
+        const sf::Image batchImage = batchTexture.getTexture().copyToImage();
+        CHECK(std::memcmp(textsImage.getPixelsPtr(), batchImage.getPixelsPtr(), 200 * 100 * 4) == 0);
+
+        // Changing the boldness moves the string to the other draw call
+        batch.setStringStyle(id, sf::Text::Regular);
+        bold.setStyle(sf::Text::Regular);
+
+        textsTexture.clear();
+        textsTexture.draw(bold);
+        textsTexture.draw(regular);
+        textsTexture.display();
+
+        batchTexture.clear();
+        batchTexture.draw(batch);
+        batchTexture.display();
+
+        const sf::Image textsImage2 = textsTexture.getTexture().copyToImage();
+        const sf::Image batchImage2 = batchTexture.getTexture().copyToImage();
+        CHECK(std::memcmp(textsImage2.getPixelsPtr(), batchImage2.getPixelsPtr(), 200 * 100 * 4) == 0);
+    }
+}
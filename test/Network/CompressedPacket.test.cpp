@@ -0,0 +1,253 @@
+#include <SFML/Network/CompressedPacket.hpp>
+
+// Other 1st party headers
+#include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <SystemUtil.hpp>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+#include <cstring>
+
+namespace
+{
+struct CompressedPacket : sf::CompressedPacket
+{
+    using sf::CompressedPacket::onReceive;
+    using sf::CompressedPacket::onSend;
+};
+
+// Send the packet's data to another packet, the way sockets do
+std::vector<std::byte> send(CompressedPacket& packet)
+{
+    std::size_t size = 0;
+    const auto* data = static_cast<const std::byte*>(packet.onSend(size));
+    return {data, data + size};
+}
+
+bool receive(CompressedPacket& packet, const std::vector<std::byte>& data)
+{
+    packet.clear();
+    packet.onReceive(data.data(), data.size());
+    return packet.getDataSize() > 0;
+}
+
+std::vector<std::byte> getData(const sf::Packet& packet)
+{
+    const auto* data = static_cast<const std::byte*>(packet.getData());
+    return {data, data + packet.getDataSize()};
+}
+
+// Game state-like data: repetitive records with a few varying fields
+std::vector<std::byte> makeSnapshot(std::size_t count)
+{
+    sf::Packet snapshot;
+    for (std::size_t i = 0; i < count; ++i)
+        snapshot << static_cast<std::uint32_t>(i % 16) << 100.f << 200.f << std::string("player");
+
+    return getData(snapshot);
+}
+
+std::vector<std::byte> makeRandom(std::size_t size)
+{
+    std::mt19937                    generator(42);
+    std::uniform_int_distribution<> distribution(0, 255);
+
+    std::vector<std::byte> data(size);
+    for (std::byte& byte : data)
+        byte = static_cast<std::byte>(distribution(generator));
+
+    return data;
+}
+} // namespace
+
+TEST_CASE("[Network] sf::CompressedPacket")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_base_of_v<sf::Packet, sf::CompressedPacket>);
+        STATIC_CHECK(std::is_copy_constructible_v<sf::CompressedPacket>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::CompressedPacket>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::CompressedPacket>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::CompressedPacket>);
+    }
+
+    SECTION("Default constructor")
+    {
+        const sf::CompressedPacket packet;
+        CHECK(packet.getDataSize() == 0);
+        CHECK(packet.getCompressionThreshold() == 128);
+        CHECK(packet.getStatistics().sentPackets == 0);
+        CHECK(packet.getStatistics().getCompressionRatio() == 1.0);
+    }
+
+    SECTION("Set/get compression threshold")
+    {
+        sf::CompressedPacket packet;
+        packet.setCompressionThreshold(1024);
+        CHECK(packet.getCompressionThreshold() == 1024);
+    }
+
+    CompressedPacket sender;
+    CompressedPacket receiver;
+
+    SECTION("Compressible data")
+    {
+        const std::vector<std::byte> snapshot = makeSnapshot(1000);
+        sender.append(snapshot.data(), snapshot.size());
+
+        const std::vector<std::byte> sent = send(sender);
+        CHECK(sent.size() < snapshot.size() / 4);
+        CHECK(getData(sender) == snapshot);
+
+        REQUIRE(receive(receiver, sent));
+        CHECK(getData(receiver) == snapshot);
+
+        std::uint32_t id   = 0;
+        float         x    = 0;
+        float         y    = 0;
+        std::string   name = "";
+        CHECK(receiver >> id >> x >> y >> name);
+        CHECK(id == 0);
+        CHECK(x == 100.f);
+        CHECK(y == 200.f);
+        CHECK(name == "player");
+
+        const sf::CompressedPacket::Statistics& statistics = sender.getStatistics();
+        CHECK(statistics.sentPackets == 1);
+        CHECK(statistics.compressedPackets == 1);
+        CHECK(statistics.dataBytes == snapshot.size());
+        CHECK(statistics.sentBytes == sent.size());
+        CHECK(statistics.getCompressionRatio() > 4.0);
+        CHECK(receiver.getStatistics().receivedPackets == 1);
+
+        sender.resetStatistics();
+        CHECK(sender.getStatistics().sentPackets == 0);
+        CHECK(sender.getStatistics().compressionTime == sf::Time::Zero);
+    }
+
+    SECTION("Data below the threshold")
+    {
+        const std::string text(100, 'a');
+        sender.append(text.data(), text.size());
+
+        const std::vector<std::byte> sent = send(sender);
+        CHECK(sent.size() == text.size() + 1);
+        CHECK(sender.getStatistics().compressedPackets == 0);
+
+        REQUIRE(receive(receiver, sent));
+        CHECK(receiver.getDataSize() == text.size());
+        CHECK(std::memcmp(receiver.getData(), text.data(), text.size()) == 0);
+
+        sender.setCompressionThreshold(16);
+        CHECK(send(sender).size() < text.size());
+        CHECK(sender.getStatistics().compressedPackets == 1);
+    }
+
+    SECTION("Incompressible data")
+    {
+        const std::vector<std::byte> random = makeRandom(10'000);
+        sender.append(random.data(), random.size());
+
+        const std::vector<std::byte> sent = send(sender);
+        CHECK(sent.size() == random.size() + 1);
+        CHECK(sender.getStatistics().compressedPackets == 0);
+
+        REQUIRE(receive(receiver, sent));
+        CHECK(getData(receiver) == random);
+    }
+
+    SECTION("Empty packet")
+    {
+        const std::vector<std::byte> sent = send(sender);
+        CHECK(sent.size() == 1);
+
+        CHECK(!receive(receiver, sent));
+        CHECK(receiver.endOfPacket());
+    }
+
+    SECTION("Round trips")
+    {
+        // Long literals, long matches and overlapping matches, mixed in various proportions
+        const std::vector<std::byte> random = makeRandom(100'000);
+        for (const std::size_t runLength : {1, 7, 300, 70'000})
+        {
+            std::vector<std::byte> data;
+            for (std::size_t i = 0; data.size() < 200'000; ++i)
+            {
+                const std::size_t offset = (i * 7919) % (random.size() - runLength);
+                data.insert(data.end(), random.begin() + static_cast<std::ptrdiff_t>(offset),
+                            random.begin() + static_cast<std::ptrdiff_t>(offset + runLength));
+                data.insert(data.end(), runLength % 1000, std::byte{0x55});
+            }
+
+            sender.clear();
+            sender.append(data.data(), data.size());
+            REQUIRE(receive(receiver, send(sender)));
+            CHECK(getData(receiver) == data);
+        }
+        CHECK(sender.getStatistics().compressedPackets > 0);
+    }
+
+    SECTION("Corrupted data")
+    {
+        const std::vector<std::byte> snapshot = makeSnapshot(100);
+        sender.append(snapshot.data(), snapshot.size());
+        const std::vector<std::byte> sent = send(sender);
+
+        // Truncated
+        CHECK(!receive(receiver, std::vector(sent.begin(), sent.end() - 1)));
+
+        // Wrong decompressed size
+        std::vector<std::byte> wrongSize = sent;
+        wrongSize[4] ^= std::byte{1};
+        CHECK(!receive(receiver, wrongSize));
+
+        // Absurd decompressed size
+        std::vector<std::byte> absurdSize = sent;
+        absurdSize[1] = std::byte{0xFF};
+        CHECK(!receive(receiver, absurdSize));
+
+        // Unknown encoding
+        std::vector<std::byte> unknown = sent;
+        unknown[0] = std::byte{0xFF};
+        CHECK(!receive(receiver, unknown));
+
+        CHECK(!receive(receiver, {}));
+    }
+
+    SECTION("Over the network")
+    {
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::TcpSocket client;
+        sf::TcpSocket server;
+        REQUIRE(client.connect(sf::IpAddress::LocalHost, listener.getLocalPort()) == sf::Socket::Status::Done);
+        REQUIRE(listener.accept(server) == sf::Socket::Status::Done);
+
+        const std::vector<std::byte> snapshot = makeSnapshot(1000);
+        sf::CompressedPacket         packet;
+        for (int i = 0; i < 3; ++i)
+        {
+            packet.clear();
+            packet.append(snapshot.data(), snapshot.size());
+            REQUIRE(client.send(packet) == sf::Socket::Status::Done);
+        }
+        CHECK(packet.getStatistics().compressedPackets == 3);
+
+        sf::CompressedPacket received;
+        for (int i = 0; i < 3; ++i)
+        {
+            REQUIRE(server.receive(received) == sf::Socket::Status::Done);
+            CHECK(getData(received) == snapshot);
+        }
+        CHECK(received.getStatistics().receivedPackets == 3);
+    }
+}
@@ -1,9 +1,182 @@
 #include <SFML/Network/Ftp.hpp>
 
+// Other 1st party headers
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/TcpListener.hpp>
+
 #include <catch2/catch_test_macros.hpp>
 
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
 #include <type_traits>
 
+namespace
+{
+// Contents of the files used in the transfer tests, larger than the transfer buffer
+std::string makeFileContents()
+{
+    std::string contents(300 * 1024, ' ');
+    for (std::size_t i = 0; i < contents.size(); ++i)
+        contents[i] = static_cast<char>('a' + i % 26);
+    return contents;
+}
+
+std::string readFile(const std::filesystem::path& path)
+{
+    std::ifstream      file(path, std::ios_base::binary);
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+void writeFile(const std::filesystem::path& path, const std::string& contents)
+{
+    std::ofstream file(path, std::ios_base::binary | std::ios_base::trunc);
+    file << contents;
+}
+
+// Minimal FTP server, serving a single session with files stored in memory
+class TestServer
+{
+public:
+    explicit TestServer(std::map<std::string, std::string> files) : m_files(std::move(files))
+    {
+        REQUIRE(m_listener.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        m_thread = std::thread([this] { serve(); });
+    }
+
+    ~TestServer()
+    {
+        if (m_thread.joinable())
+            m_thread.join();
+    }
+
+    TestServer(const TestServer&)            = delete;
+    TestServer& operator=(const TestServer&) = delete;
+
+    unsigned short getPort() const
+    {
+        return m_listener.getLocalPort();
+    }
+
+    // Wait for the end of the session, and return the files as they were left by the client
+    const std::map<std::string, std::string>& getFiles()
+    {
+        m_thread.join();
+        return m_files;
+    }
+
+private:
+    void serve()
+    {
+        sf::TcpSocket control;
+        if (m_listener.accept(control) != sf::Socket::Status::Done)
+            return;
+
+        sf::TcpListener dataListener;
+        std::uint64_t   restart = 0;
+        std::string     buffer;
+        const auto      reply   = [&](const std::string& line)
+        { return control.send(line.data(), line.size()) == sf::Socket::Status::Done; };
+
+        if (!reply("220 Ready\r\n"))
+            return;
+
+        for (;;)
+        {
+            // Receive the next command
+            std::size_t end = 0;
+            while ((end = buffer.find("\r\n")) == std::string::npos)
+            {
+                char        data[256];
+                std::size_t size = 0;
+                if (control.receive(data, sizeof(data), size) != sf::Socket::Status::Done)
+                    return;
+                buffer.append(data, size);
+            }
+
+            const std::string line = buffer.substr(0, end);
+            buffer.erase(0, end + 2);
+            const std::string command  = line.substr(0, line.find(' '));
+            const std::string argument = line.find(' ') != std::string::npos ? line.substr(line.find(' ') + 1) : "";
+
+            if (command == "PASV")
+            {
+                dataListener.close();
+                if (dataListener.listen(0, sf::IpAddress::LocalHost) != sf::Socket::Status::Done)
+                    return;
+
+                const unsigned short port = dataListener.getLocalPort();
+                reply("227 Entering Passive Mode (127,0,0,1," + std::to_string(port / 256) + "," +
+                      std::to_string(port % 256) + ")\r\n");
+            }
+            else if (command == "REST")
+            {
+                restart = std::stoull(argument);
+                reply("350 Restarting\r\n");
+            }
+            else if (command == "SIZE")
+            {
+                const auto it = m_files.find(argument);
+                reply(it != m_files.end() ? "213 " + std::to_string(it->second.size()) + "\r\n" : "550 No file\r\n");
+            }
+            else if ((command == "RETR") || (command == "STOR"))
+            {
+                const bool retrieve = command == "RETR";
+                if (retrieve && (m_files.count(argument) == 0))
+                {
+                    reply("550 No file\r\n");
+                    continue;
+                }
+
+                sf::TcpSocket data;
+                reply("150 Opening data connection\r\n");
+                if (dataListener.accept(data) != sf::Socket::Status::Done)
+                    return;
+
+                std::string& file = m_files[argument];
+                if (retrieve)
+                {
+                    const std::string contents = file.substr(static_cast<std::size_t>(restart));
+                    if (data.send(contents.data(), contents.size()) != sf::Socket::Status::Done)
+                        return;
+                }
+                else
+                {
+                    file.resize(static_cast<std::size_t>(restart));
+                    char        block[4096];
+                    std::size_t size = 0;
+                    while (data.receive(block, sizeof(block), size) == sf::Socket::Status::Done)
+                        file.append(block, size);
+                }
+
+                data.disconnect();
+                restart = 0;
+                reply("226 Transfer complete\r\n");
+            }
+            else if (command == "QUIT")
+            {
+                reply("221 Bye\r\n");
+                return;
+            }
+            else
+            {
+                // USER, PASS, TYPE and other commands are simply accepted
+                reply("200 Ok\r\n");
+            }
+        }
+    }
+
+    sf::TcpListener                    m_listener;
+    std::thread                        m_thread;
+    std::map<std::string, std::string> m_files;
+};
+} // namespace
+
 TEST_CASE("[Network] sf::Ftp")
 {
     SECTION("Type traits")
@@ -99,4 +272,72 @@ TEST_CASE("[Network] sf::Ftp")
             CHECK(listingResponse.getListing() == std::vector<std::string>{"foo", "bar"});
         }
     }
+
+    SECTION("Transfers")
+    {
+        const std::string           contents = makeFileContents();
+        const std::filesystem::path folder   = std::filesystem::temp_directory_path() / "sfml-ftp-test";
+        std::filesystem::create_directories(folder);
+
+        SECTION("Transfer buffer size")
+        {
+            sf::Ftp ftp;
+            CHECK(ftp.getTransferBufferSize() == 64 * 1024);
+            ftp.setTransferBufferSize(1024 * 1024);
+            CHECK(ftp.getTransferBufferSize() == 1024 * 1024);
+            CHECK(ftp.getTransferStatistics().bytesTransferred == 0);
+        }
+
+        SECTION("Download")
+        {
+            TestServer server({{"file.bin", contents}});
+            sf::Ftp    ftp;
+            REQUIRE(ftp.connect(sf::IpAddress::LocalHost, server.getPort()).isOk());
+            REQUIRE(ftp.login().isOk());
+
+            std::filesystem::remove(folder / "file.bin");
+            CHECK(ftp.download("file.bin", folder).isOk());
+            CHECK(readFile(folder / "file.bin") == contents);
+            CHECK(ftp.getTransferStatistics().offset == 0);
+            CHECK(ftp.getTransferStatistics().bytesTransferred == contents.size());
+
+            // Resume a download interrupted after the first 1000 bytes
+            writeFile(folder / "file.bin", contents.substr(0, 1000));
+            CHECK(ftp.download("file.bin", folder, sf::Ftp::TransferMode::Binary, true).isOk());
+            CHECK(readFile(folder / "file.bin") == contents);
+            CHECK(ftp.getTransferStatistics().offset == 1000);
+            CHECK(ftp.getTransferStatistics().bytesTransferred == contents.size() - 1000);
+
+            // A failed resumable download keeps the partial file
+            CHECK(!ftp.download("missing.bin", folder, sf::Ftp::TransferMode::Binary, true).isOk());
+            CHECK(ftp.disconnect().isOk());
+        }
+
+        SECTION("Upload")
+        {
+            TestServer server({{"partial.bin", contents.substr(0, 5000)}});
+            sf::Ftp    ftp;
+            REQUIRE(ftp.connect(sf::IpAddress::LocalHost, server.getPort()).isOk());
+            REQUIRE(ftp.login().isOk());
+
+            writeFile(folder / "file.bin", contents);
+            CHECK(ftp.upload(folder / "file.bin", "").isOk());
+            CHECK(ftp.getTransferStatistics().offset == 0);
+            CHECK(ftp.getTransferStatistics().bytesTransferred == contents.size());
+
+            // Resume an upload interrupted after the first 5000 bytes
+            writeFile(folder / "partial.bin", contents);
+            ftp.setTransferBufferSize(4096);
+            CHECK(ftp.upload(folder / "partial.bin", "", sf::Ftp::TransferMode::Binary, false, true).isOk());
+            CHECK(ftp.getTransferStatistics().offset == 5000);
+            CHECK(ftp.getTransferStatistics().bytesTransferred == contents.size() - 5000);
+            CHECK(ftp.disconnect().isOk());
+
+            const std::map<std::string, std::string>& files = server.getFiles();
+            CHECK(files.at("file.bin") == contents);
+            CHECK(files.at("partial.bin") == contents);
+        }
+
+        std::filesystem::remove_all(folder);
+    }
 }
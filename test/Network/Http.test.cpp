@@ -1,8 +1,138 @@
 #include <SFML/Network/Http.hpp>
 
+// Other 1st party headers
+#include <SFML/Network/SocketSelector.hpp>
+#include <SFML/Network/TcpListener.hpp>
+
 #include <catch2/catch_test_macros.hpp>
 
+#include <atomic>
+#include <sstream>
+#include <string>
+#include <thread>
 #include <type_traits>
+#include <vector>
+
+namespace
+{
+// Body larger than the blocks received by the client
+const std::string& largeBody()
+{
+    static const std::string body = []
+    {
+        std::string result(1024 * 1024, ' ');
+        for (std::size_t i = 0; i < result.size(); ++i)
+            result[i] = static_cast<char>('a' + i % 26);
+        return result;
+    }();
+    return body;
+}
+
+// Minimal HTTP/1.1 server, answering a given number of requests on a local port
+class TestServer
+{
+public:
+    explicit TestServer(std::size_t requestCount)
+    {
+        REQUIRE(m_listener.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        m_thread = std::thread([this, requestCount] { serve(requestCount); });
+    }
+
+    ~TestServer()
+    {
+        m_thread.join();
+    }
+
+    TestServer(const TestServer&)            = delete;
+    TestServer& operator=(const TestServer&) = delete;
+
+    unsigned short getPort() const
+    {
+        return m_listener.getLocalPort();
+    }
+
+    std::size_t getConnectionCount() const
+    {
+        return m_connectionCount;
+    }
+
+private:
+    void serve(std::size_t requestCount)
+    {
+        sf::SocketSelector selector;
+        selector.add(m_listener);
+
+        std::size_t served = 0;
+        while ((served < requestCount) && selector.wait(sf::seconds(5)))
+        {
+            sf::TcpSocket socket;
+            if (m_listener.accept(socket) != sf::Socket::Status::Done)
+                return;
+
+            ++m_connectionCount;
+
+            std::string buffer;
+            bool        open = true;
+            while (open && (served < requestCount))
+            {
+                // Receive the request header, the requests sent by the tests have no body
+                std::size_t end = 0;
+                while (open && ((end = buffer.find("\r\n\r\n")) == std::string::npos))
+                {
+                    char        data[1024];
+                    std::size_t size = 0;
+                    open             = socket.receive(data, sizeof(data), size) == sf::Socket::Status::Done;
+                    buffer.append(data, size);
+                }
+
+                if (!open)
+                    break;
+
+                const std::size_t uriStart = buffer.find(' ') + 1;
+                const std::string uri      = buffer.substr(uriStart, buffer.find(' ', uriStart) - uriStart);
+                buffer.erase(0, end + 4);
+                ++served;
+
+                // Answer with different framings depending on the URI, the default response echoes the URI
+                std::string response;
+                if (uri == "/chunked")
+                {
+                    response = "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n"
+                               "5\r\nHello\r\n8\r\n, world!\r\n0\r\n\r\n";
+                }
+                else if (uri == "/large")
+                {
+                    response = "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(largeBody().size()) + "\r\n\r\n" +
+                               largeBody();
+                }
+                else if (uri == "/close")
+                {
+                    response = "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: 6\r\n\r\nclosed";
+                    open     = false;
+                }
+                else
+                {
+                    response = "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(uri.size()) + "\r\n\r\n" + uri;
+                }
+
+                if (socket.send(response.data(), response.size()) != sf::Socket::Status::Done)
+                    open = false;
+            }
+        }
+    }
+
+    sf::TcpListener          m_listener;
+    std::thread              m_thread;
+    std::atomic<std::size_t> m_connectionCount{};
+};
+
+sf::Http::Request makeRequest(const std::string& uri)
+{
+    sf::Http::Request request(uri);
+    request.setHttpVersion(1, 1);
+    return request;
+}
+} // namespace
 
 TEST_CASE("[Network] sf::Http")
 {
@@ -45,4 +175,90 @@ TEST_CASE("[Network] sf::Http")
             CHECK(response.getBody().empty());
         }
     }
+
+    SECTION("Keep-alive")
+    {
+        TestServer server(4);
+        sf::Http   http("127.0.0.1", server.getPort());
+
+        sf::Http::Response response = http.sendRequest(makeRequest("/first"));
+        CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+        CHECK(response.getBody() == "/first");
+
+        response = http.sendRequest(makeRequest("/chunked"));
+        CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+        CHECK(response.getBody() == "Hello, world!");
+
+        response = http.sendRequest(makeRequest("/close"));
+        CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+        CHECK(response.getBody() == "closed");
+
+        response = http.sendRequest(makeRequest("/last"));
+        CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+        CHECK(response.getBody() == "/last");
+
+        // The connection is only opened again after the server closed it
+        CHECK(server.getConnectionCount() == 2);
+    }
+
+    SECTION("Pipelining")
+    {
+        TestServer server(3);
+        sf::Http   http("127.0.0.1", server.getPort());
+
+        const std::vector<sf::Http::Response> responses = http.sendRequests(
+            {makeRequest("/first"), makeRequest("/chunked"), makeRequest("/third")});
+        REQUIRE(responses.size() == 3);
+        CHECK(responses[0].getBody() == "/first");
+        CHECK(responses[1].getBody() == "Hello, world!");
+        CHECK(responses[2].getBody() == "/third");
+        CHECK(server.getConnectionCount() == 1);
+    }
+
+    SECTION("Streaming")
+    {
+        TestServer server(3);
+        sf::Http   http("127.0.0.1", server.getPort());
+
+        std::ostringstream body;
+        sf::Http::Response response = http.sendRequest(makeRequest("/chunked"), body);
+        CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+        CHECK(response.getBody().empty());
+        CHECK(body.str() == "Hello, world!");
+
+        std::size_t received = 0;
+        std::size_t total    = 0;
+        bool        matches  = true;
+        response             = http.sendRequest(makeRequest("/large"),
+                                    [&](const sf::Http::Response& current, const char* data, std::size_t size)
+                                    {
+                                        total = std::stoul(current.getField("content-length"));
+                                        matches = matches && (largeBody().compare(received, size, data, size) == 0);
+                                        received += size;
+                                        return true;
+                                    });
+        CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+        CHECK(response.getBody().empty());
+        CHECK(received == largeBody().size());
+        CHECK(total == largeBody().size());
+        CHECK(matches);
+
+        // Aborting the transfer closes the connection
+        std::size_t calls = 0;
+        response          = http.sendRequest(makeRequest("/large"),
+                                    [&](const sf::Http::Response&, const char*, std::size_t)
+                                    {
+                                        ++calls;
+                                        return false;
+                                    });
+        CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+        CHECK(calls == 1);
+        CHECK(server.getConnectionCount() == 1);
+    }
+
+    SECTION("No host")
+    {
+        sf::Http http;
+        CHECK(http.sendRequest(sf::Http::Request()).getStatus() == sf::Http::Response::Status::ConnectionFailed);
+    }
 }
@@ -3,6 +3,7 @@
 // Other 1st party headers
 #include <SFML/System/String.hpp>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <array>
@@ -11,6 +12,7 @@
 #include <vector>
 
 #include <cstddef>
+#include <cstring>
 #include <cwchar>
 
 #define CHECK_PACKET_STREAM_OPERATORS(expected)              \
@@ -101,6 +103,20 @@ TEST_CASE("[Network] sf::Packet")
         CHECK(static_cast<bool>(packet));
     }
 
+    SECTION("Reserve")
+    {
+        sf::Packet packet;
+        packet.reserve(1024);
+        CHECK(packet.getDataSize() == 0);
+        CHECK(packet.endOfPacket());
+
+        packet.append(data.data(), 512);
+        const void* dataPtr = packet.getData();
+        packet.append(data.data(), 512);
+        CHECK(packet.getData() == dataPtr);
+        CHECK(packet.getDataSize() == 1024);
+    }
+
     SECTION("Network ordering")
     {
         sf::Packet packet;
@@ -288,4 +304,201 @@ TEST_CASE("[Network] sf::Packet")
         CHECK(packet.getData() != nullptr);
         CHECK(packet.getDataSize() == data.size());
     }
+
+    SECTION("Arrays")
+    {
+        SECTION("Same encoding as stream operators")
+        {
+            const std::array<std::int32_t, 3> values = {-1, 1'234'567'890, 42};
+
+            sf::Packet packet;
+            packet.writeArray(values.data(), values.size());
+
+            sf::Packet expected;
+            expected << values[0] << values[1] << values[2];
+            REQUIRE(packet.getDataSize() == expected.getDataSize());
+            CHECK(std::memcmp(packet.getData(), expected.getData(), expected.getDataSize()) == 0);
+
+            std::array<std::int32_t, 3> received{};
+            CHECK(packet.readArray(received.data(), received.size()));
+            CHECK(received == values);
+            CHECK(packet.endOfPacket());
+        }
+
+        SECTION("All types")
+        {
+            const std::array<std::uint8_t, 3>  bytes   = {1, 2, 255};
+            const std::array<std::int16_t, 2>  shorts  = {-12'345, 12'345};
+            const std::array<std::uint64_t, 2> longs   = {0x0123'4567'89AB'CDEF, 42};
+            const std::array<float, 2>         floats  = {123.456f, -1.f};
+            const std::array<double, 2>        doubles = {789.123, 0.};
+
+            sf::Packet packet;
+            packet.writeArray(bytes.data(), bytes.size())
+                .writeArray(shorts.data(), shorts.size())
+                .writeArray(longs.data(), longs.size())
+                .writeArray(floats.data(), floats.size())
+                .writeArray(doubles.data(), doubles.size());
+            CHECK(packet.getDataSize() == 3 + 2 * 2 + 2 * 8 + 2 * 4 + 2 * 8);
+
+            // Arrays and single values can be mixed
+            sf::Packet    partial(packet);
+            std::uint16_t firstShort = 0;
+            CHECK(partial.readArray(static_cast<std::uint8_t*>(nullptr), 0));
+            CHECK(partial.getReadPosition() == 0);
+            CHECK(partial.readArray(std::array<std::uint8_t, 3>{}.data(), 3) >> firstShort);
+            CHECK(firstShort == static_cast<std::uint16_t>(-12'345));
+
+            std::array<std::uint8_t, 3>  receivedBytes{};
+            std::array<std::int16_t, 2>  receivedShorts{};
+            std::array<std::uint64_t, 2> receivedLongs{};
+            std::array<float, 2>         receivedFloats{};
+            std::array<double, 2>        receivedDoubles{};
+            CHECK(packet.readArray(receivedBytes.data(), receivedBytes.size())
+                      .readArray(receivedShorts.data(), receivedShorts.size())
+                      .readArray(receivedLongs.data(), receivedLongs.size())
+                      .readArray(receivedFloats.data(), receivedFloats.size())
+                      .readArray(receivedDoubles.data(), receivedDoubles.size()));
+            CHECK(receivedBytes == bytes);
+            CHECK(receivedShorts == shorts);
+            CHECK(receivedLongs == longs);
+            CHECK(receivedFloats == floats);
+            CHECK(receivedDoubles == doubles);
+            CHECK(packet.endOfPacket());
+        }
+
+        SECTION("Not enough data")
+        {
+            const std::array<std::uint32_t, 2> values = {1, 2};
+
+            sf::Packet packet;
+            packet.writeArray(values.data(), values.size());
+
+            std::array<std::uint32_t, 3> received{};
+            CHECK(!packet.readArray(received.data(), received.size()));
+            CHECK(packet.getReadPosition() == 0);
+            CHECK(received == std::array<std::uint32_t, 3>{});
+
+            packet.clear();
+            packet.writeArray(values.data(), values.size());
+            CHECK(!packet.readArray(received.data(), std::numeric_limits<std::size_t>::max() / 2));
+        }
+    }
+
+    SECTION("Varints")
+    {
+        const auto encode = [](auto value, bool isSigned)
+        {
+            sf::Packet packet;
+            if (isSigned)
+                packet.writeVarInt(static_cast<std::int64_t>(value));
+            else
+                packet.writeVarUint(static_cast<std::uint64_t>(value));
+
+            const auto* dataPtr = static_cast<const std::byte*>(packet.getData());
+            return std::vector(dataPtr, dataPtr + packet.getDataSize());
+        };
+
+        SECTION("Encoding")
+        {
+            CHECK(encode(0, false) == std::vector{std::byte{0x00}});
+            CHECK(encode(127, false) == std::vector{std::byte{0x7F}});
+            CHECK(encode(128, false) == std::vector{std::byte{0x80}, std::byte{0x01}});
+            CHECK(encode(300, false) == std::vector{std::byte{0xAC}, std::byte{0x02}});
+            CHECK(encode(std::numeric_limits<std::uint64_t>::max(), false).size() == 10);
+
+            CHECK(encode(0, true) == std::vector{std::byte{0x00}});
+            CHECK(encode(-1, true) == std::vector{std::byte{0x01}});
+            CHECK(encode(1, true) == std::vector{std::byte{0x02}});
+            CHECK(encode(-64, true) == std::vector{std::byte{0x7F}});
+            CHECK(encode(64, true) == std::vector{std::byte{0x80}, std::byte{0x01}});
+            CHECK(encode(std::numeric_limits<std::int64_t>::min(), true).size() == 10);
+        }
+
+        SECTION("Round trip")
+        {
+            const std::array<std::uint64_t, 6>
+                unsignedValues = {0, 1, 127, 128, 16'384, std::numeric_limits<std::uint64_t>::max()};
+            const std::array<std::int64_t, 6> signedValues =
+                {0, -1, 63, -64, std::numeric_limits<std::int64_t>::max(), std::numeric_limits<std::int64_t>::min()};
+
+            sf::Packet packet;
+            for (std::size_t i = 0; i < unsignedValues.size(); ++i)
+                packet.writeVarUint(unsignedValues[i]).writeVarInt(signedValues[i]);
+
+            for (std::size_t i = 0; i < unsignedValues.size(); ++i)
+            {
+                std::uint64_t unsignedValue = 0;
+                std::int64_t  signedValue   = 0;
+                CHECK(packet.readVarUint(unsignedValue).readVarInt(signedValue));
+                CHECK(unsignedValue == unsignedValues[i]);
+                CHECK(signedValue == signedValues[i]);
+            }
+            CHECK(packet.endOfPacket());
+        }
+
+        SECTION("Invalid data")
+        {
+            std::uint64_t value = 0;
+
+            sf::Packet truncated;
+            truncated << std::uint8_t{0x80};
+            CHECK(!truncated.readVarUint(value));
+            CHECK(truncated.getReadPosition() == 0);
+
+            sf::Packet tooLong;
+            for (int i = 0; i < 9; ++i)
+                tooLong << std::uint8_t{0xFF};
+            tooLong << std::uint8_t{0x02};
+            CHECK(!tooLong.readVarUint(value));
+            CHECK(value == 0);
+        }
+    }
+}
+
+TEST_CASE("[Network] sf::Packet array benchmark", "[.benchmark]")
+{
+    // A snapshot of 10000 positions
+    const std::vector<float>        positions(20'000, 123.456f);
+    const std::vector<std::int32_t> identifiers(10'000, 1'234'567);
+
+    BENCHMARK("Stream operators")
+    {
+        sf::Packet packet;
+        for (std::size_t i = 0; i < identifiers.size(); ++i)
+            packet << identifiers[i] << positions[2 * i] << positions[2 * i + 1];
+
+        return packet.getDataSize();
+    };
+
+    BENCHMARK("Arrays")
+    {
+        sf::Packet packet;
+        packet.reserve(identifiers.size() * sizeof(std::int32_t) + positions.size() * sizeof(float));
+        packet.writeArray(identifiers.data(), identifiers.size());
+        packet.writeArray(positions.data(), positions.size());
+
+        return packet.getDataSize();
+    };
+
+    sf::Packet packet;
+    packet.writeArray(identifiers.data(), identifiers.size());
+    std::vector<std::int32_t> received(identifiers.size());
+
+    BENCHMARK("Read stream operators")
+    {
+        sf::Packet copy(packet);
+        for (std::int32_t& identifier : received)
+            copy >> identifier;
+
+        return received.back();
+    };
+
+    BENCHMARK("Read array")
+    {
+        sf::Packet copy(packet);
+        copy.readArray(received.data(), received.size());
+
+        return received.back();
+    };
 }
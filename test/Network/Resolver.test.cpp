@@ -0,0 +1,137 @@
+#include <SFML/Network/Resolver.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <SystemUtil.hpp>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <map>
+#include <type_traits>
+
+namespace
+{
+// Stand-in for the hosts file, which makes the results independent of the network configuration
+class HostsTable
+{
+public:
+    std::optional<sf::IpAddress> operator()(const std::string& hostName)
+    {
+        ++lookupCount;
+        gate.wait();
+
+        const auto it = hosts.find(hostName);
+        return it != hosts.end() ? std::optional(it->second) : std::nullopt;
+    }
+
+    const std::map<std::string, sf::IpAddress> hosts{{"server.test", sf::IpAddress(192, 0, 2, 1)},
+                                                     {"backup.test", sf::IpAddress(192, 0, 2, 2)}};
+    std::atomic<int>                           lookupCount{};
+    std::promise<void>                         release;
+    std::shared_future<void>                   gate{release.get_future()};
+};
+
+template <typename T>
+bool isReady(const std::future<T>& future)
+{
+    return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+} // namespace
+
+TEST_CASE("[Network] sf::Resolver")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::Resolver>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::Resolver>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::Resolver resolver;
+        CHECK(resolver.getTimeToLive() == sf::seconds(300));
+        CHECK(!resolver.getCachedAddress("localhost").has_value());
+    }
+
+    SECTION("System lookup")
+    {
+        sf::Resolver resolver(2, sf::seconds(10));
+        CHECK(resolver.getTimeToLive() == sf::seconds(10));
+        CHECK(resolver.resolve("127.0.0.1").get() == sf::IpAddress::LocalHost);
+        CHECK(resolver.getCachedAddress("127.0.0.1") == sf::IpAddress::LocalHost);
+        CHECK(!resolver.resolve("255.255.255.256").get().has_value());
+    }
+
+    HostsTable hosts;
+    hosts.release.set_value();
+    sf::Resolver resolver([&hosts](const std::string& hostName) { return hosts(hostName); });
+
+    SECTION("Cache")
+    {
+        CHECK(resolver.resolve("server.test").get() == sf::IpAddress(192, 0, 2, 1));
+        CHECK(resolver.getCachedAddress("server.test") == sf::IpAddress(192, 0, 2, 1));
+        CHECK(hosts.lookupCount == 1);
+
+        // Cached addresses are available immediately
+        std::future<std::optional<sf::IpAddress>> future = resolver.resolve("server.test");
+        CHECK(isReady(future));
+        CHECK(future.get() == sf::IpAddress(192, 0, 2, 1));
+        CHECK(hosts.lookupCount == 1);
+
+        // Failures are not cached
+        CHECK(!resolver.resolve("unknown.test").get().has_value());
+        CHECK(!resolver.resolve("unknown.test").get().has_value());
+        CHECK(!resolver.getCachedAddress("unknown.test").has_value());
+        CHECK(hosts.lookupCount == 3);
+
+        resolver.clearCache();
+        CHECK(!resolver.getCachedAddress("server.test").has_value());
+        CHECK(resolver.resolve("server.test").get() == sf::IpAddress(192, 0, 2, 1));
+        CHECK(hosts.lookupCount == 4);
+    }
+
+    SECTION("Time to live")
+    {
+        resolver.setTimeToLive(sf::Time::Zero);
+        CHECK(resolver.getTimeToLive() == sf::Time::Zero);
+        CHECK(resolver.resolve("server.test").get() == sf::IpAddress(192, 0, 2, 1));
+        CHECK(!resolver.getCachedAddress("server.test").has_value());
+        CHECK(resolver.resolve("server.test").get() == sf::IpAddress(192, 0, 2, 1));
+        CHECK(hosts.lookupCount == 2);
+    }
+
+    SECTION("Callback")
+    {
+        std::promise<std::optional<sf::IpAddress>> promise;
+        resolver.resolve("backup.test",
+                         [&promise](std::optional<sf::IpAddress> address) { promise.set_value(address); });
+        CHECK(promise.get_future().get() == sf::IpAddress(192, 0, 2, 2));
+
+        // Cached addresses are passed by the calling thread
+        std::optional<sf::IpAddress> cached;
+        resolver.resolve("backup.test", [&cached](std::optional<sf::IpAddress> address) { cached = address; });
+        CHECK(cached == sf::IpAddress(192, 0, 2, 2));
+    }
+}
+
+TEST_CASE("[Network] sf::Resolver stalled lookups")
+{
+    HostsTable   hosts;
+    sf::Resolver resolver([&hosts](const std::string& hostName) { return hosts(hostName); }, 2);
+
+    // The lookups are stalled, but the calling thread is not
+    std::future<std::optional<sf::IpAddress>> server = resolver.resolve("server.test");
+    std::future<std::optional<sf::IpAddress>> again  = resolver.resolve("server.test");
+    std::future<std::optional<sf::IpAddress>> backup = resolver.resolve("backup.test");
+    CHECK(!isReady(server));
+    CHECK(!isReady(again));
+    CHECK(!isReady(backup));
+    CHECK(!resolver.getCachedAddress("server.test").has_value());
+
+    // Both host names are resolved in parallel, and the same host name is only looked up once
+    hosts.release.set_value();
+    CHECK(server.get() == sf::IpAddress(192, 0, 2, 1));
+    CHECK(again.get() == sf::IpAddress(192, 0, 2, 1));
+    CHECK(backup.get() == sf::IpAddress(192, 0, 2, 2));
+    CHECK(hosts.lookupCount == 2);
+}
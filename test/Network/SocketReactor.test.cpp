@@ -0,0 +1,214 @@
+#include <SFML/Network/SocketReactor.hpp>
+
+// Other 1st party headers
+#include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <list>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("[Network] sf::SocketReactor")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::SocketReactor>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::SocketReactor>);
+        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::SocketReactor>);
+        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::SocketReactor>);
+    }
+
+    SECTION("No pending operation")
+    {
+        sf::SocketReactor reactor;
+        CHECK(reactor.run() == 0);
+        CHECK(reactor.poll() == 0);
+    }
+
+    SECTION("post()")
+    {
+        sf::SocketReactor reactor;
+        std::vector<int>  calls;
+        reactor.post([&] { calls.push_back(1); });
+        reactor.post(
+            [&]
+            {
+                calls.push_back(2);
+                reactor.post([&] { calls.push_back(3); });
+            });
+        CHECK(reactor.run() == 3);
+        CHECK(calls == std::vector<int>{1, 2, 3});
+    }
+
+    SECTION("Several threads")
+    {
+        sf::SocketReactor        reactor;
+        std::atomic<std::size_t> calls{};
+        for (int i = 0; i < 100; ++i)
+            reactor.post([&] { ++calls; });
+
+        std::atomic<std::size_t> count{};
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; ++i)
+            threads.emplace_back([&] { count += reactor.run(); });
+
+        for (std::thread& thread : threads)
+            thread.join();
+
+        CHECK(calls == 100);
+        CHECK(count == 100);
+    }
+
+    SECTION("TCP")
+    {
+        sf::SocketReactor reactor;
+        sf::TcpListener   listener;
+        REQUIRE(listener.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        // The server echoes the packets it receives, until the client disconnects
+        std::list<sf::TcpSocket> clients;
+        sf::Packet               serverPacket;
+        sf::Socket::Status       serverStatus = sf::Socket::Status::Done;
+        std::function<void(sf::TcpSocket&)> echo = [&](sf::TcpSocket& client)
+        {
+            reactor.asyncReceive(client,
+                                 serverPacket,
+                                 [&](sf::Socket::Status status)
+                                 {
+                                     serverStatus = status;
+                                     if (status != sf::Socket::Status::Done)
+                                         return;
+
+                                     reactor.asyncSend(client, serverPacket);
+                                     echo(client);
+                                 });
+        };
+        reactor.asyncAccept(listener,
+                            [&](sf::Socket::Status status, sf::TcpSocket socket)
+                            {
+                                CHECK(status == sf::Socket::Status::Done);
+                                echo(clients.emplace_back(std::move(socket)));
+                            });
+
+        // The client queues a large packet, which takes several writes, and a small one right after it
+        sf::TcpSocket    socket;
+        sf::Packet       large;
+        sf::Packet       small;
+        std::vector<int> order;
+        large << std::string(1024 * 1024, 'x');
+        small << std::string("end");
+        reactor.asyncConnect(socket,
+                             sf::IpAddress::LocalHost,
+                             listener.getLocalPort(),
+                             [&](sf::Socket::Status status)
+                             {
+                                 CHECK(status == sf::Socket::Status::Done);
+                                 reactor.asyncSend(socket, large, [&](sf::Socket::Status) { order.push_back(1); });
+                                 reactor.asyncSend(socket, small, [&](sf::Socket::Status) { order.push_back(2); });
+                             });
+
+        // The echoed packets are received as raw data, each one is preceded by its size
+        const std::size_t     expected = large.getDataSize() + small.getDataSize() + 8;
+        std::vector<char>     buffer(4096);
+        std::string           received;
+        std::function<void()> receive = [&]
+        {
+            reactor.asyncReceive(socket,
+                                 buffer.data(),
+                                 buffer.size(),
+                                 [&](sf::Socket::Status status, std::size_t size)
+                                 {
+                                     CHECK(status == sf::Socket::Status::Done);
+                                     received.append(buffer.data(), size);
+                                     if (received.size() < expected)
+                                         receive();
+                                     else
+                                         socket.disconnect();
+                                 });
+        };
+        receive();
+
+        CHECK(reactor.run() > 0);
+        CHECK(order == std::vector<int>{1, 2});
+        CHECK(serverStatus == sf::Socket::Status::Disconnected);
+        REQUIRE(received.size() == expected);
+        const auto* largeData = static_cast<const char*>(large.getData());
+        CHECK(received.compare(4, large.getDataSize(), largeData, large.getDataSize()) == 0);
+        CHECK(received.compare(received.size() - 3, 3, "end") == 0);
+    }
+
+    SECTION("UDP")
+    {
+        sf::SocketReactor reactor;
+        sf::UdpSocket     sender;
+        sf::UdpSocket     receiver;
+        REQUIRE(receiver.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        char        buffer[16] = {};
+        std::size_t size       = 0;
+        reactor.asyncReceive(receiver,
+                             buffer,
+                             sizeof(buffer),
+                             [&](sf::Socket::Status           status,
+                                 std::size_t                  received,
+                                 std::optional<sf::IpAddress> address,
+                                 unsigned short)
+                             {
+                                 CHECK(status == sf::Socket::Status::Done);
+                                 CHECK(address == sf::IpAddress::LocalHost);
+                                 size = received;
+                             });
+        reactor.asyncSend(sender, "hello", 5, sf::IpAddress::LocalHost, receiver.getLocalPort());
+
+        CHECK(reactor.run() == 2);
+        CHECK(std::string(buffer, size) == "hello");
+    }
+
+    SECTION("cancel()")
+    {
+        sf::SocketReactor reactor;
+        sf::UdpSocket     socket;
+        REQUIRE(socket.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        char buffer[16];
+        bool called = false;
+        reactor.asyncReceive(socket,
+                             buffer,
+                             sizeof(buffer),
+                             [&](sf::Socket::Status, std::size_t, std::optional<sf::IpAddress>, unsigned short)
+                             { called = true; });
+        CHECK(reactor.poll() == 0);
+        reactor.cancel(socket);
+        CHECK(reactor.run() == 0);
+        CHECK(!called);
+    }
+
+    SECTION("stop()")
+    {
+        sf::SocketReactor reactor;
+        sf::UdpSocket     socket;
+        REQUIRE(socket.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        // The pending receive would keep the reactor running forever
+        char buffer[16];
+        reactor.asyncReceive(socket,
+                             buffer,
+                             sizeof(buffer),
+                             [](sf::Socket::Status, std::size_t, std::optional<sf::IpAddress>, unsigned short) {});
+
+        std::size_t count = 1;
+        std::thread thread([&] { count = reactor.run(); });
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        reactor.stop();
+        thread.join();
+        CHECK(count == 0);
+        reactor.cancel(socket);
+    }
+}
@@ -1,11 +1,18 @@
 #include <SFML/Network/TcpListener.hpp>
 
 // Other 1st party headers
+#include <SFML/Network/SocketSelector.hpp>
 #include <SFML/Network/TcpSocket.hpp>
 
+#include <SFML/System/Time.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <atomic>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 TEST_CASE("[Network] sf::TcpListener")
 {
@@ -21,6 +28,17 @@ TEST_CASE("[Network] sf::TcpListener")
     {
         const sf::TcpListener tcpListener;
         CHECK(tcpListener.getLocalPort() == 0);
+        CHECK(!tcpListener.isPortReuseEnabled());
+        CHECK(tcpListener.getBacklog() > 0);
+    }
+
+    SECTION("Set/get options")
+    {
+        sf::TcpListener tcpListener;
+        tcpListener.setPortReuseEnabled(true);
+        tcpListener.setBacklog(16);
+        CHECK(tcpListener.isPortReuseEnabled());
+        CHECK(tcpListener.getBacklog() == 16);
     }
 
     SECTION("listen()")
@@ -38,6 +56,27 @@ TEST_CASE("[Network] sf::TcpListener")
             CHECK(tcpListener.listen(0, sf::IpAddress::Broadcast) == sf::Socket::Status::Error);
             CHECK(tcpListener.getLocalPort() == 0);
         }
+
+        SECTION("Backlog")
+        {
+            tcpListener.setBacklog(1);
+            CHECK(tcpListener.listen(0) == sf::Socket::Status::Done);
+            CHECK(tcpListener.getLocalPort() != 0);
+        }
+
+#ifndef SFML_SYSTEM_WINDOWS
+        SECTION("Port reuse")
+        {
+            tcpListener.setPortReuseEnabled(true);
+            REQUIRE(tcpListener.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+            sf::TcpListener other;
+            CHECK(other.listen(tcpListener.getLocalPort(), sf::IpAddress::LocalHost) == sf::Socket::Status::Error);
+            other.setPortReuseEnabled(true);
+            CHECK(other.listen(tcpListener.getLocalPort(), sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+            CHECK(other.getLocalPort() == tcpListener.getLocalPort());
+        }
+#endif
     }
 
     SECTION("close()")
@@ -55,4 +94,143 @@ TEST_CASE("[Network] sf::TcpListener")
         sf::TcpSocket   tcpSocket;
         CHECK(tcpListener.accept(tcpSocket) == sf::Socket::Status::Error);
     }
+
+    SECTION("acceptAll()")
+    {
+        sf::TcpListener            tcpListener;
+        std::vector<sf::TcpSocket> sockets;
+        CHECK(tcpListener.acceptAll(sockets) == sf::Socket::Status::Error);
+        CHECK(sockets.empty());
+
+        REQUIRE(tcpListener.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        SECTION("Nothing pending")
+        {
+            tcpListener.setBlocking(false);
+            CHECK(tcpListener.acceptAll(sockets) == sf::Socket::Status::NotReady);
+            CHECK(sockets.empty());
+        }
+
+        SECTION("Pending connections")
+        {
+            const unsigned short       port = tcpListener.getLocalPort();
+            std::vector<sf::TcpSocket> clients(5);
+            for (sf::TcpSocket& client : clients)
+                REQUIRE(client.connect(sf::IpAddress::LocalHost, port) == sf::Socket::Status::Done);
+
+            // The connections are all accepted at once, unless the system is still processing some of them
+            sockets.emplace_back();
+            while (sockets.size() < clients.size() + 1)
+                REQUIRE(tcpListener.acceptAll(sockets) == sf::Socket::Status::Done);
+
+            CHECK(sockets.size() == clients.size() + 1);
+            CHECK(tcpListener.isBlocking());
+            for (std::size_t i = 1; i < sockets.size(); ++i)
+            {
+                CHECK(sockets[i].getRemoteAddress() == sf::IpAddress::LocalHost);
+                CHECK(sockets[i].isBlocking());
+            }
+        }
+    }
+}
+
+TEST_CASE("[Network] sf::TcpListener accept benchmark", "[.benchmark]")
+{
+    constexpr std::size_t connectionCount = 1000;
+    constexpr std::size_t clientCount     = 8;
+
+    // Accept a storm of loopback connections with several listeners sharing the port, one per thread
+    const auto measure = [](std::size_t listenerCount, bool batched)
+    {
+        std::vector<sf::TcpListener> listeners(listenerCount);
+        unsigned short               port = 0;
+        for (sf::TcpListener& listener : listeners)
+        {
+            listener.setPortReuseEnabled(listenerCount > 1);
+            listener.setBacklog(4096);
+            REQUIRE(listener.listen(port, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+            port = listener.getLocalPort();
+        }
+
+        std::atomic<std::size_t> accepted{};
+        std::atomic<bool>        failed{};
+        std::vector<std::thread> threads;
+
+        for (sf::TcpListener& listener : listeners)
+        {
+            threads.emplace_back(
+                [&listener, &accepted, &failed, batched]
+                {
+                    sf::SocketSelector selector;
+                    selector.add(listener);
+                    listener.setBlocking(false);
+
+                    std::vector<sf::TcpSocket> sockets;
+                    while (accepted < connectionCount && !failed)
+                    {
+                        if (!selector.wait(sf::milliseconds(10)))
+                            continue;
+
+                        sockets.clear();
+                        if (batched)
+                        {
+                            if (listener.acceptAll(sockets) != sf::Socket::Status::Done)
+                                continue;
+                        }
+                        else
+                        {
+                            sockets.emplace_back();
+                            if (listener.accept(sockets.back()) != sf::Socket::Status::Done)
+                                continue;
+                        }
+                        accepted += sockets.size();
+                    }
+                });
+        }
+
+        for (std::size_t i = 0; i < clientCount; ++i)
+        {
+            threads.emplace_back(
+                [port, &failed]
+                {
+                    for (std::size_t j = 0; j < connectionCount / clientCount; ++j)
+                    {
+                        sf::TcpSocket client;
+                        if (client.connect(sf::IpAddress::LocalHost, port) != sf::Socket::Status::Done)
+                        {
+                            failed = true;
+                            return;
+                        }
+                    }
+                });
+        }
+
+        for (std::thread& thread : threads)
+            thread.join();
+
+        REQUIRE(!failed);
+        return accepted.load();
+    };
+
+    BENCHMARK("1 listener, accept")
+    {
+        return measure(1, false);
+    };
+
+    BENCHMARK("1 listener, acceptAll")
+    {
+        return measure(1, true);
+    };
+
+#ifndef SFML_SYSTEM_WINDOWS
+    BENCHMARK("4 listeners, accept")
+    {
+        return measure(4, false);
+    };
+
+    BENCHMARK("4 listeners, acceptAll")
+    {
+        return measure(4, true);
+    };
+#endif
 }
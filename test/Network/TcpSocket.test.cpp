@@ -2,10 +2,15 @@
 
 // Other 1st party headers
 #include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/TcpListener.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <string>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 TEST_CASE("[Network] sf::TcpSocket")
 {
@@ -24,4 +29,87 @@ TEST_CASE("[Network] sf::TcpSocket")
         CHECK(!tcpSocket.getRemoteAddress().has_value());
         CHECK(tcpSocket.getRemotePort() == 0);
     }
+
+    SECTION("Send queue")
+    {
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::TcpSocket sender;
+        sf::TcpSocket receiver;
+        REQUIRE(sender.connect(sf::IpAddress::LocalHost, listener.getLocalPort()) == sf::Socket::Status::Done);
+        REQUIRE(listener.accept(receiver) == sf::Socket::Status::Done);
+
+        SECTION("Empty queue")
+        {
+            CHECK(sender.getQueuedSize() == 0);
+            CHECK(!sender.isQueueFull());
+            CHECK(sender.flush() == sf::Socket::Status::Done);
+        }
+
+        SECTION("Packets")
+        {
+            sf::Packet packet;
+            packet << std::string("first");
+            sender.queue(packet);
+            packet.clear();
+            packet << std::string("second");
+            sender.queue(packet);
+            CHECK(sender.getQueuedSize() == 2 * 4 + 4 + 5 + 4 + 6);
+            CHECK(sender.flush() == sf::Socket::Status::Done);
+            CHECK(sender.getQueuedSize() == 0);
+
+            std::string string;
+            REQUIRE(receiver.receive(packet) == sf::Socket::Status::Done);
+            CHECK((packet >> string));
+            CHECK(string == "first");
+            REQUIRE(receiver.receive(packet) == sf::Socket::Status::Done);
+            CHECK((packet >> string));
+            CHECK(string == "second");
+        }
+
+        SECTION("Backpressure")
+        {
+            // Queue much more data than the system buffers can hold, in blocks of various sizes
+            std::string data;
+            for (std::size_t i = 0; data.size() < 16 * 1024 * 1024; ++i)
+                data += std::string(1 + (i * 7919) % 100000, static_cast<char>('a' + i % 26));
+
+            sender.setQueueWatermarks(1024 * 1024, 4 * 1024 * 1024);
+            sender.setBlocking(false);
+            for (std::size_t offset = 0; offset < data.size(); offset += 1000)
+                sender.queue(data.data() + offset, std::min<std::size_t>(1000, data.size() - offset));
+
+            CHECK(sender.getQueuedSize() == data.size());
+            CHECK(sender.isQueueFull());
+
+            // The peer doesn't receive anything yet, so only part of the queue can be sent
+            sf::Socket::Status status = sender.flush();
+            CHECK(((status == sf::Socket::Status::Partial) || (status == sf::Socket::Status::NotReady)));
+            CHECK(sender.getQueuedSize() > 0);
+            CHECK(sender.isQueueFull());
+
+            std::string received;
+            std::thread thread(
+                [&]
+                {
+                    std::vector<char> buffer(64 * 1024);
+                    std::size_t       size = 0;
+                    while ((received.size() < data.size()) &&
+                           (receiver.receive(buffer.data(), buffer.size(), size) == sf::Socket::Status::Done))
+                        received.append(buffer.data(), size);
+                });
+
+            while ((status = sender.flush()) != sf::Socket::Status::Done)
+            {
+                REQUIRE(((status == sf::Socket::Status::Partial) || (status == sf::Socket::Status::NotReady)));
+                std::this_thread::yield();
+            }
+
+            thread.join();
+            CHECK(sender.getQueuedSize() == 0);
+            CHECK(!sender.isQueueFull());
+            CHECK(received == data);
+        }
+    }
 }
@@ -0,0 +1,299 @@
+#include <SFML/Network/UdpConnection.hpp>
+
+// Other 1st party headers
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Sleep.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <SystemUtil.hpp>
+#include <optional>
+#include <random>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+// Relays the datagrams between two sockets, losing and reordering some of them
+class LossyRelay
+{
+public:
+    LossyRelay(unsigned short firstPort, unsigned short secondPort, double lossRate) :
+    m_firstPort(firstPort),
+    m_secondPort(secondPort),
+    m_lossRate(lossRate)
+    {
+        REQUIRE(m_socket.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        m_socket.setBlocking(false);
+    }
+
+    unsigned short getPort() const
+    {
+        return m_socket.getLocalPort();
+    }
+
+    void pump()
+    {
+        std::vector<std::byte>       datagram(sf::UdpSocket::MaxDatagramSize);
+        std::size_t                  received = 0;
+        std::optional<sf::IpAddress> sender;
+        unsigned short               senderPort = 0;
+        while (m_socket.receive(datagram.data(), datagram.size(), received, sender, senderPort) ==
+               sf::Socket::Status::Done)
+        {
+            const unsigned short destination = senderPort == m_firstPort ? m_secondPort : m_firstPort;
+            const double         draw        = m_distribution(m_generator);
+            if (draw < m_lossRate)
+                continue;
+
+            // Hold some datagrams, so that they arrive after the next one
+            if (draw < m_lossRate * 1.5 && m_held.empty())
+            {
+                m_held.assign(datagram.begin(), datagram.begin() + static_cast<std::ptrdiff_t>(received));
+                m_heldDestination = destination;
+                continue;
+            }
+
+            (void)m_socket.send(datagram.data(), received, sf::IpAddress::LocalHost, destination);
+            if (!m_held.empty())
+            {
+                (void)m_socket.send(m_held.data(), m_held.size(), sf::IpAddress::LocalHost, m_heldDestination);
+                m_held.clear();
+            }
+        }
+    }
+
+private:
+    sf::UdpSocket                          m_socket;
+    unsigned short                         m_firstPort;
+    unsigned short                         m_secondPort;
+    double                                 m_lossRate;
+    std::mt19937                           m_generator{42};
+    std::uniform_real_distribution<double> m_distribution{0.0, 1.0};
+    std::vector<std::byte>                 m_held;
+    unsigned short                         m_heldDestination{};
+};
+
+sf::Packet makeMessage(std::uint32_t index, std::size_t size = 0)
+{
+    sf::Packet packet;
+    packet << index << std::string(size, static_cast<char>('a' + index % 26));
+    return packet;
+}
+
+std::uint32_t readIndex(sf::Packet& packet, std::size_t& size)
+{
+    std::uint32_t index = 0;
+    std::string   text;
+    packet >> index >> text;
+    size = text.size();
+    return index;
+}
+} // namespace
+
+TEST_CASE("[Network] sf::UdpConnection")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::UdpConnection>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::UdpConnection>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::UdpConnection>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::UdpConnection>);
+    }
+
+    sf::UdpSocket clientSocket;
+    sf::UdpSocket serverSocket;
+    REQUIRE(clientSocket.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+    REQUIRE(serverSocket.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+    SECTION("Construction")
+    {
+        const sf::UdpConnection connection(clientSocket, sf::IpAddress::LocalHost, serverSocket.getLocalPort());
+        CHECK(connection.getRemoteAddress() == sf::IpAddress::LocalHost);
+        CHECK(connection.getRemotePort() == serverSocket.getLocalPort());
+        CHECK(connection.getRoundTripTime() > sf::Time::Zero);
+        CHECK(connection.getUnacknowledgedCount() == 0);
+        CHECK(connection.getStatistics().sentDatagrams == 0);
+        CHECK(!clientSocket.isBlocking());
+    }
+
+    SECTION("Lossless")
+    {
+        sf::UdpConnection client(clientSocket, sf::IpAddress::LocalHost, serverSocket.getLocalPort());
+        sf::UdpConnection server(serverSocket, sf::IpAddress::LocalHost, clientSocket.getLocalPort());
+
+        sf::Packet packet = makeMessage(0);
+        CHECK(client.send(packet) == sf::Socket::Status::Done);
+        packet = makeMessage(1, 10'000);
+        CHECK(client.send(packet, 1, sf::UdpConnection::Delivery::Reliable) == sf::Socket::Status::Done);
+        packet = makeMessage(2, 100);
+        CHECK(client.send(packet, 2, sf::UdpConnection::Delivery::Unreliable) == sf::Socket::Status::Done);
+        CHECK(client.getUnacknowledgedCount() == 2);
+        CHECK(client.getStatistics().sentMessages == 3);
+        CHECK(client.getStatistics().sentDatagrams == 1 + 9 + 1);
+
+        server.update();
+
+        std::set<std::uint32_t> received;
+        std::uint8_t            channel = 0;
+        while (server.receive(packet, channel))
+        {
+            std::size_t         size  = 0;
+            const std::uint32_t index = readIndex(packet, size);
+            CHECK(channel == index);
+            CHECK(size == (index == 0 ? 0 : index == 1 ? 10'000 : 100));
+            received.insert(index);
+        }
+        CHECK(received == std::set<std::uint32_t>{0, 1, 2});
+        CHECK(server.getStatistics().receivedMessages == 3);
+        CHECK(server.getTimeSinceLastReceive() < sf::seconds(1));
+
+        // The acknowledgments free the reliable messages
+        server.update();
+        client.update();
+        CHECK(client.getUnacknowledgedCount() == 0);
+        CHECK(client.getStatistics().resentDatagrams == 0);
+        CHECK(!client.receive(packet, channel));
+    }
+
+    SECTION("Lossy network")
+    {
+        LossyRelay        relay(clientSocket.getLocalPort(), serverSocket.getLocalPort(), 0.2);
+        sf::UdpConnection client(clientSocket, sf::IpAddress::LocalHost, relay.getPort());
+        sf::UdpConnection server(serverSocket, sf::IpAddress::LocalHost, relay.getPort());
+
+        constexpr std::uint32_t orderedCount  = 200;
+        constexpr std::uint32_t reliableCount = 50;
+        for (std::uint32_t i = 0; i < orderedCount; ++i)
+        {
+            sf::Packet packet = makeMessage(i, i % 50 == 0 ? 5'000 : 10);
+            CHECK(client.send(packet, 0, sf::UdpConnection::Delivery::Ordered) == sf::Socket::Status::Done);
+        }
+        for (std::uint32_t i = 0; i < reliableCount; ++i)
+        {
+            sf::Packet packet = makeMessage(i);
+            CHECK(client.send(packet, 1, sf::UdpConnection::Delivery::Reliable) == sf::Socket::Status::Done);
+        }
+
+        std::vector<std::uint32_t> ordered;
+        std::set<std::uint32_t>    reliable;
+        bool                       sizesMatch = true;
+        const sf::Clock            clock;
+        while ((client.getUnacknowledgedCount() > 0) && (clock.getElapsedTime() < sf::seconds(20)))
+        {
+            client.update();
+            relay.pump();
+            server.update();
+            relay.pump();
+
+            sf::Packet   packet;
+            std::uint8_t channel = 0;
+            while (server.receive(packet, channel))
+            {
+                std::size_t         size  = 0;
+                const std::uint32_t index = readIndex(packet, size);
+                if (channel == 0)
+                {
+                    ordered.push_back(index);
+                    sizesMatch = sizesMatch && (size == (index % 50 == 0 ? 5'000 : 10));
+                }
+                else
+                {
+                    reliable.insert(index);
+                }
+            }
+
+            sf::sleep(sf::milliseconds(1));
+        }
+
+        CHECK(client.getUnacknowledgedCount() == 0);
+        CHECK(client.getStatistics().resentDatagrams > 0);
+        CHECK(sizesMatch);
+        CHECK(reliable.size() == reliableCount);
+        REQUIRE(ordered.size() == orderedCount);
+        for (std::uint32_t i = 0; i < orderedCount; ++i)
+            CHECK(ordered[i] == i);
+    }
+
+    SECTION("Large messages")
+    {
+        // Several hundred fragments, many more than the acknowledgments can cover at once
+        constexpr std::size_t messageSize = 400'000;
+
+        const auto transfer = [&](unsigned short clientRemotePort, unsigned short serverRemotePort, LossyRelay* relay)
+        {
+            sf::UdpConnection client(clientSocket, sf::IpAddress::LocalHost, clientRemotePort);
+            sf::UdpConnection server(serverSocket, sf::IpAddress::LocalHost, serverRemotePort);
+
+            sf::Packet packet = makeMessage(7, messageSize);
+            CHECK(client.send(packet, 0, sf::UdpConnection::Delivery::Reliable) == sf::Socket::Status::Done);
+
+            std::optional<std::size_t> receivedSize;
+            const sf::Clock            clock;
+            while ((client.getUnacknowledgedCount() > 0) && (clock.getElapsedTime() < sf::seconds(20)))
+            {
+                client.update();
+                if (relay)
+                    relay->pump();
+                server.update();
+                if (relay)
+                    relay->pump();
+
+                std::uint8_t channel = 0;
+                while (server.receive(packet, channel))
+                {
+                    std::size_t size = 0;
+                    CHECK(readIndex(packet, size) == 7);
+                    receivedSize = size;
+                }
+
+                sf::sleep(sf::milliseconds(1));
+            }
+
+            CHECK(client.getUnacknowledgedCount() == 0);
+            CHECK(receivedSize == messageSize);
+            return client.getStatistics();
+        };
+
+        SECTION("Lossless")
+        {
+            const sf::UdpConnection::Statistics statistics = transfer(serverSocket.getLocalPort(),
+                                                                      clientSocket.getLocalPort(),
+                                                                      nullptr);
+            CHECK(statistics.resentDatagrams == 0);
+        }
+
+        SECTION("Lossy network")
+        {
+            LossyRelay relay(clientSocket.getLocalPort(), serverSocket.getLocalPort(), 0.1);
+            const sf::UdpConnection::Statistics statistics = transfer(relay.getPort(), relay.getPort(), &relay);
+
+            // Only the lost fragments are resent, not the whole message over and over
+            const std::size_t fragmentCount = messageSize / sf::UdpConnection::MaxFragmentSize + 1;
+            CHECK(statistics.resentDatagrams > 0);
+            CHECK(statistics.resentDatagrams < fragmentCount);
+        }
+    }
+
+    SECTION("Invalid datagrams")
+    {
+        sf::UdpConnection connection(serverSocket, sf::IpAddress::LocalHost, clientSocket.getLocalPort());
+
+        const std::vector<std::byte> garbage(100, std::byte{0xA7});
+        connection.handleDatagram(garbage.data(), garbage.size());
+        connection.handleDatagram(garbage.data(), 5);
+        connection.handleDatagram(nullptr, 0);
+
+        sf::Packet   packet;
+        std::uint8_t channel = 0;
+        CHECK(!connection.receive(packet, channel));
+    }
+}
@@ -0,0 +1,71 @@
+#include <SFML/Audio/OutputSoundFile.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <AudioBenchmarkUtil.hpp>
+#include <string>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+struct BenchmarkFiles
+{
+    BenchmarkFiles()
+    {
+        constexpr unsigned int sampleRate   = 44'100;
+        constexpr unsigned int channelCount = 2;
+        constexpr std::size_t  frameCount   = sampleRate * 30;
+
+        // A chord with a slow tremolo and some noise, so that the encoders have real work to do
+        constexpr double          twoPi = 2 * 3.14159265358979;
+        std::vector<std::int16_t> samples(frameCount * channelCount);
+        std::uint32_t             noise = 1;
+        for (std::size_t i = 0; i < frameCount; ++i)
+        {
+            const double time    = static_cast<double>(i) / sampleRate;
+            const double tremolo = 0.6 + 0.3 * std::sin(twoPi * 0.5 * time);
+            for (std::size_t channel = 0; channel < channelCount; ++channel)
+            {
+                noise = noise * 1'664'525u + 1'013'904'223u;
+                const double frequency = 220.0 + 110.0 * static_cast<double>(channel);
+                const double value     = std::sin(twoPi * frequency * time) * 0.5 +
+                                         std::sin(twoPi * 277.18 * time) * 0.3 +
+                                         static_cast<double>(noise >> 16) / 65'536.0 * 0.1 - 0.05;
+                samples[i * channelCount + channel] = static_cast<std::int16_t>(value * tremolo * 32'767);
+            }
+        }
+
+        const std::filesystem::path directory = std::filesystem::temp_directory_path();
+        for (const char* extension : {".wav", ".ogg", ".flac"})
+        {
+            const std::filesystem::path path = directory / ("sfml-benchmark-long" + std::string(extension));
+
+            sf::OutputSoundFile file;
+            REQUIRE(file.openFromFile(path, sampleRate, channelCount));
+            file.write(samples.data(), samples.size());
+            generated.push_back(path);
+        }
+
+        paths = {"Audio/killdeer.wav", "Audio/doodle_pop.ogg", "Audio/ding.flac", "Audio/ding.mp3"};
+        paths.insert(paths.end(), generated.begin(), generated.end());
+    }
+
+    ~BenchmarkFiles()
+    {
+        for (const std::filesystem::path& path : generated)
+            std::filesystem::remove(path);
+    }
+
+    std::vector<std::filesystem::path> generated;
+    std::vector<std::filesystem::path> paths;
+};
+} // namespace
+
+const std::vector<std::filesystem::path>& getBenchmarkFiles()
+{
+    static const BenchmarkFiles benchmarkFiles;
+    return benchmarkFiles.paths;
+}
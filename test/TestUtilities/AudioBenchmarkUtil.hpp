@@ -0,0 +1,13 @@
+// Header for SFML unit tests.
+//
+// For an audio module benchmark that decodes sound files, include this header.
+// The implementation needs the audio module, so it is built with the audio tests rather than sfml-test-main.
+
+#pragma once
+
+#include <filesystem>
+#include <vector>
+
+// The test assets, one per reader, followed by 30 seconds long stereo files generated
+// on the first call and removed when the tests end
+[[nodiscard]] const std::vector<std::filesystem::path>& getBenchmarkFiles();
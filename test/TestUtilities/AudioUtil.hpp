@@ -0,0 +1,12 @@
+// Header for SFML unit tests.
+//
+// For an audio module test case that needs an audio device, include this header.
+
+#pragma once
+
+#include <SystemUtil.hpp>
+#include <string>
+
+// Required because AudioUtil.cpp doesn't include AudioUtil.hpp
+// NOLINTNEXTLINE(readability-redundant-declaration)
+std::string runAudioDeviceTests();